@@ -0,0 +1,244 @@
+#ifndef __YJ_ROBOT_SDK_BENCH_COMMON_HPP__
+#define __YJ_ROBOT_SDK_BENCH_COMMON_HPP__
+
+/**
+ * @file bench_common.hpp
+ * @brief 桥接层基准程序共用的参数解析、传输配置与结果输出
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+namespace bench
+{
+
+/**
+ * @brief "--key value"形式的命令行参数
+ */
+class Args {
+public:
+    Args(int argc, char** argv) {
+        for (int i = 1; i < argc; ++i) {
+            std::string key = argv[i];
+            if (key.rfind("--", 0) != 0) {
+                continue;
+            }
+            key = key.substr(2);
+            if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+                values_[key] = argv[++i];
+            } else {
+                values_[key] = "1";
+            }
+        }
+    }
+
+    std::string Get(const std::string& key, const std::string& fallback) const {
+        auto it = values_.find(key);
+        return it == values_.end() ? fallback : it->second;
+    }
+
+    long long GetInt(const std::string& key, long long fallback) const {
+        auto it = values_.find(key);
+        return it == values_.end() ? fallback : std::atoll(it->second.c_str());
+    }
+
+    bool Has(const std::string& key) const { return values_.count(key) != 0; }
+
+private:
+    std::map<std::string, std::string> values_;
+};
+
+/**
+ * @brief 以逗号分隔的列表，"all"展开为全集
+ */
+inline std::vector<std::string> SplitList(const std::string& text, const std::vector<std::string>& all) {
+    if (text == "all") {
+        return all;
+    }
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+inline std::vector<long long> SplitIntList(const std::string& text) {
+    std::vector<long long> items;
+    for (const auto& item : SplitList(text, {})) {
+        items.push_back(std::atoll(item.c_str()));
+    }
+    return items;
+}
+
+/**
+ * @brief 按传输方式设置CYCLONEDDS_URI，需在BridgeFactory::Init()之前调用
+ * @param transport intra（进程内，不与其他进程发现）、udp（回环UDP单播）、shm（iceoryx共享内存，需先启动iox-roudi）
+ * @return 传输名无效时返回false
+ */
+inline bool ConfigureTransport(const std::string& transport) {
+    std::string shared_memory;
+    // 只走回环单播：基准结果不受物理网卡和组播配置影响
+    std::string discovery = "<Discovery><ParticipantIndex>auto</ParticipantIndex>"
+                            "<MaxAutoParticipantIndex>64</MaxAutoParticipantIndex>"
+                            "<Peers><Peer address=\"127.0.0.1\"/></Peers></Discovery>";
+    if (transport == "intra") {
+        // 不配置对端、不用组播：参与者发现不到其他进程，数据只在进程内投递，不经过网络栈
+        shared_memory = "<SharedMemory><Enable>false</Enable></SharedMemory>";
+        discovery = "<Discovery><ParticipantIndex>none</ParticipantIndex></Discovery>";
+    } else if (transport == "udp") {
+        shared_memory = "<SharedMemory><Enable>false</Enable></SharedMemory>";
+    } else if (transport == "shm") {
+        shared_memory = "<SharedMemory><Enable>true</Enable><LogLevel>warn</LogLevel></SharedMemory>";
+    } else {
+        return false;
+    }
+    const std::string config =
+        "<CycloneDDS><Domain id=\"any\">"
+        "<General><Interfaces><NetworkInterface address=\"127.0.0.1\"/></Interfaces>"
+        "<AllowMulticast>false</AllowMulticast></General>" +
+        discovery + shared_memory +
+        "</Domain></CycloneDDS>";
+    ::setenv("CYCLONEDDS_URI", config.c_str(), 1);
+    return true;
+}
+
+/**
+ * @brief 延迟分布（微秒），由全部样本排序得到精确分位数
+ */
+struct LatencySummary {
+    size_t count = 0;
+    double min = 0, mean = 0, p50 = 0, p90 = 0, p99 = 0, p999 = 0, max = 0;
+};
+
+inline LatencySummary Summarize(std::vector<double>& samples_us) {
+    LatencySummary summary;
+    summary.count = samples_us.size();
+    if (samples_us.empty()) {
+        return summary;
+    }
+    std::sort(samples_us.begin(), samples_us.end());
+    auto at = [&samples_us](double q) {
+        const size_t index = static_cast<size_t>(q * (samples_us.size() - 1) + 0.5);
+        return samples_us[std::min(index, samples_us.size() - 1)];
+    };
+    double sum = 0;
+    for (double value : samples_us) {
+        sum += value;
+    }
+    summary.min = samples_us.front();
+    summary.max = samples_us.back();
+    summary.mean = sum / samples_us.size();
+    summary.p50 = at(0.5);
+    summary.p90 = at(0.9);
+    summary.p99 = at(0.99);
+    summary.p999 = at(0.999);
+    return summary;
+}
+
+/**
+ * @brief 结果表：一行一组配置，列按首次出现的顺序输出为CSV或JSON
+ */
+class ResultTable {
+public:
+    void BeginRow() { rows_.emplace_back(); }
+
+    void Set(const std::string& column, const std::string& value) {
+        if (std::find(columns_.begin(), columns_.end(), column) == columns_.end()) {
+            columns_.push_back(column);
+        }
+        rows_.back()[column] = "\"" + value + "\"";
+    }
+
+    void Set(const std::string& column, double value) {
+        if (std::find(columns_.begin(), columns_.end(), column) == columns_.end()) {
+            columns_.push_back(column);
+        }
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+        rows_.back()[column] = buffer;
+    }
+
+    std::string ToCsv() const {
+        std::string out;
+        for (size_t i = 0; i < columns_.size(); ++i) {
+            out += (i ? "," : "") + columns_[i];
+        }
+        out += "\n";
+        for (const auto& row : rows_) {
+            for (size_t i = 0; i < columns_.size(); ++i) {
+                auto it = row.find(columns_[i]);
+                std::string value = it == row.end() ? "" : it->second;
+                if (!value.empty() && value.front() == '"') {
+                    value = value.substr(1, value.size() - 2);
+                }
+                out += (i ? "," : "") + value;
+            }
+            out += "\n";
+        }
+        return out;
+    }
+
+    std::string ToJson() const {
+        std::string out = "[\n";
+        for (size_t r = 0; r < rows_.size(); ++r) {
+            out += "  {";
+            bool first = true;
+            for (const auto& column : columns_) {
+                auto it = rows_[r].find(column);
+                if (it == rows_[r].end()) {
+                    continue;
+                }
+                out += (first ? "\"" : ", \"") + column + "\": " + it->second;
+                first = false;
+            }
+            out += r + 1 < rows_.size() ? "},\n" : "}\n";
+        }
+        out += "]\n";
+        return out;
+    }
+
+    /**
+     * @brief 按format（csv/json）输出到文件，path为空时输出到标准输出
+     */
+    bool Write(const std::string& format, const std::string& path) const {
+        const std::string text = format == "json" ? ToJson() : ToCsv();
+        if (path.empty()) {
+            std::fputs(text.c_str(), stdout);
+            return true;
+        }
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (file == nullptr) {
+            std::fprintf(stderr, "cannot open %s\n", path.c_str());
+            return false;
+        }
+        std::fputs(text.c_str(), file);
+        std::fclose(file);
+        return true;
+    }
+
+private:
+    std::vector<std::string> columns_;
+    std::vector<std::map<std::string, std::string>> rows_;
+};
+
+}
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BENCH_COMMON_HPP__
@@ -0,0 +1,304 @@
+/**
+ * @file bridge_discovery.cpp
+ * @brief 发现延迟与首样本时间基准
+ * @note 模拟电机控制器重启：本进程作为机器人侧常驻订阅JointStateData，每轮重新exec自身作为
+ *       控制器子进程，子进程依次创建参与者、创建发布者并持续以--rate-hz发布。统计各阶段耗时：
+ *       进程启动、参与者创建、端点创建、写者匹配到订阅端，以及从子进程启动到本进程收到第一条样本
+ *       （time-to-first-sample）。default为Cyclone默认发现参数（依赖组播），fast为
+ *       BridgeDiscoveryOptions::Fast()，两者都运行时额外给出fast相对default的重连时间缩短比例。
+ *       时间戳取CLOCK_MONOTONIC，跨进程可比。
+ *
+ * 用法: bench_bridge_discovery [--profile all|default,fast] [--iterations 20] [--interface 网卡]
+ *                              [--peers 127.0.0.1] [--qos control] [--rate-hz 1000]
+ *                              [--timeout-ms 15000] [--domain 40] [--format csv|json] [--output 文件]
+ */
+#include "bench_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_publisher.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_subscriber.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <atomic>
+#include <csignal>
+#include <memory>
+#include <thread>
+
+#include <poll.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+using namespace yunji::robot;
+
+namespace
+{
+
+using Msg = JointState::JointStateData;
+
+const std::vector<std::string> kAllProfiles = {"default", "fast"};
+const char* const kTopic = "bench/discovery/joint_state";
+
+std::atomic<bool> g_stop{false};
+
+void OnSignal(int) {
+    g_stop = true;
+}
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool ProfileOptions(const std::string& profile, const bench::Args& args, BridgeDiscoveryOptions& options) {
+    if (profile == "default") {
+        options = BridgeDiscoveryOptions();
+    } else if (profile == "fast") {
+        options = BridgeDiscoveryOptions::Fast(bench::SplitList(args.Get("peers", "127.0.0.1"), {}));
+    } else {
+        return false;
+    }
+    options.network_interface = args.Get("interface", "");
+    return true;
+}
+
+/**
+ * @brief 控制器子进程：匹配到订阅端后输出各阶段时间戳，之后持续发布直到SIGTERM
+ */
+int RunController(const bench::Args& args) {
+    const int64_t start_ns = NowNs();
+    BridgeDiscoveryOptions options;
+    ProfileOptions(args.Get("profile", "default"), args, options);
+    BridgeFactory::Instance()->Init(static_cast<int>(args.GetInt("domain", 40)), options);
+    const int64_t participant_ns = NowNs();
+
+    BridgeQosPreset preset = BridgeQosPreset::kControl;
+    BridgeQosPresetFromName(args.Get("qos", "control"), preset);
+    BridgePublisher<Msg> publisher(kTopic);
+    publisher.SetQosPreset(preset);
+    if (!publisher.InitBridge()) {
+        return 1;
+    }
+    const int64_t endpoint_ns = NowNs();
+
+    Msg msg;
+    msg.id(static_cast<int32_t>(args.GetInt("iteration", 0)));
+    const auto period = std::chrono::nanoseconds(static_cast<int64_t>(1e9 / std::max(1.0, std::atof(
+        args.Get("rate-hz", "1000").c_str()))));
+    auto next = std::chrono::steady_clock::now();
+    bool reported = false;
+    uint64_t sequence = 0;
+    while (!g_stop) {
+        // 控制器不等待匹配，上电即按周期发布，与实际重启行为一致
+        if (!reported && publisher.MatchedSubscribers() > 0) {
+            std::printf("%lld %lld %lld %lld\n", static_cast<long long>(start_ns),
+                        static_cast<long long>(participant_ns), static_cast<long long>(endpoint_ns),
+                        static_cast<long long>(NowNs()));
+            std::fflush(stdout);
+            reported = true;
+        }
+        msg.sequence_frame(++sequence);
+        msg.timestamp(static_cast<uint64_t>(NowNs()));
+        publisher.Write(msg);
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+    return 0;
+}
+
+pid_t SpawnController(const std::vector<std::string>& extra, int& read_fd) {
+    int pipe_fds[2];
+    if (::pipe(pipe_fds) != 0) {
+        return -1;
+    }
+    std::vector<std::string> args = {"/proc/self/exe", "--role", "controller"};
+    args.insert(args.end(), extra.begin(), extra.end());
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, pipe_fds[0]);
+    pid_t pid = -1;
+    if (posix_spawn(&pid, "/proc/self/exe", &actions, nullptr, argv.data(), environ) != 0) {
+        pid = -1;
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    ::close(pipe_fds[1]);
+    read_fd = pipe_fds[0];
+    return pid;
+}
+
+/**
+ * @brief 读一行，超时或对端关闭时返回false
+ */
+bool ReadLine(int fd, std::string& line, int64_t deadline_ns) {
+    line.clear();
+    while (true) {
+        const int64_t remaining_ms = (deadline_ns - NowNs()) / 1000000;
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (remaining_ms <= 0 || ::poll(&pfd, 1, static_cast<int>(remaining_ms)) <= 0) {
+            return false;
+        }
+        char c;
+        if (::read(fd, &c, 1) != 1) {
+            return false;
+        }
+        if (c == '\n') {
+            return true;
+        }
+        line += c;
+    }
+}
+
+struct Phases {
+    std::vector<double> spawn_ms;           // posix_spawn到子进程main开始
+    std::vector<double> participant_ms;     // 参与者创建
+    std::vector<double> endpoint_ms;        // 发布者（topic/publisher/writer）创建
+    std::vector<double> match_ms;           // 写者创建完成到匹配到订阅端
+    std::vector<double> first_sample_ms;    // 子进程main开始到本进程收到第一条样本
+    std::vector<double> restart_ms;         // posix_spawn到收到第一条样本
+};
+
+void AddPhase(bench::ResultTable& table, const std::string& name, std::vector<double>& values) {
+    const bench::LatencySummary summary = bench::Summarize(values);
+    table.Set(name + "_p50_ms", summary.p50);
+    table.Set(name + "_p90_ms", summary.p90);
+    table.Set(name + "_max_ms", summary.max);
+}
+
+/**
+ * @brief 以一种发现配置运行全部轮次
+ * @return restart_ms的中位数，全部失败时为负数
+ */
+double RunProfile(const std::string& profile, int domain, const bench::Args& args, bench::ResultTable& table) {
+    BridgeDiscoveryOptions options;
+    ProfileOptions(profile, args, options);
+    const int64_t init_start = NowNs();
+    BridgeFactory::Instance()->Init(domain, options);
+    const double robot_participant_ms = (NowNs() - init_start) / 1e6;
+
+    BridgeQosPreset preset = BridgeQosPreset::kControl;
+    BridgeQosPresetFromName(args.Get("qos", "control"), preset);
+    std::atomic<int32_t> iteration{-1};
+    std::atomic<int64_t> first_ns{0};
+    auto subscriber = std::make_unique<BridgeSubscriber<Msg>>(kTopic);
+    subscriber->SetQosPreset(preset);
+    if (!subscriber->InitBridge([&](const Msg& msg) {
+            int64_t expected = 0;
+            if (msg.id() == iteration.load(std::memory_order_acquire)) {
+                first_ns.compare_exchange_strong(expected, NowNs(), std::memory_order_acq_rel);
+            }
+        })) {
+        std::fprintf(stderr, "subscriber init failed for profile %s\n", profile.c_str());
+        return -1.0;
+    }
+
+    const long long iterations = args.GetInt("iterations", 20);
+    const int64_t timeout_ns = args.GetInt("timeout-ms", 15000) * 1000000LL;
+    Phases phases;
+    long long failures = 0;
+    for (long long i = 0; i < iterations && !g_stop; ++i) {
+        iteration.store(static_cast<int32_t>(i), std::memory_order_release);
+        first_ns.store(0, std::memory_order_release);
+        const std::vector<std::string> extra = {
+            "--profile", profile, "--domain", std::to_string(domain), "--iteration", std::to_string(i),
+            "--qos", args.Get("qos", "control"), "--rate-hz", args.Get("rate-hz", "1000"),
+            "--interface", args.Get("interface", ""), "--peers", args.Get("peers", "127.0.0.1")};
+        int fd = -1;
+        const int64_t spawn_ns = NowNs();
+        const pid_t child = SpawnController(extra, fd);
+        if (child < 0) {
+            std::fprintf(stderr, "spawn failed\n");
+            return -1.0;
+        }
+
+        std::string line;
+        const int64_t deadline = spawn_ns + timeout_ns;
+        const bool matched = ReadLine(fd, line, deadline);
+        while (first_ns.load(std::memory_order_acquire) == 0 && NowNs() < deadline && !g_stop) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        const int64_t received_ns = first_ns.load(std::memory_order_acquire);
+        ::kill(child, SIGTERM);
+        ::waitpid(child, nullptr, 0);
+        ::close(fd);
+
+        long long start = 0, participant = 0, endpoint = 0, match = 0;
+        if (!matched || received_ns == 0 ||
+            std::sscanf(line.c_str(), "%lld %lld %lld %lld", &start, &participant, &endpoint, &match) != 4) {
+            ++failures;
+            std::fprintf(stderr, "%-7s #%lld timed out\n", profile.c_str(), i);
+            continue;
+        }
+        phases.spawn_ms.push_back((start - spawn_ns) / 1e6);
+        phases.participant_ms.push_back((participant - start) / 1e6);
+        phases.endpoint_ms.push_back((endpoint - participant) / 1e6);
+        phases.match_ms.push_back((match - endpoint) / 1e6);
+        phases.first_sample_ms.push_back((received_ns - start) / 1e6);
+        phases.restart_ms.push_back((received_ns - spawn_ns) / 1e6);
+        std::fprintf(stderr, "%-7s #%-3lld participant=%.1fms match=%.1fms first_sample=%.1fms\n", profile.c_str(), i,
+                     phases.participant_ms.back(), phases.match_ms.back(), phases.first_sample_ms.back());
+    }
+    subscriber.reset();
+
+    std::vector<double> restart = phases.restart_ms;
+    const double restart_p50 = restart.empty() ? -1.0 : bench::Summarize(restart).p50;
+    table.BeginRow();
+    table.Set("profile", profile);
+    table.Set("iterations", static_cast<double>(iterations));
+    table.Set("failures", static_cast<double>(failures));
+    table.Set("robot_participant_ms", robot_participant_ms);
+    AddPhase(table, "spawn", phases.spawn_ms);
+    AddPhase(table, "participant", phases.participant_ms);
+    AddPhase(table, "endpoint", phases.endpoint_ms);
+    AddPhase(table, "match", phases.match_ms);
+    AddPhase(table, "first_sample", phases.first_sample_ms);
+    AddPhase(table, "restart", phases.restart_ms);
+    return restart_p50;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    if (args.Get("role", "") == "controller") {
+        return RunController(args);
+    }
+
+    const std::vector<std::string> profiles = bench::SplitList(args.Get("profile", "all"), kAllProfiles);
+    for (const auto& profile : profiles) {
+        BridgeDiscoveryOptions options;
+        if (!ProfileOptions(profile, args, options)) {
+            std::fprintf(stderr, "unknown profile: %s\n", profile.c_str());
+            return 1;
+        }
+    }
+
+    bench::ResultTable table;
+    double default_p50 = -1.0, fast_p50 = -1.0;
+    const int base_domain = static_cast<int>(args.GetInt("domain", 40));
+    for (size_t i = 0; i < profiles.size() && !g_stop; ++i) {
+        // 每种配置用独立的域，避免上一种配置的残留发现信息影响结果
+        const double p50 = RunProfile(profiles[i], base_domain + static_cast<int>(i), args, table);
+        if (profiles[i] == "default") {
+            default_p50 = p50;
+        } else if (profiles[i] == "fast") {
+            fast_p50 = p50;
+        }
+    }
+    if (default_p50 > 0 && fast_p50 > 0) {
+        std::fprintf(stderr, "restart p50: default %.1f ms, fast %.1f ms (%.1f%% faster)\n", default_p50, fast_p50,
+                     100.0 * (default_p50 - fast_p50) / default_p50);
+    }
+    return table.Write(args.Get("format", "csv"), args.Get("output", "")) ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+/**
+ * @file bridge_roundtrip.cpp
+ * @brief 桥接层往返延迟基准
+ * @note 经BridgePublisher/BridgeSubscriber做ping-pong，覆盖HelloWorld、Imu、Bms、JointCmd、
+ *       JointStateData五种消息、intra/udp/shm三种传输以及全部QoS预设，输出min/中位数/p99/p99.9/max。
+ *       udp/shm下自动fork出pong子进程；也可以用--role ping/pong分别在两个进程（或两台机器）上运行。
+ *       shm需先启动iox-roudi，且HelloWorld（含string）不走共享内存。
+ *
+ * 用法: bench_bridge_roundtrip [--transport intra|udp|shm] [--role both|ping|pong]
+ *                              [--type all|helloworld,imu,bms,jointcmd,jointstate]
+ *                              [--qos all|default,control,reliable,telemetry,latched]
+ *                              [--samples 10000] [--warmup 1000] [--timeout-ms 100]
+ *                              [--perf] [--format csv|json] [--output 文件]
+ *       --perf在测量区间外包perf_event_open计数器，输出每次往返的周期、指令、cache/分支未命中、
+ *       上下文切换和IPC；计数覆盖本进程全部线程及fork出的pong子进程。
+ *       链接了分配钩子时额外输出本进程每次往返的堆分配次数（allocs_per_rtt）。
+ */
+#include "bench_common.hpp"
+#include "perf_counters.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_publisher.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_subscriber.hpp"
+#include "yunji/idl/HelloWorldData.hpp"
+#include "yunji/idl/ImuData.hpp"
+#include "yunji/idl/BmsData.hpp"
+#include "yunji/idl/JointCommand.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <atomic>
+#include <csignal>
+#include <memory>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace yunji::robot;
+
+namespace
+{
+
+const std::vector<std::string> kAllTypes = {"helloworld", "imu", "bms", "jointcmd", "jointstate"};
+const std::vector<std::string> kAllQos = {"default", "control", "reliable", "telemetry", "latched"};
+
+std::atomic<bool> g_running{true};
+
+void OnSignal(int) {
+    g_running = false;
+}
+
+/**
+ * @brief 往返序号写入消息：机器人类型用sequence_frame，HelloWorld用userID
+ */
+template <typename T>
+void SetSequence(T& msg, uint64_t sequence) {
+    if constexpr (BridgeHasSequenceStamp<T>::value) {
+        msg.sequence_frame(sequence);
+    } else {
+        msg.userID(static_cast<int32_t>(sequence));
+        msg.message("roundtrip");
+    }
+}
+
+template <typename T>
+uint64_t GetSequence(const T& msg) {
+    if constexpr (BridgeHasSequenceStamp<T>::value) {
+        return msg.sequence_frame();
+    } else {
+        return static_cast<uint64_t>(msg.userID());
+    }
+}
+
+std::string TopicName(const std::string& type, const std::string& qos, const char* direction) {
+    return "bench/roundtrip/" + type + "/" + qos + "/" + direction;
+}
+
+/**
+ * @brief pong端：收到ping后原样回发
+ */
+template <typename T>
+class Echo {
+public:
+    bool Init(const std::string& type, BridgeQosPreset preset) {
+        const std::string qos = BridgeQosPresetName(preset);
+        publisher_ = std::make_unique<BridgePublisher<T>>(TopicName(type, qos, "pong"));
+        publisher_->SetQosPreset(preset);
+        if (!publisher_->InitBridge()) {
+            return false;
+        }
+        subscriber_ = std::make_unique<BridgeSubscriber<T>>(TopicName(type, qos, "ping"));
+        subscriber_->SetQosPreset(preset);
+        return subscriber_->InitBridge([this](const T& msg) { publisher_->Write(msg); });
+    }
+
+private:
+    std::unique_ptr<BridgePublisher<T>> publisher_;
+    std::unique_ptr<BridgeSubscriber<T>> subscriber_;
+};
+
+/**
+ * @brief ping端：同步发送并等待回发，记录往返时间
+ */
+template <typename T>
+class Ping {
+public:
+    bool Init(const std::string& type, BridgeQosPreset preset) {
+        const std::string qos = BridgeQosPresetName(preset);
+        publisher_ = std::make_unique<BridgePublisher<T>>(TopicName(type, qos, "ping"));
+        publisher_->SetQosPreset(preset);
+        if (!publisher_->InitBridge()) {
+            return false;
+        }
+        subscriber_ = std::make_unique<BridgeSubscriber<T>>(TopicName(type, qos, "pong"));
+        subscriber_->SetQosPreset(preset);
+        return subscriber_->InitBridge([this](const T& msg) {
+            received_.store(GetSequence(msg), std::memory_order_release);
+        });
+    }
+
+    /**
+     * @brief 发送一次并等待对应序号的回发
+     * @return 往返时间（微秒），超时返回负数
+     */
+    double RoundTrip(uint64_t sequence, std::chrono::nanoseconds timeout) {
+        SetSequence(msg_, sequence);
+        const auto start = std::chrono::steady_clock::now();
+        publisher_->Write(msg_);
+        const auto deadline = start + timeout;
+        while (received_.load(std::memory_order_acquire) != sequence) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return -1.0;
+            }
+            std::this_thread::yield();
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief 等待对端匹配：反复发送直到收到第一条回发
+     */
+    bool WaitForPeer(uint64_t& sequence, std::chrono::seconds timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline && g_running) {
+            if (RoundTrip(++sequence, std::chrono::milliseconds(20)) >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::unique_ptr<BridgePublisher<T>> publisher_;
+    std::unique_ptr<BridgeSubscriber<T>> subscriber_;
+    std::atomic<uint64_t> received_{0};
+    T msg_{};
+};
+
+struct RunConfig {
+    std::string transport;
+    size_t samples = 10000;
+    size_t warmup = 1000;
+    std::chrono::nanoseconds timeout{std::chrono::milliseconds(100)};
+    bench::PerfCounters* perf = nullptr;
+};
+
+template <typename T>
+void RunPing(const RunConfig& config, const std::string& type, BridgeQosPreset preset, bench::ResultTable& table) {
+    Ping<T> ping;
+    if (!ping.Init(type, preset)) {
+        std::fprintf(stderr, "init failed: %s/%s\n", type.c_str(), BridgeQosPresetName(preset));
+        return;
+    }
+    uint64_t sequence = 0;
+    if (!ping.WaitForPeer(sequence, std::chrono::seconds(10))) {
+        std::fprintf(stderr, "no pong for %s/%s\n", type.c_str(), BridgeQosPresetName(preset));
+        return;
+    }
+    for (size_t i = 0; i < config.warmup && g_running; ++i) {
+        ping.RoundTrip(++sequence, config.timeout);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(config.samples);
+    size_t lost = 0;
+    const BridgeAllocCounters allocs_before = BridgeAllocTracker::ProcessCounters();
+    if (config.perf != nullptr) {
+        config.perf->Start();
+    }
+    for (size_t i = 0; i < config.samples && g_running; ++i) {
+        const double rtt = ping.RoundTrip(++sequence, config.timeout);
+        if (rtt < 0) {
+            ++lost;
+        } else {
+            samples.push_back(rtt);
+        }
+    }
+    bench::PerfSample counters;
+    if (config.perf != nullptr) {
+        counters = config.perf->Stop();
+    }
+    const uint64_t allocations = BridgeAllocTracker::ProcessCounters().allocations - allocs_before.allocations;
+
+    const bench::LatencySummary summary = bench::Summarize(samples);
+    table.BeginRow();
+    table.Set("transport", config.transport);
+    table.Set("type", type);
+    table.Set("qos", BridgeQosPresetName(preset));
+    table.Set("payload_bytes", static_cast<double>(BridgeSerializedBytes(T{})));
+    table.Set("samples", static_cast<double>(summary.count));
+    table.Set("lost", static_cast<double>(lost));
+    table.Set("min_us", summary.min);
+    table.Set("mean_us", summary.mean);
+    table.Set("p50_us", summary.p50);
+    table.Set("p90_us", summary.p90);
+    table.Set("p99_us", summary.p99);
+    table.Set("p999_us", summary.p999);
+    table.Set("max_us", summary.max);
+    if (BridgeAllocTracker::HooksInstalled() && summary.count + lost > 0) {
+        table.Set("allocs_per_rtt", static_cast<double>(allocations) / (summary.count + lost));
+    }
+    if (config.perf != nullptr) {
+        bench::PerfCounters::AddColumns(table, counters, static_cast<double>(summary.count + lost));
+    }
+    std::fprintf(stderr, "%-6s %-10s %-9s p50=%.1fus p99=%.1fus lost=%zu\n", config.transport.c_str(),
+                 type.c_str(), BridgeQosPresetName(preset), summary.p50, summary.p99, lost);
+}
+
+template <typename Visitor>
+bool VisitType(const std::string& type, Visitor&& visitor) {
+    if (type == "helloworld") {
+        visitor(HelloWorldData::Msg());
+    } else if (type == "imu") {
+        visitor(ImuData::Imu());
+    } else if (type == "bms") {
+        visitor(BmsData::Bms());
+    } else if (type == "jointcmd") {
+        visitor(JointCommand::JointCmd());
+    } else if (type == "jointstate") {
+        visitor(JointState::JointStateData());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief pong端为所有组合各建一对端点，直到收到SIGINT/SIGTERM
+ */
+int RunPong(const std::vector<std::string>& types, const std::vector<BridgeQosPreset>& presets) {
+    std::vector<std::shared_ptr<void>> echoes;
+    for (const auto& type : types) {
+        for (auto preset : presets) {
+            VisitType(type, [&](auto sample) {
+                using T = decltype(sample);
+                auto echo = std::make_shared<Echo<T>>();
+                if (echo->Init(type, preset)) {
+                    echoes.push_back(echo);
+                }
+            });
+        }
+    }
+    while (g_running) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return 0;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    RunConfig config;
+    config.transport = args.Get("transport", "intra");
+    config.samples = static_cast<size_t>(args.GetInt("samples", 10000));
+    config.warmup = static_cast<size_t>(args.GetInt("warmup", 1000));
+    config.timeout = std::chrono::milliseconds(args.GetInt("timeout-ms", 100));
+    const std::string role = args.Get("role", "both");
+
+    const std::vector<std::string> types = bench::SplitList(args.Get("type", "all"), kAllTypes);
+    std::vector<BridgeQosPreset> presets;
+    for (const auto& name : bench::SplitList(args.Get("qos", "all"), kAllQos)) {
+        BridgeQosPreset preset;
+        if (!BridgeQosPresetFromName(name, preset)) {
+            std::fprintf(stderr, "unknown qos preset: %s\n", name.c_str());
+            return 1;
+        }
+        presets.push_back(preset);
+    }
+    for (const auto& type : types) {
+        if (!VisitType(type, [](auto) {})) {
+            std::fprintf(stderr, "unknown type: %s\n", type.c_str());
+            return 1;
+        }
+    }
+    if (!bench::ConfigureTransport(config.transport)) {
+        std::fprintf(stderr, "unknown transport: %s\n", config.transport.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    // 计数器须在fork和DDS建线程之前打开，子进程和接收线程才会继承
+    bench::PerfCounters perf;
+    if (args.Has("perf") && role != "pong" && perf.Open()) {
+        config.perf = &perf;
+    }
+
+    // 跨进程传输：在初始化DDS之前fork，子进程作为pong
+    pid_t child = -1;
+    if (role == "both" && config.transport != "intra") {
+        child = ::fork();
+        if (child == 0) {
+            BridgeFactory::Instance()->Init(0);
+            return RunPong(types, presets);
+        }
+    }
+
+    BridgeFactory::Instance()->Init(0);
+    if (role == "pong") {
+        return RunPong(types, presets);
+    }
+
+    std::vector<std::shared_ptr<void>> local_echoes;
+    if (role == "both" && config.transport == "intra") {
+        // 进程内：同一参与者上的pong，数据走Cyclone本地投递
+        for (const auto& type : types) {
+            for (auto preset : presets) {
+                VisitType(type, [&](auto sample) {
+                    using T = decltype(sample);
+                    auto echo = std::make_shared<Echo<T>>();
+                    if (echo->Init(type, preset)) {
+                        local_echoes.push_back(echo);
+                    }
+                });
+            }
+        }
+    }
+
+    bench::ResultTable table;
+    for (const auto& type : types) {
+        for (auto preset : presets) {
+            if (!g_running) {
+                break;
+            }
+            VisitType(type, [&](auto sample) { RunPing<decltype(sample)>(config, type, preset, table); });
+        }
+    }
+
+    if (child > 0) {
+        ::kill(child, SIGTERM);
+        ::waitpid(child, nullptr, 0);
+    }
+    return table.Write(args.Get("format", "csv"), args.Get("output", "")) ? 0 : 1;
+}
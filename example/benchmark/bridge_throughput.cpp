@@ -0,0 +1,404 @@
+/**
+ * @file bridge_throughput.cpp
+ * @brief 桥接层吞吐与扩展性基准
+ * @note 在载荷大小 × 发布者数 × 每话题订阅者数 × 话题数的矩阵上，统计持续的msgs/s、MB/s、
+ *       收发两端CPU占用、各核最高利用率以及丢失率。载荷用HelloWorldData::Msg的string字段
+ *       填充到指定字节数（64B~数MB）。udp下订阅端以子进程运行（重新exec自身），
+ *       保证每组配置都在干净的DDS实例上测量。
+ *       含string的类型不是定长类型，Cyclone不会经iceoryx传输，因此不支持shm，共享内存见bench_bridge_roundtrip。
+ *
+ * 用法: bench_bridge_throughput [--transport intra|udp] [--sizes 64,1024,16384,262144,1048576,4194304]
+ *                               [--publishers 1,4] [--subscribers 1,4] [--topics 1,4]
+ *                               [--qos reliable] [--seconds 3] [--rate 0]
+ *                               [--perf] [--format csv|json] [--output 文件]
+ *       --rate为每个发布者的发送频率（Hz），0表示不限速
+ *       --perf附加perf_event_open计数，按收到的每条消息折算（含订阅子进程）
+ */
+#include "bench_common.hpp"
+#include "perf_counters.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_publisher.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_subscriber.hpp"
+#include "yunji/idl/HelloWorldData.hpp"
+
+#include <atomic>
+#include <cctype>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+using namespace yunji::robot;
+
+namespace
+{
+
+using Msg = HelloWorldData::Msg;
+
+std::atomic<bool> g_stop{false};
+
+void OnSignal(int) {
+    g_stop = true;
+}
+
+struct Config {
+    std::string transport = "intra";
+    std::string qos = "reliable";
+    long long size = 64;
+    long long publishers = 1;
+    long long subscribers = 1;     // 每个话题的订阅者数
+    long long topics = 1;
+    double seconds = 3.0;
+    double rate = 0.0;
+    std::string run_id;
+    bench::PerfCounters* perf = nullptr;
+};
+
+std::string TopicName(const Config& config, long long topic) {
+    return "bench/throughput/" + config.run_id + "/" + std::to_string(topic);
+}
+
+/**
+ * @brief 订阅端：每个话题挂subscribers个订阅者，累计收到的消息数和载荷字节数
+ */
+class Sink {
+public:
+    bool Init(const Config& config) {
+        BridgeQosPreset preset = BridgeQosPreset::kReliable;
+        BridgeQosPresetFromName(config.qos, preset);
+        for (long long topic = 0; topic < config.topics; ++topic) {
+            for (long long i = 0; i < config.subscribers; ++i) {
+                auto subscriber = std::make_unique<BridgeSubscriber<Msg>>(TopicName(config, topic));
+                subscriber->SetQosPreset(preset);
+                if (!subscriber->InitBridge([this](const Msg& msg) {
+                        messages_.fetch_add(1, std::memory_order_relaxed);
+                        bytes_.fetch_add(msg.message().size(), std::memory_order_relaxed);
+                    })) {
+                    return false;
+                }
+                subscribers_.push_back(std::move(subscriber));
+            }
+        }
+        return true;
+    }
+
+    uint64_t Messages() const { return messages_.load(std::memory_order_relaxed); }
+    uint64_t Bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<std::unique_ptr<BridgeSubscriber<Msg>>> subscribers_;
+    std::atomic<uint64_t> messages_{0};
+    std::atomic<uint64_t> bytes_{0};
+};
+
+/**
+ * @brief 发布端：每个发布者一个线程，依次分配到各话题，持续发送seconds秒
+ * @return 发送成功的总条数
+ */
+uint64_t RunSources(const Config& config) {
+    BridgeQosPreset preset = BridgeQosPreset::kReliable;
+    BridgeQosPresetFromName(config.qos, preset);
+
+    std::vector<std::unique_ptr<BridgePublisher<Msg>>> publishers;
+    for (long long i = 0; i < config.publishers; ++i) {
+        auto publisher = std::make_unique<BridgePublisher<Msg>>(TopicName(config, i % config.topics));
+        publisher->SetQosPreset(preset);
+        if (!publisher->InitBridge()) {
+            return 0;
+        }
+        publishers.push_back(std::move(publisher));
+    }
+    // 等待发现完成，避免把匹配前发出的消息计为丢失
+    std::this_thread::sleep_for(std::chrono::milliseconds(config.transport == "intra" ? 200 : 1000));
+
+    std::atomic<uint64_t> sent{0};
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (long long i = 0; i < config.publishers; ++i) {
+        threads.emplace_back([&, i]() {
+            Msg msg(static_cast<int32_t>(i), std::string(static_cast<size_t>(config.size), 'x'));
+            const auto period = config.rate > 0 ? std::chrono::nanoseconds(static_cast<int64_t>(1e9 / config.rate))
+                                                : std::chrono::nanoseconds(0);
+            auto next = std::chrono::steady_clock::now();
+            uint64_t count = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (publishers[i]->Write(msg)) {
+                    ++count;
+                }
+                if (period.count() > 0) {
+                    next += period;
+                    std::this_thread::sleep_until(next);
+                }
+            }
+            sent.fetch_add(count, std::memory_order_relaxed);
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(config.seconds));
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return sent.load();
+}
+
+/**
+ * @brief /proc/stat中各核的(忙碌, 总计)时钟滴答
+ */
+std::vector<std::pair<uint64_t, uint64_t>> ReadCoreTicks() {
+    std::vector<std::pair<uint64_t, uint64_t>> cores;
+    std::ifstream stat("/proc/stat");
+    std::string line;
+    while (std::getline(stat, line)) {
+        if (line.compare(0, 3, "cpu") != 0 || line.size() < 4 || !std::isdigit(static_cast<unsigned char>(line[3]))) {
+            continue;
+        }
+        std::istringstream fields(line.substr(line.find(' ')));
+        uint64_t value = 0, total = 0, idle = 0;
+        for (int i = 0; fields >> value; ++i) {
+            total += value;
+            if (i == 3 || i == 4) {     // idle + iowait
+                idle += value;
+            }
+        }
+        cores.emplace_back(total - idle, total);
+    }
+    return cores;
+}
+
+double CpuSeconds(const struct rusage& usage) {
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+/**
+ * @brief 以子进程方式启动订阅端：重新exec自身并传入--role sink
+ */
+pid_t SpawnSink(const Config& config, const char* self, int& read_fd) {
+    int pipe_fds[2];
+    if (::pipe(pipe_fds) != 0) {
+        return -1;
+    }
+    std::vector<std::string> args = {
+        self, "--role", "sink", "--transport", config.transport, "--qos", config.qos,
+        "--sizes", std::to_string(config.size), "--subscribers", std::to_string(config.subscribers),
+        "--topics", std::to_string(config.topics), "--run-id", config.run_id};
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, pipe_fds[0]);
+    pid_t pid = -1;
+    if (posix_spawn(&pid, self, &actions, nullptr, argv.data(), environ) != 0) {
+        pid = -1;
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    ::close(pipe_fds[1]);
+    read_fd = pipe_fds[0];
+    return pid;
+}
+
+bool ReadLine(int fd, std::string& line) {
+    line.clear();
+    char c;
+    while (::read(fd, &c, 1) == 1) {
+        if (c == '\n') {
+            return true;
+        }
+        line += c;
+    }
+    return !line.empty();
+}
+
+/**
+ * @brief 子进程入口：就绪后输出"ready"，收到SIGTERM后输出累计计数
+ */
+int RunSinkProcess(const Config& config) {
+    BridgeFactory::Instance()->Init(0);
+    Sink sink;
+    if (!sink.Init(config)) {
+        return 1;
+    }
+    std::printf("ready\n");
+    std::fflush(stdout);
+    while (!g_stop) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::printf("%llu %llu\n", static_cast<unsigned long long>(sink.Messages()),
+                static_cast<unsigned long long>(sink.Bytes()));
+    std::fflush(stdout);
+    return 0;
+}
+
+void RunConfig(const Config& config, bench::ResultTable& table) {
+    const auto cores_before = ReadCoreTicks();
+    struct rusage self_before;
+    ::getrusage(RUSAGE_SELF, &self_before);
+    const auto wall_start = std::chrono::steady_clock::now();
+    if (config.perf != nullptr) {
+        config.perf->Start();
+    }
+
+    uint64_t sent = 0, received = 0, received_bytes = 0;
+    double sink_cpu = 0.0;
+    if (config.transport == "intra") {
+        Sink sink;
+        if (!sink.Init(config)) {
+            std::fprintf(stderr, "sink init failed\n");
+            return;
+        }
+        sent = RunSources(config);
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));     // 等待在途数据
+        received = sink.Messages();
+        received_bytes = sink.Bytes();
+    } else {
+        int fd = -1;
+        const pid_t child = SpawnSink(config, "/proc/self/exe", fd);
+        std::string line;
+        if (child < 0 || !ReadLine(fd, line) || line != "ready") {
+            std::fprintf(stderr, "sink process failed to start\n");
+            return;
+        }
+        sent = RunSources(config);
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        ::kill(child, SIGTERM);
+        if (ReadLine(fd, line)) {
+            unsigned long long messages = 0, bytes = 0;
+            std::sscanf(line.c_str(), "%llu %llu", &messages, &bytes);
+            received = messages;
+            received_bytes = bytes;
+        }
+        struct rusage child_usage;
+        int status = 0;
+        ::wait4(child, &status, 0, &child_usage);
+        ::close(fd);
+        sink_cpu = CpuSeconds(child_usage);
+    }
+
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    // 子进程已被wait4回收，其继承计数器的值此时已并入本进程
+    bench::PerfSample counters;
+    if (config.perf != nullptr) {
+        counters = config.perf->Stop();
+    }
+    struct rusage self_after;
+    ::getrusage(RUSAGE_SELF, &self_after);
+    const auto cores_after = ReadCoreTicks();
+
+    double max_core = 0.0, mean_core = 0.0;
+    for (size_t i = 0; i < cores_after.size() && i < cores_before.size(); ++i) {
+        const double busy = static_cast<double>(cores_after[i].first - cores_before[i].first);
+        const double total = static_cast<double>(cores_after[i].second - cores_before[i].second);
+        const double usage = total > 0 ? 100.0 * busy / total : 0.0;
+        max_core = std::max(max_core, usage);
+        mean_core += usage / cores_after.size();
+    }
+
+    // 期望收到的条数：每条消息会被其话题上的全部订阅者各收一次
+    const double expected = static_cast<double>(sent) * config.subscribers;
+    const double loss = expected > 0 ? std::max(0.0, 1.0 - received / expected) : 0.0;
+    const double self_cpu = CpuSeconds(self_after) - CpuSeconds(self_before);
+
+    table.BeginRow();
+    table.Set("transport", config.transport);
+    table.Set("qos", config.qos);
+    table.Set("payload_bytes", static_cast<double>(config.size));
+    table.Set("publishers", static_cast<double>(config.publishers));
+    table.Set("subscribers_per_topic", static_cast<double>(config.subscribers));
+    table.Set("topics", static_cast<double>(config.topics));
+    table.Set("sent", static_cast<double>(sent));
+    table.Set("received", static_cast<double>(received));
+    table.Set("send_msgs_per_s", sent / config.seconds);
+    table.Set("recv_msgs_per_s", received / config.seconds);
+    table.Set("recv_mb_per_s", received_bytes / config.seconds / 1e6);
+    table.Set("loss_pct", 100.0 * loss);
+    // CPU占用以单核百分比计，200表示占满两个核；intra下订阅端与发布端同进程，全部计入proc_cpu_pct
+    table.Set("proc_cpu_pct", 100.0 * self_cpu / wall);
+    table.Set("sink_cpu_pct", 100.0 * sink_cpu / wall);
+    table.Set("max_core_pct", max_core);
+    table.Set("mean_core_pct", mean_core);
+    if (config.perf != nullptr) {
+        bench::PerfCounters::AddColumns(table, counters, static_cast<double>(received));
+    }
+    std::fprintf(stderr, "%-5s size=%-8lld pub=%-2lld sub=%-2lld topics=%-2lld  %10.0f msg/s %9.1f MB/s loss=%.2f%%\n",
+                 config.transport.c_str(), config.size, config.publishers, config.subscribers, config.topics,
+                 received / config.seconds, received_bytes / config.seconds / 1e6, 100.0 * loss);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    Config base;
+    base.transport = args.Get("transport", "intra");
+    base.qos = args.Get("qos", "reliable");
+    base.seconds = std::atof(args.Get("seconds", "3").c_str());
+    base.rate = std::atof(args.Get("rate", "0").c_str());
+
+    BridgeQosPreset preset;
+    if (!BridgeQosPresetFromName(base.qos, preset)) {
+        std::fprintf(stderr, "unknown qos preset: %s\n", base.qos.c_str());
+        return 1;
+    }
+    if (base.transport == "shm") {
+        // 变长载荷只会走回环UDP，结果标为shm会误导
+        std::fprintf(stderr, "shm is not supported: string payloads are never sent over iceoryx, use udp\n");
+        return 1;
+    }
+    if (!bench::ConfigureTransport(base.transport)) {
+        std::fprintf(stderr, "unknown transport: %s\n", base.transport.c_str());
+        return 1;
+    }
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    if (args.Get("role", "") == "sink") {
+        base.size = args.GetInt("sizes", 64);
+        base.subscribers = args.GetInt("subscribers", 1);
+        base.topics = args.GetInt("topics", 1);
+        base.run_id = args.Get("run-id", "0");
+        return RunSinkProcess(base);
+    }
+
+    // 在DDS建线程之前打开，接收线程和之后spawn的订阅子进程都会继承计数器
+    bench::PerfCounters perf;
+    if (args.Has("perf") && perf.Open()) {
+        base.perf = &perf;
+    }
+
+    BridgeFactory::Instance()->Init(0);
+    bench::ResultTable table;
+    int run = 0;
+    for (long long size : bench::SplitIntList(args.Get("sizes", "64,1024,16384,262144,1048576,4194304"))) {
+        for (long long publishers : bench::SplitIntList(args.Get("publishers", "1,4"))) {
+            for (long long subscribers : bench::SplitIntList(args.Get("subscribers", "1,4"))) {
+                for (long long topics : bench::SplitIntList(args.Get("topics", "1,4"))) {
+                    // 每个话题至少要有一个发布者，否则其订阅者收不到数据
+                    if (g_stop || topics < 1 || topics > publishers) {
+                        continue;
+                    }
+                    Config config = base;
+                    config.size = size;
+                    config.publishers = publishers;
+                    config.subscribers = subscribers;
+                    config.topics = topics;
+                    config.run_id = std::to_string(::getpid()) + "_" + std::to_string(run++);
+                    RunConfig(config, table);
+                }
+            }
+        }
+    }
+    return table.Write(args.Get("format", "csv"), args.Get("output", "")) ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file callback_dispatch.cpp
+ * @brief 订阅回调分发开销微基准
+ * @note 对比BridgeSubscriber<T>（std::function类型擦除）与BridgeSubscriber<T, Callback>
+ *       （模板可调用类型）每条消息的take与分发开销。两个订阅各用一个话题，样本经Cyclone进程内投递，
+ *       订阅挂在步进模式的执行器上，由基准直接调用Execute()，计时范围即订阅的take与Deliver；
+ *       写入不计时。分别在10kHz以上的定频节拍和无节拍满负荷两种模式下统计。
+ *
+ * 用法: bench_callback_dispatch [消息数] [批大小]
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_publisher.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_subscriber.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace yunji::robot;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+using Publisher = BridgePublisher<JointState::JointStateData>;
+
+/* 回调捕获的用户状态，两种形式都按引用捕获 */
+struct HandlerState {
+    double sum = 0.0;
+    uint64_t count = 0;
+};
+
+struct Result {
+    double mean_ns = 0.0;
+    double p50_ns = 0.0;
+    double p99_ns = 0.0;
+    double max_ns = 0.0;
+};
+
+int64_t ElapsedNs(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+/* 计时本身的开销，用于从单批次测量中扣除 */
+int64_t CalibrateTimerOverhead() {
+    int64_t best = INT64_MAX;
+    for (int i = 0; i < 10000; ++i) {
+        auto t0 = Clock::now();
+        auto t1 = Clock::now();
+        best = std::min(best, ElapsedNs(t0, t1));
+    }
+    return best;
+}
+
+Result Summarize(std::vector<double>& per_msg_ns) {
+    Result r;
+    if (per_msg_ns.empty()) {
+        return r;
+    }
+    std::sort(per_msg_ns.begin(), per_msg_ns.end());
+    double total = 0.0;
+    for (double v : per_msg_ns) {
+        total += v;
+    }
+    r.mean_ns = total / per_msg_ns.size();
+    r.p50_ns = per_msg_ns[per_msg_ns.size() / 2];
+    r.p99_ns = per_msg_ns[per_msg_ns.size() * 99 / 100];
+    r.max_ns = per_msg_ns.back();
+    return r;
+}
+
+/**
+ * @brief 写入一批样本，每条一个实例（id），保证读者历史深度不限制批大小
+ */
+void PublishBatch(Publisher& publisher, std::vector<JointState::JointStateData>& batch) {
+    for (auto& msg : batch) {
+        msg.sequence_frame(msg.sequence_frame() + 1);
+        publisher.Write(msg);
+    }
+}
+
+/**
+ * @brief 以固定频率唤醒，写入一批样本后计时订阅的take与分发，模拟订阅线程在rate_hz下的工作节拍
+ */
+template <typename Subscriber>
+Result RunPaced(Publisher& publisher, Subscriber& subscriber, std::vector<JointState::JointStateData>& batch,
+                size_t num_msgs, double rate_hz, int64_t timer_overhead) {
+    const auto period = std::chrono::nanoseconds(static_cast<int64_t>(1e9 / rate_hz));
+    const size_t rounds = std::max<size_t>(1, num_msgs / batch.size());
+    std::vector<double> per_msg_ns;
+    per_msg_ns.reserve(rounds);
+
+    auto next = Clock::now();
+    for (size_t i = 0; i < rounds; ++i) {
+        next += period;
+        while (Clock::now() < next) {
+            // 忙等到下一节拍，避免睡眠唤醒抖动干扰测量
+        }
+        PublishBatch(publisher, batch);
+        auto t0 = Clock::now();
+        size_t n = subscriber.Execute(0);
+        auto t1 = Clock::now();
+        int64_t ns = std::max<int64_t>(0, ElapsedNs(t0, t1) - timer_overhead);
+        per_msg_ns.push_back(static_cast<double>(ns) / std::max<size_t>(1, n));
+    }
+    return Summarize(per_msg_ns);
+}
+
+/**
+ * @brief 不加节拍连续写入并分发，累计take与分发的耗时，得到满负荷下每条消息的平均开销
+ */
+template <typename Subscriber>
+double RunSaturated(Publisher& publisher, Subscriber& subscriber, std::vector<JointState::JointStateData>& batch,
+                    size_t num_msgs) {
+    const size_t rounds = std::max<size_t>(1, num_msgs / batch.size());
+    size_t total = 0;
+    int64_t elapsed = 0;
+    for (size_t i = 0; i < rounds; ++i) {
+        PublishBatch(publisher, batch);
+        auto t0 = Clock::now();
+        total += subscriber.Execute(0);
+        elapsed += ElapsedNs(t0, Clock::now());
+    }
+    return static_cast<double>(elapsed) / std::max<size_t>(1, total);
+}
+
+/**
+ * @brief 等待进程内读写端匹配
+ */
+bool WaitMatched(const Publisher& publisher) {
+    for (int i = 0; i < 200 && publisher.MatchedSubscribers() == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return publisher.MatchedSubscribers() > 0;
+}
+
+void PrintRow(const char* form, const char* mode, const Result& r) {
+    std::printf("%-16s %-12s %10.1f %10.1f %10.1f %10.1f\n",
+                form, mode, r.mean_ns, r.p50_ns, r.p99_ns, r.max_ns);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const size_t num_msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const size_t batch_size = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+
+    std::vector<JointState::JointStateData> batch(std::max<size_t>(1, batch_size));
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch[i].id(static_cast<int32_t>(i));
+        batch[i].state()[0].q(0.001f * i);
+    }
+
+    BridgeFactory::Instance()->Init(0);
+    BridgeExecutorOptions options;
+    options.mode = BridgeExecutorMode::kStepping;      // 无后台线程，由基准调用Execute()
+    auto executor = std::make_shared<BridgeExecutor>(options);
+
+    HandlerState erased_state;
+    HandlerState inlined_state;
+
+    auto handler = [&inlined_state](const JointState::JointStateData& msg) {
+        inlined_state.sum += msg.state()[0].q();
+        ++inlined_state.count;
+    };
+    BridgeSubscriber<JointState::JointStateData, decltype(handler)> inlined("bench_dispatch_template");
+    inlined.SetQosPreset(BridgeQosPreset::kReliable);
+    inlined.SetExecutor(executor);
+
+    BridgeSubscriber<JointState::JointStateData> erased("bench_dispatch_function");
+    erased.SetQosPreset(BridgeQosPreset::kReliable);
+    erased.SetExecutor(executor);
+
+    Publisher inlined_publisher("bench_dispatch_template");
+    Publisher erased_publisher("bench_dispatch_function");
+    inlined_publisher.SetQosPreset(BridgeQosPreset::kReliable);
+    erased_publisher.SetQosPreset(BridgeQosPreset::kReliable);
+
+    if (!inlined.InitBridge(handler) ||
+        !erased.InitBridge([&erased_state](const JointState::JointStateData& msg) {
+            erased_state.sum += msg.state()[0].q();
+            ++erased_state.count;
+        }) ||
+        !inlined_publisher.InitBridge() || !erased_publisher.InitBridge() ||
+        !WaitMatched(inlined_publisher) || !WaitMatched(erased_publisher)) {
+        std::fprintf(stderr, "endpoint setup failed\n");
+        return 1;
+    }
+
+    const int64_t timer_overhead = CalibrateTimerOverhead();
+    std::printf("messages=%zu batch=%zu timer_overhead=%lldns\n",
+                num_msgs, batch.size(), static_cast<long long>(timer_overhead));
+    std::printf("%-16s %-12s %10s %10s %10s %10s\n",
+                "form", "mode", "mean(ns)", "p50(ns)", "p99(ns)", "max(ns)");
+
+    for (double rate : {10000.0, 20000.0, 50000.0}) {
+        char mode[32];
+        std::snprintf(mode, sizeof(mode), "%.0fHz", rate);
+        const size_t paced_msgs = std::min<size_t>(num_msgs, static_cast<size_t>(rate) * 2);
+        PrintRow("std::function", mode,
+                 RunPaced(erased_publisher, erased, batch, paced_msgs, rate, timer_overhead));
+        PrintRow("template", mode,
+                 RunPaced(inlined_publisher, inlined, batch, paced_msgs, rate, timer_overhead));
+    }
+
+    Result saturated_erased;
+    saturated_erased.mean_ns = RunSaturated(erased_publisher, erased, batch, num_msgs);
+    Result saturated_inlined;
+    saturated_inlined.mean_ns = RunSaturated(inlined_publisher, inlined, batch, num_msgs);
+    std::printf("%-16s %-12s %10.2f\n", "std::function", "saturated", saturated_erased.mean_ns);
+    std::printf("%-16s %-12s %10.2f\n", "template", "saturated", saturated_inlined.mean_ns);
+
+    // 防止编译器把回调整体优化掉；两种形式分发了同样的样本，数值应一致
+    std::printf("checksum=%llu/%llu sum=%.3f/%.3f\n",
+                static_cast<unsigned long long>(erased_state.count),
+                static_cast<unsigned long long>(inlined_state.count),
+                erased_state.sum, inlined_state.sum);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file content_filter.cpp
+ * @brief 内容过滤开销微基准
+ * @note 模拟一个车队的JointStateData流（id轮流取1..fleet），订阅端只要其中一个id，比较每条到达样本的平均耗时：
+ *       decode_all  全部反序列化后在回调里比较id（未设置过滤时的做法）；
+ *       filter_cdr  BridgeReaderFilter在CDR上求值，只有满足条件的样本反序列化（设置过滤后的take路径）。
+ *       另附一个字段条件（timestamp大于阈值）验证两条路径选出的样本一致。不经过DDS传输，
+ *       读者存入历史之前的按实例丢弃不在此测量范围内。
+ *
+ * 用法: bench_content_filter [--samples 200000] [--fleet 1,4,16,64] [--rounds 5] [--format csv|json] [--output 文件]
+ */
+#include "bench_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_filter.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <chrono>
+#include <cmath>
+
+using namespace yunji::robot;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+constexpr int64_t kTargetId = 1;
+constexpr uint64_t kBaseTimestamp = 1700000000000000000ULL;
+
+std::vector<std::vector<uint8_t>> MakeStream(size_t count, long long fleet) {
+    std::vector<std::vector<uint8_t>> buffers(count);
+    JointState::JointStateData msg;
+    for (size_t i = 0; i < count; ++i) {
+        msg.id(static_cast<int32_t>(i % fleet) + 1);
+        msg.sequence_frame(i);
+        msg.timestamp(kBaseTimestamp + i * 1000000ULL);
+        msg.num(12);
+        for (int j = 0; j < 12; ++j) {
+            msg.state()[j].q(static_cast<float>(std::sin(i * 1e-3 + j)));
+        }
+        size_t size = 0;
+        ::get_serialized_size<JointState::JointStateData, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(
+            msg, false, size);
+        buffers[i].resize(size + 4);
+        ::serialize_into<JointState::JointStateData, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(
+            buffers[i].data(), buffers[i].size(), msg, false);
+    }
+    return buffers;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    const size_t count = static_cast<size_t>(std::max(1LL, args.GetInt("samples", 200000)));
+    const int rounds = static_cast<int>(std::max(1LL, args.GetInt("rounds", 5)));
+    const std::vector<long long> fleets = bench::SplitIntList(args.Get("fleet", "1,4,16,64"));
+    const uint64_t threshold = kBaseTimestamp + count * 1000000ULL / 2;
+
+    bench::ResultTable table;
+    for (long long fleet : fleets) {
+        if (fleet <= 0) {
+            continue;
+        }
+        std::vector<std::vector<uint8_t>> buffers = MakeStream(count, fleet);
+
+        BridgeContentFilter condition;
+        condition.KeyIn({kTargetId}).Where("timestamp", BridgeFilterOp::kGt, static_cast<double>(threshold));
+        BridgeReaderFilter filter(condition);
+        if (!filter.Build<JointState::JointStateData>()) {
+            return 1;
+        }
+
+        double decode_all_ns = 0.0;
+        double filter_ns = 0.0;
+        uint64_t decode_all_hits = 0;
+        uint64_t filter_hits = 0;
+        JointState::JointStateData sample;
+        BridgeDynamicView view;
+        for (int round = 0; round < rounds; ++round) {
+            uint64_t hits = 0;
+            auto begin = Clock::now();
+            for (auto& buffer : buffers) {
+                if (::deserialize_sample_from_buffer(buffer.data(), buffer.size(), sample) &&
+                    sample.id() == kTargetId && sample.timestamp() > threshold) {
+                    ++hits;
+                }
+            }
+            double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / count;
+            decode_all_ns = round == 0 ? elapsed : std::min(decode_all_ns, elapsed);
+            decode_all_hits = hits;
+
+            hits = 0;
+            begin = Clock::now();
+            for (auto& buffer : buffers) {
+                if (filter.Accept(view, buffer.data(), buffer.size(), 0) &&
+                    ::deserialize_sample_from_buffer(buffer.data(), buffer.size(), sample)) {
+                    ++hits;
+                }
+            }
+            elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / count;
+            filter_ns = round == 0 ? elapsed : std::min(filter_ns, elapsed);
+            filter_hits = hits;
+        }
+        if (decode_all_hits != filter_hits) {
+            std::fprintf(stderr, "fleet %lld: paths disagree (%llu vs %llu)\n", fleet,
+                         static_cast<unsigned long long>(decode_all_hits), static_cast<unsigned long long>(filter_hits));
+        }
+
+        table.BeginRow();
+        table.Set("fleet", std::to_string(fleet));
+        table.Set("selected", static_cast<double>(filter_hits));
+        table.Set("decode_all_ns", decode_all_ns);
+        table.Set("filter_cdr_ns", filter_ns);
+        table.Set("speedup", decode_all_ns / filter_ns);
+    }
+    return table.Write(args.Get("format", "csv"), args.Get("output", "")) ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file decimation.cpp
+ * @brief 订阅端抽稀开销微基准
+ * @note 模拟1 kHz的单实例流（源时间戳间隔1 ms），比较每条到达样本的平均耗时：
+ *       decode_all  全部反序列化并调用回调（未设置抽稀时的做法）；
+ *       decimated   BridgeDecimator按样本信息先做抽稀，只有选中的样本反序列化并调用回调（设置抽稀后的take路径）。
+ *       抽稀方式为every（keep_every=N）、separation（min_separation=N ms）、window（window=N ms），N取--factor。
+ *       样本包装成只持有CDR缓冲的serdata，不经过DDS传输，不含take本身的开销
+ *
+ * 用法: bench_decimation [--samples 100000] [--factor 1,10,100] [--type imu,jointstate] [--rounds 5]
+ *                        [--format csv|json] [--output 文件]
+ */
+#include "bench_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_decimation.hpp"
+#include "yunji/idl/ImuData.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <dds/ddsi/ddsi_serdata.h>
+
+#include <chrono>
+#include <cmath>
+
+using namespace yunji::robot;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+constexpr int64_t kPeriodNs = 1000000;
+
+/**
+ * @brief 只持有一段CDR数据的serdata，释放时不做任何事，每轮开始前重置引用计数
+ */
+struct BufferSerdata {
+    ddsi_serdata c{};
+    std::vector<uint8_t> data;
+};
+
+uint32_t BufferSize(const ddsi_serdata* d) {
+    return static_cast<uint32_t>(reinterpret_cast<const BufferSerdata*>(d)->data.size());
+}
+
+void BufferToSer(const ddsi_serdata* d, size_t off, size_t sz, void* buf) {
+    std::memcpy(buf, reinterpret_cast<const BufferSerdata*>(d)->data.data() + off, sz);
+}
+
+ddsi_serdata* BufferToSerRef(const ddsi_serdata* d, size_t off, size_t sz, ddsrt_iovec_t* ref) {
+    ref->iov_base = const_cast<uint8_t*>(reinterpret_cast<const BufferSerdata*>(d)->data.data() + off);
+    ref->iov_len = static_cast<ddsrt_iov_len_t>(sz);
+    return ddsi_serdata_ref(d);
+}
+
+void BufferToSerUnref(ddsi_serdata* d, const ddsrt_iovec_t*) {
+    ddsi_serdata_unref(d);
+}
+
+void BufferFree(ddsi_serdata*) {}
+
+const ddsi_serdata_ops& BufferOps() {
+    static const ddsi_serdata_ops ops = []() {
+        ddsi_serdata_ops value{};
+        value.get_size = &BufferSize;
+        value.to_ser = &BufferToSer;
+        value.to_ser_ref = &BufferToSerRef;
+        value.to_ser_unref = &BufferToSerUnref;
+        value.free = &BufferFree;
+        return value;
+    }();
+    return ops;
+}
+
+void Fill(ImuData::Imu& msg, size_t i) {
+    msg.accelerometer({static_cast<float>(std::sin(i * 1e-3)), 0.0f, 9.8f});
+    msg.gyroscope({0.0f, static_cast<float>(std::cos(i * 1e-3)), 0.0f});
+}
+
+void Fill(JointState::JointStateData& msg, size_t i) {
+    msg.num(12);
+    for (int j = 0; j < 12; ++j) {
+        msg.state()[j].q(static_cast<float>(std::sin(i * 1e-3 + j)));
+    }
+}
+
+template <typename T>
+std::vector<BufferSerdata> MakeStream(size_t count) {
+    std::vector<BufferSerdata> stream(count);
+    T msg;
+    msg.id(1);
+    for (size_t i = 0; i < count; ++i) {
+        msg.sequence_frame(i);
+        msg.timestamp(i * kPeriodNs);
+        Fill(msg, i);
+        size_t size = 0;
+        ::get_serialized_size<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(msg, false, size);
+        stream[i].data.resize(size + 4);
+        ::serialize_into<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(
+            stream[i].data.data(), stream[i].data.size(), msg, false);
+        stream[i].c.ops = &BufferOps();
+    }
+    return stream;
+}
+
+void ResetReferences(std::vector<BufferSerdata>& stream) {
+    for (auto& entry : stream) {
+        ddsrt_atomic_st32(&entry.c.refc, 1);
+    }
+}
+
+dds_sample_info_t InfoOf(size_t i) {
+    dds_sample_info_t info{};
+    info.valid_data = true;
+    info.instance_handle = 1;
+    info.source_timestamp = static_cast<dds_time_t>(i * kPeriodNs);
+    return info;
+}
+
+template <typename T>
+bool Decode(ddsi_serdata* serdata, T& sample) {
+    ddsrt_iovec_t ref{};
+    ddsi_serdata* held = ddsi_serdata_to_ser_ref(serdata, 0, ddsi_serdata_size(serdata), &ref);
+    const bool ok = ::deserialize_sample_from_buffer(ref.iov_base, ref.iov_len, sample);
+    ddsi_serdata_to_ser_unref(held, &ref);
+    return ok;
+}
+
+BridgeDecimationOptions OptionsFor(const std::string& mode, long long factor) {
+    BridgeDecimationOptions options;
+    if (mode == "every") {
+        options.keep_every = static_cast<uint32_t>(factor);
+    } else if (mode == "separation") {
+        options.min_separation = std::chrono::nanoseconds(factor * kPeriodNs);
+    } else {
+        options.window = std::chrono::nanoseconds(factor * kPeriodNs);
+    }
+    return options;
+}
+
+template <typename T>
+void Run(const std::string& type_name, size_t count, int rounds, const std::vector<long long>& factors,
+         bench::ResultTable& table) {
+    std::vector<BufferSerdata> stream = MakeStream<T>(count);
+    T sample;
+    uint64_t checksum = 0;
+    auto callback = [&checksum](const T& data) { checksum += data.sequence_frame(); };
+
+    double decode_all_ns = 0.0;
+    for (int round = 0; round < rounds; ++round) {
+        ResetReferences(stream);
+        const auto begin = Clock::now();
+        for (auto& entry : stream) {
+            if (Decode(&entry.c, sample)) {
+                callback(sample);
+            }
+            ddsi_serdata_unref(&entry.c);
+        }
+        const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / count;
+        decode_all_ns = round == 0 ? elapsed : std::min(decode_all_ns, elapsed);
+    }
+
+    for (const std::string mode : {"every", "separation", "window"}) {
+        for (long long factor : factors) {
+            if (factor <= 0) {
+                continue;
+            }
+            double decimated_ns = 0.0;
+            uint64_t delivered = 0;
+            for (int round = 0; round < rounds; ++round) {
+                BridgeDecimator decimator(OptionsFor(mode, factor));
+                ResetReferences(stream);
+                delivered = 0;
+                const auto begin = Clock::now();
+                for (size_t i = 0; i < count; ++i) {
+                    dds_sample_info_t info = InfoOf(i);
+                    ddsi_serdata* selected = decimator.Offer(&stream[i].c, info);
+                    if (selected == nullptr) {
+                        continue;
+                    }
+                    if (Decode(selected, sample)) {
+                        callback(sample);
+                        ++delivered;
+                    }
+                    ddsi_serdata_unref(selected);
+                }
+                const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / count;
+                decimated_ns = round == 0 ? elapsed : std::min(decimated_ns, elapsed);
+            }
+
+            table.BeginRow();
+            table.Set("type", type_name);
+            table.Set("mode", mode);
+            table.Set("factor", std::to_string(factor));
+            table.Set("delivered", static_cast<double>(delivered));
+            table.Set("decode_all_ns", decode_all_ns);
+            table.Set("decimated_ns", decimated_ns);
+            table.Set("speedup", decode_all_ns / decimated_ns);
+        }
+    }
+    if (checksum == 0) {
+        std::fprintf(stderr, "%s: no sample delivered\n", type_name.c_str());
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    const size_t count = static_cast<size_t>(std::max(1LL, args.GetInt("samples", 100000)));
+    const int rounds = static_cast<int>(std::max(1LL, args.GetInt("rounds", 5)));
+    const std::vector<long long> factors = bench::SplitIntList(args.Get("factor", "1,10,100"));
+
+    bench::ResultTable table;
+    for (const std::string& type : bench::SplitList(args.Get("type", "imu,jointstate"), {"imu", "jointstate"})) {
+        if (type == "imu") {
+            Run<ImuData::Imu>(type, count, rounds, factors, table);
+        } else if (type == "jointstate") {
+            Run<JointState::JointStateData>(type, count, rounds, factors, table);
+        }
+    }
+    return table.Write(args.Get("format", "csv"), args.Get("output", "")) ? 0 : 1;
+}
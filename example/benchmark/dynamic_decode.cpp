@@ -0,0 +1,244 @@
+/**
+ * @file dynamic_decode.cpp
+ * @brief 动态类型解析开销微基准
+ * @note 对同一批CDR样本比较三种取值方式每条样本的耗时：
+ *       static   ddscxx反序列化为生成的C++类型后读取字段（BridgeSubscriber<T>的路径）；
+ *       view     BridgeDynamicView按预先算好的字段偏移直接读取（BridgeDynamicSubscriber的路径）；
+ *       decode   BridgeDynamicLayout::Decode解析出全部字段值（导出工具的路径）。
+ *       每种方式读取相同的字段（帧序号、时间戳和关节位置，或userID与字符串长度）并累加，防止被优化掉。
+ *       不经过DDS传输。
+ *
+ * 用法: bench_dynamic_decode [--samples 100000] [--rounds 5] [--types joint_state,imu,hello]
+ *                            [--format csv|json] [--output 文件]
+ */
+#include "bench_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_type.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+#include "yunji/idl/HelloWorldData.hpp"
+#include "yunji/idl/ImuData.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+
+using namespace yunji::robot;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+constexpr int kActiveJoints = 12;
+
+struct Samples {
+    std::vector<std::vector<uint8_t>> buffers;
+    BridgeDynamicLayout layout;
+};
+
+template <typename T>
+bool Prepare(size_t count, const std::function<void(size_t, T&)>& fill, Samples& samples) {
+    const BridgeTypeDescriptor descriptor = BridgeTypeDescriptorOf<T>();
+    BridgeDynamicTypePtr type;
+    if (!BridgeParseTypeMap(descriptor.type_map, descriptor.type_name, type) || !samples.layout.Build(type)) {
+        return false;
+    }
+    samples.buffers.resize(count);
+    T msg;
+    for (size_t i = 0; i < count; ++i) {
+        fill(i, msg);
+        size_t size = 0;
+        if (!::get_serialized_size<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(msg, false, size)) {
+            return false;
+        }
+        samples.buffers[i].resize(size + 4);
+        if (!::serialize_into<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(
+                samples.buffers[i].data(), samples.buffers[i].size(), msg, false)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 多轮取最快一轮，返回每条样本的纳秒数
+ */
+double Measure(const Samples& samples, int rounds, const std::function<double(const std::vector<uint8_t>&)>& read,
+               double& checksum) {
+    double best = 0.0;
+    for (int round = 0; round < rounds; ++round) {
+        double sum = 0.0;
+        const auto begin = Clock::now();
+        for (const auto& buffer : samples.buffers) {
+            sum += read(buffer);
+        }
+        const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+        const double per_sample = elapsed / samples.buffers.size();
+        best = round == 0 ? per_sample : std::min(best, per_sample);
+        checksum = sum;
+    }
+    return best;
+}
+
+struct Result {
+    double static_ns = 0.0;
+    double view_ns = 0.0;
+    double decode_ns = 0.0;
+    bool consistent = false;
+};
+
+template <typename T>
+double StaticRead(const std::vector<uint8_t>& buffer, T& msg, const std::function<double(const T&)>& fields) {
+    if (!::deserialize_sample_from_buffer(const_cast<uint8_t*>(buffer.data()), buffer.size(), msg)) {
+        return 0.0;
+    }
+    return fields(msg);
+}
+
+template <typename T>
+bool Run(const Samples& samples, int rounds, const std::vector<int>& indices,
+         const std::function<double(const T&)>& fields, Result& result) {
+    T msg;
+    double static_sum = 0.0;
+    double view_sum = 0.0;
+    double decode_sum = 0.0;
+    result.static_ns = Measure(samples, rounds, [&](const std::vector<uint8_t>& buffer) {
+        return StaticRead<T>(buffer, msg, fields);
+    }, static_sum);
+
+    BridgeDynamicView view;
+    const BridgeDynamicLayout& layout = samples.layout;
+    result.view_ns = Measure(samples, rounds, [&](const std::vector<uint8_t>& buffer) {
+        if (!view.Bind(layout, buffer.data(), buffer.size())) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (int index : indices) {
+            sum += layout.Fields()[index].kind == BridgeDynamicKind::kString ? view.Length(index)
+                                                                               : view.Double(index);
+        }
+        return sum;
+    }, view_sum);
+
+    std::vector<BridgeDynamicValue> values;
+    result.decode_ns = Measure(samples, rounds, [&](const std::vector<uint8_t>& buffer) {
+        if (!layout.Decode(buffer.data(), buffer.size(), values)) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (int index : indices) {
+            const BridgeDynamicField& field = layout.Fields()[index];
+            switch (field.kind) {
+            case BridgeDynamicKind::kString:
+                sum += values[index].text.size();
+                break;
+            case BridgeDynamicKind::kFloat32:
+            case BridgeDynamicKind::kFloat64:
+                sum += values[index].f;
+                break;
+            case BridgeDynamicKind::kUint32:
+            case BridgeDynamicKind::kUint64:
+                sum += static_cast<double>(values[index].u);
+                break;
+            default:
+                sum += static_cast<double>(values[index].i);
+                break;
+            }
+        }
+        return sum;
+    }, decode_sum);
+
+    const double tolerance = 1e-9 * std::max(1.0, std::fabs(static_sum));
+    result.consistent = std::fabs(static_sum - view_sum) <= tolerance && std::fabs(static_sum - decode_sum) <= tolerance;
+    return true;
+}
+
+std::vector<int> Indices(const BridgeDynamicLayout& layout, const std::vector<std::string>& paths) {
+    std::vector<int> indices;
+    for (const auto& path : paths) {
+        indices.push_back(layout.FindField(path));
+    }
+    return indices;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    const size_t count = static_cast<size_t>(std::max(1LL, args.GetInt("samples", 100000)));
+    const int rounds = static_cast<int>(std::max(1LL, args.GetInt("rounds", 5)));
+    const std::vector<std::string> types = bench::SplitList(args.Get("types", "all"), {"joint_state", "imu", "hello"});
+
+    bench::ResultTable table;
+    for (const auto& type : types) {
+        Samples samples;
+        Result result;
+        bool ok = false;
+        if (type == "joint_state") {
+            ok = Prepare<JointState::JointStateData>(count, [](size_t i, JointState::JointStateData& msg) {
+                msg.id(1);
+                msg.sequence_frame(i);
+                msg.timestamp(1700000000000000000ULL + i * 1000000ULL);
+                msg.num(kActiveJoints);
+                for (int j = 0; j < kActiveJoints; ++j) {
+                    msg.state()[j].q(static_cast<float>(std::sin(i * 1e-3 + j)));
+                }
+            }, samples);
+            std::vector<std::string> paths = {"sequence_frame", "timestamp"};
+            for (int j = 0; j < kActiveJoints; ++j) {
+                paths.push_back("state[" + std::to_string(j) + "].q");
+            }
+            ok = ok && Run<JointState::JointStateData>(samples, rounds, Indices(samples.layout, paths),
+                [](const JointState::JointStateData& msg) {
+                    double sum = static_cast<double>(msg.sequence_frame()) + static_cast<double>(msg.timestamp());
+                    for (int j = 0; j < kActiveJoints; ++j) {
+                        sum += msg.state()[j].q();
+                    }
+                    return sum;
+                }, result);
+        } else if (type == "imu") {
+            ok = Prepare<ImuData::Imu>(count, [](size_t i, ImuData::Imu& msg) {
+                msg.id(1);
+                msg.sequence_frame(i);
+                msg.timestamp(1700000000000000000ULL + i * 1000000ULL);
+                msg.gyroscope({0.01f, 0.02f, static_cast<float>(std::sin(i * 1e-3))});
+                msg.quaternion({1.0f, 0.0f, 0.0f, 0.0f});
+            }, samples);
+            ok = ok && Run<ImuData::Imu>(samples, rounds,
+                Indices(samples.layout, {"timestamp", "gyroscope[0]", "gyroscope[1]", "gyroscope[2]", "quaternion[0]"}),
+                [](const ImuData::Imu& msg) {
+                    return static_cast<double>(msg.timestamp()) + msg.gyroscope()[0] + msg.gyroscope()[1] +
+                           msg.gyroscope()[2] + msg.quaternion()[0];
+                }, result);
+        } else if (type == "hello") {
+            ok = Prepare<HelloWorldData::Msg>(count, [](size_t i, HelloWorldData::Msg& msg) {
+                msg.userID(static_cast<int32_t>(i));
+                msg.message("Hello World " + std::to_string(i));
+            }, samples);
+            ok = ok && Run<HelloWorldData::Msg>(samples, rounds, Indices(samples.layout, {"userID", "message"}),
+                [](const HelloWorldData::Msg& msg) {
+                    return static_cast<double>(msg.userID()) + static_cast<double>(msg.message().size());
+                }, result);
+        } else {
+            std::fprintf(stderr, "unknown type %s\n", type.c_str());
+            return 1;
+        }
+        if (!ok) {
+            std::fprintf(stderr, "%s: serialization or type_map unavailable\n", type.c_str());
+            return 1;
+        }
+        if (!result.consistent) {
+            std::fprintf(stderr, "%s: decoded values differ between paths\n", type.c_str());
+        }
+        table.BeginRow();
+        table.Set("type", type);
+        table.Set("payload_bytes", static_cast<double>(samples.buffers[0].size()));
+        table.Set("fixed", samples.layout.IsFixed() ? 1.0 : 0.0);
+        table.Set("static_ns", result.static_ns);
+        table.Set("view_ns", result.view_ns);
+        table.Set("decode_ns", result.decode_ns);
+        table.Set("view_vs_static", result.view_ns / result.static_ns);
+    }
+    return table.Write(args.Get("format", "csv"), args.Get("output", "")) ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+#ifndef __YJ_ROBOT_SDK_BENCH_PERF_COUNTERS_HPP__
+#define __YJ_ROBOT_SDK_BENCH_PERF_COUNTERS_HPP__
+
+/**
+ * @file perf_counters.hpp
+ * @brief 基于perf_event_open的硬件/软件性能计数器，用于基准测量区间
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "bench_common.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+namespace bench
+{
+
+/**
+ * @brief 一次测量区间的计数增量，不可用的计数器为负数
+ */
+struct PerfSample {
+    static constexpr size_t kCount = 6;
+    std::array<double, kCount> values{};
+};
+
+/**
+ * @class PerfCounters
+ * @brief 周期、指令、cache/L1D/分支未命中和上下文切换计数
+ * @note 各计数器独立打开（不分组），被复用时按time_enabled/time_running缩放。
+ *       inherit打开时计入之后创建的线程和fork/exec出的子进程，因此应在BridgeFactory::Init()
+ *       之前调用Open()，DDS接收线程和pong/订阅子进程的开销都会计入。
+ *       硬件计数器只统计用户态，需要perf_event_paranoid <= 2；上下文切换只在内核态记录，
+ *       需要perf_event_paranoid <= 1或CAP_PERFMON，否则不输出该列。
+ */
+class PerfCounters {
+public:
+    enum Index : size_t {
+        kCycles = 0,
+        kInstructions,
+        kCacheMisses,
+        kL1dMisses,
+        kBranchMisses,
+        kContextSwitches
+    };
+
+    PerfCounters() { fds_.fill(-1); }
+
+    ~PerfCounters() {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    static const char* Name(size_t index) {
+        static const char* const kNames[PerfSample::kCount] = {
+            "cycles", "instructions", "cache_misses", "l1d_misses", "branch_misses", "context_switches"};
+        return kNames[index];
+    }
+
+    /**
+     * @brief 打开计数器
+     * @return 至少一个计数器可用时返回true
+     */
+    bool Open(bool inherit = true) {
+        const uint64_t l1d_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        // 上下文切换发生在内核态，排除内核时恒为0，需单独统计内核态
+        const struct {
+            uint32_t type;
+            uint64_t config;
+            bool kernel;
+        } events[PerfSample::kCount] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, false},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, false},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, false},
+            {PERF_TYPE_HW_CACHE, l1d_miss, false},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, false},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, true},
+        };
+
+        bool any = false;
+        for (size_t i = 0; i < PerfSample::kCount; ++i) {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events[i].type;
+            attr.config = events[i].config;
+            attr.inherit = inherit ? 1 : 0;
+            attr.exclude_kernel = events[i].kernel ? 0 : 1;     // 普通用户在paranoid=2时只能统计用户态
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fds_[i] < 0 && events[i].kernel) {
+                std::fprintf(stderr, "perf counter %s needs perf_event_paranoid <= 1 or CAP_PERFMON, omitted\n",
+                             Name(i));
+            }
+            any = any || fds_[i] >= 0;
+        }
+        if (!any) {
+            std::fprintf(stderr, "perf_event_open unavailable (check /proc/sys/kernel/perf_event_paranoid)\n");
+        }
+        return any;
+    }
+
+    bool Available() const {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 记录区间起点
+     */
+    void Start() { start_ = ReadAll(); }
+
+    /**
+     * @brief 区间终点，返回起点以来的增量
+     */
+    PerfSample Stop() const {
+        const PerfSample end = ReadAll();
+        PerfSample delta;
+        for (size_t i = 0; i < PerfSample::kCount; ++i) {
+            delta.values[i] = (end.values[i] < 0 || start_.values[i] < 0) ? -1.0 : end.values[i] - start_.values[i];
+        }
+        return delta;
+    }
+
+    /**
+     * @brief 将增量按消息数折算后写入结果表（列名如cycles_per_msg），并附IPC
+     */
+    static void AddColumns(ResultTable& table, const PerfSample& sample, double messages) {
+        if (messages <= 0) {
+            return;
+        }
+        for (size_t i = 0; i < PerfSample::kCount; ++i) {
+            if (sample.values[i] >= 0) {
+                table.Set(std::string(Name(i)) + "_per_msg", sample.values[i] / messages);
+            }
+        }
+        if (sample.values[kCycles] > 0 && sample.values[kInstructions] >= 0) {
+            table.Set("ipc", sample.values[kInstructions] / sample.values[kCycles]);
+        }
+    }
+
+private:
+    PerfSample ReadAll() const {
+        PerfSample sample;
+        for (size_t i = 0; i < PerfSample::kCount; ++i) {
+            sample.values[i] = -1.0;
+            if (fds_[i] < 0) {
+                continue;
+            }
+            uint64_t data[3] = {0, 0, 0};      // value, time_enabled, time_running
+            if (::read(fds_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+                continue;
+            }
+            // 计数器被复用时按实际运行时间比例放大
+            sample.values[i] = data[2] > 0 ? static_cast<double>(data[0]) * data[1] / data[2] : 0.0;
+        }
+        return sample;
+    }
+
+    std::array<int, PerfSample::kCount> fds_;
+    PerfSample start_;
+};
+
+}
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BENCH_PERF_COUNTERS_HPP__
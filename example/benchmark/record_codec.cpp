@@ -0,0 +1,293 @@
+/**
+ * @file record_codec.cpp
+ * @brief 录制样本增量/量化编码基准
+ * @note 以1kHz控制回路的典型数据（关节状态、关节指令、IMU，正弦运动叠加传感器噪声）生成样本流，
+ *       经ddscxx序列化为XCDR1后交给BridgeDeltaCodec，统计按分段文件记录格式（32字节记录头、8字节对齐）
+ *       折算的压缩比、单核编码/解码吞吐，并校验无损模式逐字节一致、量化模式误差不超过步长一半。
+ *       不经过DDS传输。
+ *
+ * 用法: bench_record_codec [--samples 100000] [--keyframe 100] [--steps 0,0.0001,0.001]
+ *                          [--types joint_state,joint_cmd,imu] [--format csv|json] [--output 文件]
+ *       --keyframe为关键帧间隔（对应录制时索引项间隔内的样本数）
+ */
+#include "bench_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_record_codec.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+#include "yunji/idl/ImuData.hpp"
+#include "yunji/idl/JointCommand.hpp"
+#include "yunji/idl/JointState.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <random>
+
+using namespace yunji::robot;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr int kActiveJoints = 12;
+constexpr uint64_t kPeriodNs = 1000000;     // 1kHz
+
+struct Stream {
+    std::string type_name;
+    std::vector<uint8_t> type_map;
+    std::vector<std::vector<uint8_t>> samples;
+    std::vector<std::pair<size_t, size_t>> floats;      // 需校验量化误差的float区间（相对数据起点）
+};
+
+template <typename T>
+bool Serialize(const T& msg, std::vector<uint8_t>& out) {
+    size_t size = 0;
+    if (!::get_serialized_size<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(msg, false, size)) {
+        return false;
+    }
+    out.resize(size + 4);
+    return ::serialize_into<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(out.data(), out.size(), msg,
+                                                                                       false);
+}
+
+template <typename T>
+Stream MakeStream(size_t samples, const std::function<void(size_t, T&)>& fill) {
+    const BridgeTypeDescriptor descriptor = BridgeTypeDescriptorOf<T>();
+    Stream stream;
+    stream.type_name = descriptor.type_name;
+    stream.type_map = descriptor.type_map;
+    stream.samples.resize(samples);
+    T msg;
+    for (size_t i = 0; i < samples; ++i) {
+        fill(i, msg);
+        if (!Serialize(msg, stream.samples[i])) {
+            stream.samples.clear();
+            break;
+        }
+    }
+    return stream;
+}
+
+/**
+ * @brief 时间戳带±10us抖动，各关节相位不同的0.8Hz步态运动
+ */
+Stream JointStateStream(size_t samples, std::mt19937& rng) {
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::uniform_int_distribution<uint64_t> jitter(0, 20000);
+    Stream stream = MakeStream<JointState::JointStateData>(samples, [&](size_t i, JointState::JointStateData& msg) {
+        const double t = i * 1e-3;
+        msg.id(1);
+        msg.sequence_frame(i);
+        msg.timestamp(1700000000000000000ULL + i * kPeriodNs + jitter(rng));
+        msg.num(kActiveJoints);
+        for (int j = 0; j < kActiveJoints; ++j) {
+            const double phase = 2 * kPi * 0.8 * t + j;
+            auto& state = msg.state()[j];
+            state.q(static_cast<float>(0.5 * std::sin(phase)) + 1e-4f * noise(rng));
+            state.dq(static_cast<float>(0.5 * 2 * kPi * 0.8 * std::cos(phase)) + 1e-2f * noise(rng));
+            state.tau_est(static_cast<float>(5.0 * std::sin(phase + 0.3)) + 0.05f * noise(rng));
+            state.temp(40.0f + static_cast<float>(i / 5000) * 0.5f);
+        }
+    });
+    stream.floats.emplace_back(28, 28 + 16 * 16);
+    return stream;
+}
+
+/**
+ * @brief 位置/速度/力矩指令随步态变化，kp/kd为常量
+ */
+Stream JointCmdStream(size_t samples, std::mt19937& rng) {
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    Stream stream = MakeStream<JointCommand::JointCmd>(samples, [&](size_t i, JointCommand::JointCmd& msg) {
+        const double t = i * 1e-3;
+        msg.id(1);
+        msg.sequence_frame(i);
+        msg.timestamp(1700000000000000000ULL + i * kPeriodNs);
+        msg.num(kActiveJoints);
+        for (int j = 0; j < kActiveJoints; ++j) {
+            const double phase = 2 * kPi * 0.8 * t + j;
+            auto& cmd = msg.cmd()[j];
+            cmd.q(static_cast<float>(0.5 * std::sin(phase)));
+            cmd.dq(static_cast<float>(0.5 * 2 * kPi * 0.8 * std::cos(phase)));
+            cmd.tau(static_cast<float>(5.0 * std::sin(phase + 0.3)) + 0.05f * noise(rng));
+            cmd.kp(20.0f);
+            cmd.kd(0.5f);
+        }
+    });
+    stream.floats.emplace_back(28, 28 + 16 * 20);
+    return stream;
+}
+
+/**
+ * @brief 重力加速度叠加噪声，机体绕z轴缓慢转动
+ */
+Stream ImuStream(size_t samples, std::mt19937& rng) {
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::uniform_int_distribution<uint64_t> jitter(0, 20000);
+    Stream stream = MakeStream<ImuData::Imu>(samples, [&](size_t i, ImuData::Imu& msg) {
+        const double t = i * 1e-3;
+        msg.id(1);
+        msg.sequence_frame(i);
+        msg.timestamp(1700000000000000000ULL + i * kPeriodNs + jitter(rng));
+        msg.accelerometer({0.05f * noise(rng), 0.05f * noise(rng), 9.81f + 0.05f * noise(rng)});
+        msg.gyroscope({2e-3f * noise(rng), 2e-3f * noise(rng), 0.2f + 2e-3f * noise(rng)});
+        const double yaw = 0.2 * t;
+        msg.quaternion({static_cast<float>(std::cos(yaw / 2)), 0.0f, 0.0f, static_cast<float>(std::sin(yaw / 2))});
+    });
+    stream.floats.emplace_back(24, 24 + 10 * 4);
+    return stream;
+}
+
+size_t RecordSize(size_t payload) {
+    return (sizeof(BridgeRecordHeader) + payload + 7) & ~size_t(7);
+}
+
+struct Result {
+    double ratio = 0.0;
+    double stored_avg = 0.0;
+    double keyframes = 0.0;
+    double encode_mbps = 0.0;
+    double encode_msps = 0.0;
+    double decode_mbps = 0.0;
+    double max_error = 0.0;
+    size_t mismatches = 0;
+};
+
+bool Run(const Stream& stream, double step, size_t keyframe, Result& result) {
+    BridgeDeltaCodec encoder;
+    BridgeDeltaCodec decoder;
+    if (!encoder.Init(stream.type_map, stream.type_name, step) ||
+        !decoder.Init(stream.type_map, stream.type_name, step)) {
+        return false;
+    }
+    const size_t count = stream.samples.size();
+    const size_t max_encoded = encoder.MaxEncodedSize();
+    std::vector<uint8_t> encoded(count * max_encoded);
+    std::vector<size_t> sizes(count);
+
+    auto begin = Clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        const auto& sample = stream.samples[i];
+        sizes[i] = encoder.Encode(sample.data(), sample.size(), keyframe > 0 && i % keyframe == 0,
+                                  encoded.data() + i * max_encoded);
+    }
+    const double encode_s = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    // 解码计时不含校验
+    std::vector<uint8_t> decoded(count * stream.samples[0].size());
+    begin = Clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        const auto& sample = stream.samples[i];
+        if (sizes[i] == 0) {
+            decoder.SetBase(sample.data(), sample.size());
+        } else if (!decoder.Decode(encoded.data() + i * max_encoded, sizes[i])) {
+            decoder.Reset();
+            continue;
+        }
+        std::memcpy(decoded.data() + i * sample.size(), decoder.Base().data(), sample.size());
+    }
+    const double decode_s = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    size_t raw_bytes = 0;
+    size_t raw_records = 0;
+    size_t stored_records = 0;
+    size_t keyframes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const auto& sample = stream.samples[i];
+        const uint8_t* rebuilt = decoded.data() + i * sample.size();
+        raw_bytes += sample.size();
+        raw_records += RecordSize(sample.size());
+        stored_records += RecordSize(sizes[i] == 0 ? sample.size() : sizes[i]);
+        keyframes += sizes[i] == 0;
+        if (step <= 0.0) {
+            result.mismatches += std::memcmp(rebuilt, sample.data(), sample.size()) != 0;
+            continue;
+        }
+        for (const auto& range : stream.floats) {
+            for (size_t offset = range.first; offset < range.second; offset += sizeof(float)) {
+                float expected;
+                float actual;
+                std::memcpy(&expected, sample.data() + 4 + offset, sizeof(float));
+                std::memcpy(&actual, rebuilt + 4 + offset, sizeof(float));
+                result.max_error = std::max(result.max_error, static_cast<double>(std::fabs(expected - actual)));
+            }
+        }
+        // 非浮点部分（封装头、键、帧序号、时间戳）必须无损
+        result.mismatches += std::memcmp(rebuilt, sample.data(), 4 + stream.floats.front().first) != 0;
+    }
+    result.ratio = static_cast<double>(raw_records) / stored_records;
+    result.stored_avg = static_cast<double>(stored_records) / count;
+    result.keyframes = static_cast<double>(keyframes) / count;
+    result.encode_mbps = raw_bytes / encode_s / 1e6;
+    result.encode_msps = count / encode_s / 1e6;
+    result.decode_mbps = raw_bytes / decode_s / 1e6;
+    // 量化误差上界为步长一半，另加float舍入
+    if (step > 0.0 && result.max_error > step * 0.5 * (1 + 1e-3) + 1e-6) {
+        ++result.mismatches;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Args args(argc, argv);
+    const size_t samples = static_cast<size_t>(std::max(1LL, args.GetInt("samples", 100000)));
+    const size_t keyframe = static_cast<size_t>(args.GetInt("keyframe", 100));
+    const std::vector<std::string> steps = bench::SplitList(args.Get("steps", "0,0.0001,0.001"), {});
+    const std::vector<std::string> types =
+        bench::SplitList(args.Get("types", "all"), {"joint_state", "joint_cmd", "imu"});
+
+    bench::ResultTable table;
+    std::mt19937 rng(1);
+    int status = 0;
+    for (const auto& type : types) {
+        Stream stream;
+        if (type == "joint_state") {
+            stream = JointStateStream(samples, rng);
+        } else if (type == "joint_cmd") {
+            stream = JointCmdStream(samples, rng);
+        } else if (type == "imu") {
+            stream = ImuStream(samples, rng);
+        } else {
+            std::fprintf(stderr, "unknown type %s\n", type.c_str());
+            return 1;
+        }
+        if (stream.samples.empty() || stream.type_map.empty()) {
+            std::fprintf(stderr, "%s: serialization or type_map unavailable\n", type.c_str());
+            return 1;
+        }
+        for (const auto& step_text : steps) {
+            const double step = std::atof(step_text.c_str());
+            Result result;
+            if (!Run(stream, step, keyframe, result)) {
+                std::fprintf(stderr, "%s: type is not fixed-size\n", type.c_str());
+                return 1;
+            }
+            if (result.mismatches != 0) {
+                std::fprintf(stderr, "%s step %g: %zu samples failed round-trip check\n", type.c_str(), step,
+                             result.mismatches);
+                status = 1;
+            }
+            table.BeginRow();
+            table.Set("type", type);
+            table.Set("step", step_text);
+            table.Set("payload_bytes", static_cast<double>(stream.samples[0].size()));
+            table.Set("stored_bytes_avg", result.stored_avg);
+            table.Set("ratio", result.ratio);
+            table.Set("keyframe_share", result.keyframes);
+            table.Set("encode_mb_s", result.encode_mbps);
+            table.Set("encode_msamples_s", result.encode_msps);
+            table.Set("decode_mb_s", result.decode_mbps);
+            table.Set("max_error_steps", step > 0.0 ? result.max_error / step : 0.0);
+            table.Set("mismatches", static_cast<double>(result.mismatches));
+        }
+    }
+    if (!table.Write(args.Get("format", "csv"), args.Get("output", ""))) {
+        return 1;
+    }
+    return status;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file timer_jitter.cpp
+ * @brief 执行器定时器抖动基准
+ * @note 以指定频率运行BridgeExecutor定时器，分别统计纯睡眠唤醒与带忙等尾部两种配置的
+ *       触发抖动和超限次数，用于评估500Hz~2kHz关节指令发布的定时质量。
+ *       建议以实时优先级运行（需CAP_SYS_NICE），否则抖动主要来自调度延迟。
+ *
+ * 用法: bench_timer_jitter [频率Hz] [持续秒数] [忙等尾部us] [SCHED_FIFO优先级]
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace yunji::robot;
+
+namespace
+{
+
+void PrintStats(const char* name, const BridgeTimerStats& stats) {
+    std::printf("%-12s fired=%-8llu overruns=%-6llu jitter(us) min=%-8.1f max=%-8.1f mean|j|=%-8.2f max_cb=%.1fus\n",
+                name,
+                static_cast<unsigned long long>(stats.fired),
+                static_cast<unsigned long long>(stats.overruns),
+                stats.min_jitter_ns / 1e3, stats.max_jitter_ns / 1e3,
+                stats.mean_abs_jitter_ns / 1e3, stats.max_callback_ns / 1e3);
+}
+
+BridgeTimerStats Run(double rate_hz, double seconds, int64_t tail_us, int priority) {
+    BridgeExecutorOptions options;
+    options.num_threads = 1;
+    options.timer_thread_priority = priority;
+    BridgeExecutor executor(options);
+
+    BridgeTimerOptions timer_options;
+    timer_options.busy_wait_tail = std::chrono::microseconds(tail_us);
+
+    volatile uint64_t ticks = 0;
+    auto timer = executor.CreateTimer(
+        std::chrono::nanoseconds(static_cast<int64_t>(1e9 / rate_hz)),
+        [&ticks]() { ticks = ticks + 1; },
+        timer_options);
+
+    executor.Start();
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    timer->Cancel();
+    executor.Stop();
+    return timer->Stats();
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const double rate_hz = argc > 1 ? std::atof(argv[1]) : 1000.0;
+    const double seconds = argc > 2 ? std::atof(argv[2]) : 5.0;
+    const int64_t tail_us = argc > 3 ? std::atoll(argv[3]) : 50;
+    const int priority = argc > 4 ? std::atoi(argv[4]) : 0;
+
+    std::printf("rate=%.0fHz duration=%.1fs busy_wait_tail=%lldus priority=%d\n",
+                rate_hz, seconds, static_cast<long long>(tail_us), priority);
+    PrintStats("sleep-only", Run(rate_hz, seconds, 0, priority));
+    PrintStats("busy-tail", Run(rate_hz, seconds, tail_us, priority));
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "yunji/robot/dds_bridge/dds_bridge_publisher.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
 #include "yunji/idl/HelloWorldData.hpp"
 
 #define TOPIC "TopicHelloWorld"
@@ -12,12 +13,18 @@ int main()
 
     publisher.InitBridge();
 
-    while (true)
-    {
+    // 用执行器定时器按绝对时刻定频发布，替代sleep循环，长期运行不漂移
+    auto executor = std::make_shared<BridgeExecutor>();
+    auto timer = executor->CreateTimer(std::chrono::seconds(1), [&publisher]() {
         HelloWorldData::Msg msg(0, "HelloWorld.");
         publisher.Write(msg);
-        sleep(1);
+    });
+    executor->Start();
+
+    while (true)
+    {
+        sleep(10);
     }
 
     return 0;
-}
\ No newline at end of file
+}
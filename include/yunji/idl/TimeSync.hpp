@@ -0,0 +1,475 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to CXX Translator
+  File name: TimeSync.idl
+  Source: TimeSync.hpp
+  Cyclone DDS: v0.10.4
+
+*****************************************************************/
+#ifndef DDSCXX_TIMESYNC_HPP
+#define DDSCXX_TIMESYNC_HPP
+
+#include <cstdint>
+#include <array>
+
+namespace TimeSync
+{
+class Ping
+{
+private:
+ int32_t id_ = 0;
+ uint64_t sequence_frame_ = 0;
+ uint64_t timestamp_ = 0;
+ uint64_t receive_time_ = 0;
+ uint64_t transmit_time_ = 0;
+ std::array<uint8_t, 16> responder_ = { };
+
+public:
+  Ping() = default;
+
+  explicit Ping(
+    int32_t id,
+    uint64_t sequence_frame,
+    uint64_t timestamp,
+    uint64_t receive_time,
+    uint64_t transmit_time,
+    const std::array<uint8_t, 16>& responder) :
+    id_(id),
+    sequence_frame_(sequence_frame),
+    timestamp_(timestamp),
+    receive_time_(receive_time),
+    transmit_time_(transmit_time),
+    responder_(responder) { }
+
+  int32_t id() const { return this->id_; }
+  int32_t& id() { return this->id_; }
+  void id(int32_t _val_) { this->id_ = _val_; }
+  uint64_t sequence_frame() const { return this->sequence_frame_; }
+  uint64_t& sequence_frame() { return this->sequence_frame_; }
+  void sequence_frame(uint64_t _val_) { this->sequence_frame_ = _val_; }
+  uint64_t timestamp() const { return this->timestamp_; }
+  uint64_t& timestamp() { return this->timestamp_; }
+  void timestamp(uint64_t _val_) { this->timestamp_ = _val_; }
+  uint64_t receive_time() const { return this->receive_time_; }
+  uint64_t& receive_time() { return this->receive_time_; }
+  void receive_time(uint64_t _val_) { this->receive_time_ = _val_; }
+  uint64_t transmit_time() const { return this->transmit_time_; }
+  uint64_t& transmit_time() { return this->transmit_time_; }
+  void transmit_time(uint64_t _val_) { this->transmit_time_ = _val_; }
+  const std::array<uint8_t, 16>& responder() const { return this->responder_; }
+  std::array<uint8_t, 16>& responder() { return this->responder_; }
+  void responder(const std::array<uint8_t, 16>& _val_) { this->responder_ = _val_; }
+  void responder(std::array<uint8_t, 16>&& _val_) { this->responder_ = _val_; }
+
+  bool operator==(const Ping& _other) const
+  {
+    (void) _other;
+    return id_ == _other.id_ &&
+      sequence_frame_ == _other.sequence_frame_ &&
+      timestamp_ == _other.timestamp_ &&
+      receive_time_ == _other.receive_time_ &&
+      transmit_time_ == _other.transmit_time_ &&
+      responder_ == _other.responder_;
+  }
+
+  bool operator!=(const Ping& _other) const
+  {
+    return !(*this == _other);
+  }
+
+};
+
+}
+
+#include "dds/topic/TopicTraits.hpp"
+#include "org/eclipse/cyclonedds/topic/datatopic.hpp"
+
+namespace org {
+namespace eclipse {
+namespace cyclonedds {
+namespace topic {
+
+template <> constexpr const char* TopicTraits<::TimeSync::Ping>::getTypeName()
+{
+  return "TimeSync::Ping";
+}
+
+#ifdef DDSCXX_HAS_TYPE_DISCOVERY
+template<> constexpr unsigned int TopicTraits<::TimeSync::Ping>::type_map_blob_sz() { return 454; }
+template<> constexpr unsigned int TopicTraits<::TimeSync::Ping>::type_info_blob_sz() { return 100; }
+template<> inline const uint8_t * TopicTraits<::TimeSync::Ping>::type_map_blob() {
+  static const uint8_t blob[] = {
+ 0x96,  0x00,  0x00,  0x00,  0x01,  0x00,  0x00,  0x00,  0xf1,  0x4c,  0x12,  0x57,  0x2e,  0x41,  0x4f,  0xf6, 
+ 0xdb,  0xeb,  0x99,  0x64,  0x61,  0xf8,  0x65,  0x00,  0x7e,  0x00,  0x00,  0x00,  0xf1,  0x51,  0x01,  0x00, 
+ 0x01,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x6e,  0x00,  0x00,  0x00,  0x06,  0x00,  0x00,  0x00, 
+ 0x0b,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x31,  0x00,  0x04,  0xb8,  0x0b,  0xb7,  0x74,  0x00, 
+ 0x0b,  0x00,  0x00,  0x00,  0x01,  0x00,  0x00,  0x00,  0x01,  0x00,  0x08,  0xef,  0xd2,  0x68,  0xec,  0x00, 
+ 0x0b,  0x00,  0x00,  0x00,  0x02,  0x00,  0x00,  0x00,  0x01,  0x00,  0x08,  0xd7,  0xe6,  0xd5,  0x5b,  0x00, 
+ 0x0b,  0x00,  0x00,  0x00,  0x03,  0x00,  0x00,  0x00,  0x01,  0x00,  0x08,  0xed,  0xa8,  0x07,  0xf3,  0x00, 
+ 0x0b,  0x00,  0x00,  0x00,  0x04,  0x00,  0x00,  0x00,  0x01,  0x00,  0x08,  0x08,  0x86,  0x9a,  0xf0,  0x00, 
+ 0x16,  0x00,  0x00,  0x00,  0x05,  0x00,  0x00,  0x00,  0x01,  0x00,  0x90,  0xf3,  0x01,  0x00,  0x00,  0x00, 
+ 0x01,  0x00,  0x00,  0x00,  0x10,  0x02,  0x62,  0x95,  0x47,  0x44,  0x00,  0x00,  0x00,  0x01,  0x00,  0x00, 
+ 0x01,  0x00,  0x00,  0x00,  0xf2,  0xa5,  0x3d,  0xfa,  0x2b,  0x22,  0x5c,  0x9c,  0xab,  0x3a,  0x47,  0xc2, 
+ 0xf7,  0x2a,  0x68,  0x00,  0xe8,  0x00,  0x00,  0x00,  0xf2,  0x51,  0x01,  0x00,  0x17,  0x00,  0x00,  0x00, 
+ 0x00,  0x00,  0x00,  0x00,  0x0f,  0x00,  0x00,  0x00,  0x54,  0x69,  0x6d,  0x65,  0x53,  0x79,  0x6e,  0x63, 
+ 0x3a,  0x3a,  0x50,  0x69,  0x6e,  0x67,  0x00,  0x00,  0xc4,  0x00,  0x00,  0x00,  0x06,  0x00,  0x00,  0x00, 
+ 0x11,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x31,  0x00,  0x04,  0x00,  0x03,  0x00,  0x00,  0x00, 
+ 0x69,  0x64,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x1d,  0x00,  0x00,  0x00,  0x01,  0x00,  0x00,  0x00, 
+ 0x01,  0x00,  0x08,  0x00,  0x0f,  0x00,  0x00,  0x00,  0x73,  0x65,  0x71,  0x75,  0x65,  0x6e,  0x63,  0x65, 
+ 0x5f,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x18,  0x00,  0x00,  0x00, 
+ 0x02,  0x00,  0x00,  0x00,  0x01,  0x00,  0x08,  0x00,  0x0a,  0x00,  0x00,  0x00,  0x74,  0x69,  0x6d,  0x65, 
+ 0x73,  0x74,  0x61,  0x6d,  0x70,  0x00,  0x00,  0x00,  0x1b,  0x00,  0x00,  0x00,  0x03,  0x00,  0x00,  0x00, 
+ 0x01,  0x00,  0x08,  0x00,  0x0d,  0x00,  0x00,  0x00,  0x72,  0x65,  0x63,  0x65,  0x69,  0x76,  0x65,  0x5f, 
+ 0x74,  0x69,  0x6d,  0x65,  0x00,  0x00,  0x00,  0x00,  0x1c,  0x00,  0x00,  0x00,  0x04,  0x00,  0x00,  0x00, 
+ 0x01,  0x00,  0x08,  0x00,  0x0e,  0x00,  0x00,  0x00,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x6d,  0x69,  0x74, 
+ 0x5f,  0x74,  0x69,  0x6d,  0x65,  0x00,  0x00,  0x00,  0x24,  0x00,  0x00,  0x00,  0x05,  0x00,  0x00,  0x00, 
+ 0x01,  0x00,  0x90,  0xf3,  0x01,  0x00,  0x00,  0x00,  0x01,  0x00,  0x00,  0x00,  0x10,  0x02,  0x00,  0x00, 
+ 0x0a,  0x00,  0x00,  0x00,  0x72,  0x65,  0x73,  0x70,  0x6f,  0x6e,  0x64,  0x65,  0x72,  0x00,  0x00,  0x00, 
+ 0x22,  0x00,  0x00,  0x00,  0x01,  0x00,  0x00,  0x00,  0xf2,  0xa5,  0x3d,  0xfa,  0x2b,  0x22,  0x5c,  0x9c, 
+ 0xab,  0x3a,  0x47,  0xc2,  0xf7,  0x2a,  0x68,  0xf1,  0x4c,  0x12,  0x57,  0x2e,  0x41,  0x4f,  0xf6,  0xdb, 
+ 0xeb,  0x99,  0x64,  0x61,  0xf8,  0x65, };
+  return blob;
+}
+template<> inline const uint8_t * TopicTraits<::TimeSync::Ping>::type_info_blob() {
+  static const uint8_t blob[] = {
+ 0x60,  0x00,  0x00,  0x00,  0x01,  0x10,  0x00,  0x40,  0x28,  0x00,  0x00,  0x00,  0x24,  0x00,  0x00,  0x00, 
+ 0x14,  0x00,  0x00,  0x00,  0xf1,  0x4c,  0x12,  0x57,  0x2e,  0x41,  0x4f,  0xf6,  0xdb,  0xeb,  0x99,  0x64, 
+ 0x61,  0xf8,  0x65,  0x00,  0x82,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x04,  0x00,  0x00,  0x00, 
+ 0x00,  0x00,  0x00,  0x00,  0x02,  0x10,  0x00,  0x40,  0x28,  0x00,  0x00,  0x00,  0x24,  0x00,  0x00,  0x00, 
+ 0x14,  0x00,  0x00,  0x00,  0xf2,  0xa5,  0x3d,  0xfa,  0x2b,  0x22,  0x5c,  0x9c,  0xab,  0x3a,  0x47,  0xc2, 
+ 0xf7,  0x2a,  0x68,  0x00,  0xec,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x04,  0x00,  0x00,  0x00, 
+ 0x00,  0x00,  0x00,  0x00, };
+  return blob;
+}
+#endif //DDSCXX_HAS_TYPE_DISCOVERY
+
+} //namespace topic
+} //namespace cyclonedds
+} //namespace eclipse
+} //namespace org
+
+namespace dds {
+namespace topic {
+
+template <>
+struct topic_type_name<::TimeSync::Ping>
+{
+    static std::string value()
+    {
+      return org::eclipse::cyclonedds::topic::TopicTraits<::TimeSync::Ping>::getTypeName();
+    }
+};
+
+}
+}
+
+REGISTER_TOPIC_TYPE(::TimeSync::Ping)
+
+namespace org{
+namespace eclipse{
+namespace cyclonedds{
+namespace core{
+namespace cdr{
+
+template<>
+propvec &get_type_props<::TimeSync::Ping>();
+
+template<typename T, std::enable_if_t<std::is_base_of<cdr_stream, T>::value, bool> = true >
+bool write(T& streamer, const ::TimeSync::Ping& instance, entity_properties_t *props) {
+  (void)instance;
+  if (!streamer.start_struct(*props))
+    return false;
+  auto prop = streamer.first_entity(props);
+  while (prop) {
+    switch (prop->m_id) {
+      case 0:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!write(streamer, instance.id()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 1:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!write(streamer, instance.sequence_frame()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 2:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!write(streamer, instance.timestamp()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 3:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!write(streamer, instance.receive_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 4:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!write(streamer, instance.transmit_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 5:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!streamer.start_consecutive(true, true))
+        return false;
+      if (!write(streamer, instance.responder()[0], instance.responder().size()))
+        return false;
+      if (!streamer.finish_consecutive())
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+    }
+    prop = streamer.next_entity(prop);
+  }
+  return streamer.finish_struct(*props);
+}
+
+template<typename S, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true >
+bool write(S& str, const ::TimeSync::Ping& instance, bool as_key) {
+  auto &props = get_type_props<::TimeSync::Ping>();
+  str.set_mode(cdr_stream::stream_mode::write, as_key);
+  return write(str, instance, props.data()); 
+}
+
+template<typename T, std::enable_if_t<std::is_base_of<cdr_stream, T>::value, bool> = true >
+bool read(T& streamer, ::TimeSync::Ping& instance, entity_properties_t *props) {
+  (void)instance;
+  if (!streamer.start_struct(*props))
+    return false;
+  auto prop = streamer.first_entity(props);
+  while (prop) {
+    switch (prop->m_id) {
+      case 0:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!read(streamer, instance.id()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 1:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!read(streamer, instance.sequence_frame()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 2:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!read(streamer, instance.timestamp()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 3:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!read(streamer, instance.receive_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 4:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!read(streamer, instance.transmit_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 5:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!streamer.start_consecutive(true, true))
+        return false;
+      if (!read(streamer, instance.responder()[0], instance.responder().size()))
+        return false;
+      if (!streamer.finish_consecutive())
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+    }
+    prop = streamer.next_entity(prop);
+  }
+  return streamer.finish_struct(*props);
+}
+
+template<typename S, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true >
+bool read(S& str, ::TimeSync::Ping& instance, bool as_key) {
+  auto &props = get_type_props<::TimeSync::Ping>();
+  str.set_mode(cdr_stream::stream_mode::read, as_key);
+  return read(str, instance, props.data()); 
+}
+
+template<typename T, std::enable_if_t<std::is_base_of<cdr_stream, T>::value, bool> = true >
+bool move(T& streamer, const ::TimeSync::Ping& instance, entity_properties_t *props) {
+  (void)instance;
+  if (!streamer.start_struct(*props))
+    return false;
+  auto prop = streamer.first_entity(props);
+  while (prop) {
+    switch (prop->m_id) {
+      case 0:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!move(streamer, instance.id()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 1:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!move(streamer, instance.sequence_frame()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 2:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!move(streamer, instance.timestamp()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 3:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!move(streamer, instance.receive_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 4:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!move(streamer, instance.transmit_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 5:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!streamer.start_consecutive(true, true))
+        return false;
+      if (!move(streamer, instance.responder()[0], instance.responder().size()))
+        return false;
+      if (!streamer.finish_consecutive())
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+    }
+    prop = streamer.next_entity(prop);
+  }
+  return streamer.finish_struct(*props);
+}
+
+template<typename S, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true >
+bool move(S& str, const ::TimeSync::Ping& instance, bool as_key) {
+  auto &props = get_type_props<::TimeSync::Ping>();
+  str.set_mode(cdr_stream::stream_mode::move, as_key);
+  return move(str, instance, props.data()); 
+}
+
+template<typename T, std::enable_if_t<std::is_base_of<cdr_stream, T>::value, bool> = true >
+bool max(T& streamer, const ::TimeSync::Ping& instance, entity_properties_t *props) {
+  (void)instance;
+  if (!streamer.start_struct(*props))
+    return false;
+  auto prop = streamer.first_entity(props);
+  while (prop) {
+    switch (prop->m_id) {
+      case 0:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!max(streamer, instance.id()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 1:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!max(streamer, instance.sequence_frame()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 2:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!max(streamer, instance.timestamp()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 3:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!max(streamer, instance.receive_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 4:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!max(streamer, instance.transmit_time()))
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+      case 5:
+      if (!streamer.start_member(*prop))
+        return false;
+      if (!streamer.start_consecutive(true, true))
+        return false;
+      if (!max(streamer, instance.responder()[0], instance.responder().size()))
+        return false;
+      if (!streamer.finish_consecutive())
+        return false;
+      if (!streamer.finish_member(*prop))
+        return false;
+      break;
+    }
+    prop = streamer.next_entity(prop);
+  }
+  return streamer.finish_struct(*props);
+}
+
+template<typename S, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true >
+bool max(S& str, const ::TimeSync::Ping& instance, bool as_key) {
+  auto &props = get_type_props<::TimeSync::Ping>();
+  str.set_mode(cdr_stream::stream_mode::max, as_key);
+  return max(str, instance, props.data()); 
+}
+
+} //namespace cdr
+} //namespace core
+} //namespace cyclonedds
+} //namespace eclipse
+} //namespace org
+
+#endif // DDSCXX_TIMESYNC_HPP
@@ -0,0 +1,119 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_ALLOC_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_ALLOC_HPP__
+
+/**
+ * @file bridge_alloc.hpp
+ * @brief 堆分配计数与实时线程分配检查
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 实时线程上发生堆分配时的处理方式
+ */
+enum class BridgeAllocStrictMode : uint8_t {
+    kOff,           // 不检查
+    kCount,         // 只计数，见BridgeAllocTracker::RealtimeViolations()
+    kReport,        // 计数并向stderr打印大小和调用栈
+    kAbort          // 打印后abort()，用于CI中证明初始化之后控制路径没有分配
+};
+
+/**
+ * @brief 分配计数
+ */
+struct BridgeAllocCounters {
+    uint64_t allocations = 0;       // malloc/calloc/realloc/memalign等调用次数
+    uint64_t frees = 0;             // 非空free次数
+    uint64_t bytes = 0;             // 累计申请字节数
+};
+
+/**
+ * @class BridgeAllocTracker
+ * @brief 按线程和进程统计堆分配
+ * @note 计数由分配钩子（yunji_alloc_hooks，替换malloc族函数）驱动，基准和测试程序链接钩子后生效；
+ *       未链接钩子时所有计数恒为0，HooksInstalled()返回false。
+ *       发布者/订阅者用ThreadAllocations()的差值统计每条消息的分配次数，见BridgeTopicMetrics。
+ */
+class BridgeAllocTracker {
+public:
+    /**
+     * @brief 分配钩子是否已链接进当前程序
+     */
+    static bool HooksInstalled();
+
+    /**
+     * @brief 当前线程的分配次数，只读线程局部变量，可在热路径上调用
+     */
+    static uint64_t ThreadAllocations();
+
+    static BridgeAllocCounters ThreadCounters();
+    static BridgeAllocCounters ProcessCounters();
+
+    /**
+     * @brief 将当前线程标记为实时线程（或取消标记），严格模式下该线程上的任何分配都会被记录
+     */
+    static void MarkRealtimeThread(bool realtime = true);
+    static bool IsRealtimeThread();
+
+    static void SetStrictMode(BridgeAllocStrictMode mode);
+    static BridgeAllocStrictMode StrictMode();
+
+    /**
+     * @brief 严格模式下实时线程上发生的分配次数
+     */
+    static uint64_t RealtimeViolations();
+
+    /**
+     * @brief 由分配钩子调用，不得分配内存
+     */
+    static void OnAllocate(size_t size);
+    static void OnFree();
+    static void SetHooksInstalled();
+};
+
+/**
+ * @class BridgeAllocScope
+ * @brief 统计作用域内当前线程的分配次数
+ */
+class BridgeAllocScope {
+public:
+    BridgeAllocScope() : start_(BridgeAllocTracker::ThreadCounters()) {}
+
+    uint64_t Allocations() const { return BridgeAllocTracker::ThreadCounters().allocations - start_.allocations; }
+    uint64_t Bytes() const { return BridgeAllocTracker::ThreadCounters().bytes - start_.bytes; }
+
+private:
+    BridgeAllocCounters start_;
+};
+
+/**
+ * @class BridgeRealtimeThreadScope
+ * @brief 作用域内将当前线程标记为实时线程，退出时恢复原标记
+ */
+class BridgeRealtimeThreadScope {
+public:
+    BridgeRealtimeThreadScope() : previous_(BridgeAllocTracker::IsRealtimeThread()) {
+        BridgeAllocTracker::MarkRealtimeThread(true);
+    }
+
+    ~BridgeRealtimeThreadScope() { BridgeAllocTracker::MarkRealtimeThread(previous_); }
+
+    BridgeRealtimeThreadScope(const BridgeRealtimeThreadScope&) = delete;
+    BridgeRealtimeThreadScope& operator=(const BridgeRealtimeThreadScope&) = delete;
+
+private:
+    bool previous_;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_ALLOC_HPP__
@@ -0,0 +1,82 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_CLOCK_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_CLOCK_HPP__
+
+/**
+ * @file bridge_clock.hpp
+ * @brief 桥接层时钟源，支持系统时间与仿真时间切换
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <atomic>
+#include <cstdint>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @class BridgeClock
+ * @brief 桥接层统一时钟，定时器与发布时间戳都从这里取时间
+ * @note 默认使用系统时钟；切换到仿真时间后时间只随Advance()/Set()推进，
+ *       配合步进执行器可以快于实时且确定性地运行整套程序
+ */
+class BridgeClock {
+
+public:
+
+    static BridgeClock* Instance() {
+
+        static BridgeClock instance;
+
+        return &instance;
+    }
+
+    /**
+     * @brief 单调时间（纳秒），用于定时器和时长测量
+     * @note 系统时间模式下为CLOCK_MONOTONIC，仿真模式下为仿真时间
+     */
+    int64_t Now() const;
+
+    /**
+     * @brief 墙上时间（纳秒，Unix纪元），用于DDS源时间戳和消息timestamp字段
+     * @note 系统时间模式下为CLOCK_REALTIME，仿真模式下为仿真时间
+     */
+    int64_t WallTime() const;
+
+    /**
+     * @brief 切换到仿真时间
+     * @param start_ns 仿真起始时间（纳秒）
+     */
+    void UseSimulatedTime(int64_t start_ns = 0);
+
+    /**
+     * @brief 切换回系统时间
+     */
+    void UseSystemTime();
+
+    bool IsSimulated() const { return simulated_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 推进仿真时间，系统时间模式下无效
+     */
+    void Advance(int64_t delta_ns);
+
+    /**
+     * @brief 设置仿真时间（不允许回退），系统时间模式下无效
+     */
+    void Set(int64_t time_ns);
+
+private:
+
+    BridgeClock() = default;
+
+    std::atomic<bool> simulated_{false};
+    std::atomic<int64_t> sim_time_ns_{0};
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_CLOCK_HPP__
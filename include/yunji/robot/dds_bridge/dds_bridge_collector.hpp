@@ -0,0 +1,170 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_COLLECTOR_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_COLLECTOR_HPP__
+
+/**
+ * @file bridge_collector.hpp
+ * @brief 桥接层统计的周期采集器与共享内存导出
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_metrics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+constexpr uint32_t kBridgeMetricsShmMagic = 0x594A4D53;    // "YJMS"
+constexpr uint32_t kBridgeMetricsShmVersion = 1;
+constexpr size_t kBridgeMetricsShmMaxTopics = 128;
+constexpr size_t kBridgeMetricsShmMaxDdsStats = 16;
+constexpr size_t kBridgeMetricsShmNameSize = 64;
+
+/**
+ * @brief 共享内存中的单个Cyclone统计项
+ */
+struct BridgeShmDdsStatistic {
+    char name[32];
+    uint64_t value;
+    double rate;
+};
+
+/**
+ * @brief 共享内存中的单个端点统计，直方图只导出分位数
+ */
+struct BridgeShmTopicMetrics {
+    char topic[kBridgeMetricsShmNameSize];
+    char type[kBridgeMetricsShmNameSize];
+    uint32_t kind;                  // BridgeEndpointKind
+    uint32_t dds_stat_count;
+    uint64_t messages;
+    uint64_t bytes;
+    double message_rate;
+    double byte_rate;
+    uint64_t latency_p50_ns;        // 发布者为write()耗时，订阅者为源时间戳到回调的延迟
+    uint64_t latency_p99_ns;
+    uint64_t latency_p999_ns;
+    uint64_t latency_max_ns;
+    uint64_t callback_p99_ns;       // 仅订阅者
+    uint64_t callback_max_ns;
+    BridgeShmDdsStatistic dds_stats[kBridgeMetricsShmMaxDdsStats];
+};
+
+/**
+ * @brief 共享内存区域布局（固定大小、纯POD，读写双方按同一头文件编译）
+ * @note 写者用seqlock发布：sequence为奇数表示正在写，读者读取前后序号一致且为偶数才算有效
+ */
+struct BridgeShmMetricsRegion {
+    uint32_t magic;
+    uint32_t version;
+    std::atomic<uint64_t> sequence;
+    int64_t time_ns;                // 采集时刻（写者进程的单调时钟）
+    uint32_t pid;                   // 写者进程号
+    uint32_t topic_count;
+    BridgeShmTopicMetrics topics[kBridgeMetricsShmMaxTopics];
+};
+
+/**
+ * @brief 采集器配置
+ */
+struct BridgeMetricsCollectorOptions {
+    std::chrono::milliseconds period{1000};     // 采集周期
+    std::string shm_name;                       // 共享内存名（如"/yj_bridge_metrics"），为空则不导出
+};
+
+/**
+ * @class BridgeMetricsCollector
+ * @brief 周期调用BridgeFactory::Metrics()（含各端点的dds_statistics），缓存最新快照并可导出到共享内存
+ * @note 采集在独立的低频线程上进行，不影响收发路径；监控进程通过BridgeMetricsShmReader
+ *       直接读取共享内存，无需任何IPC调用
+ */
+class BridgeMetricsCollector {
+public:
+    explicit BridgeMetricsCollector(const BridgeMetricsCollectorOptions& options = BridgeMetricsCollectorOptions());
+    ~BridgeMetricsCollector();
+
+    BridgeMetricsCollector(const BridgeMetricsCollector&) = delete;
+    BridgeMetricsCollector& operator=(const BridgeMetricsCollector&) = delete;
+
+    /**
+     * @brief 启动采集线程，创建共享内存失败时返回false
+     */
+    bool Start();
+
+    /**
+     * @brief 停止采集线程并删除共享内存
+     */
+    void Stop();
+
+    /**
+     * @brief 立即采集一次（不依赖采集线程，也可用于步进/测试场景）
+     */
+    void CollectOnce();
+
+    /**
+     * @brief 最近一次采集的快照
+     */
+    BridgeMetricsSnapshot Latest() const;
+
+private:
+    void Run();
+    bool OpenShm();
+    void CloseShm();
+    void WriteShm(const BridgeMetricsSnapshot& snapshot);
+
+    BridgeMetricsCollectorOptions options_;
+
+    mutable std::mutex mutex_;
+    std::mutex collect_mutex_;          // 串行化采集与共享内存写入（seqlock只允许单写者）
+    std::condition_variable cv_;
+    bool running_ = false;
+    std::thread thread_;
+    BridgeMetricsSnapshot latest_;
+
+    BridgeShmMetricsRegion* region_ = nullptr;
+};
+
+/**
+ * @class BridgeMetricsShmReader
+ * @brief 监控进程侧读取共享内存统计
+ */
+class BridgeMetricsShmReader {
+public:
+    BridgeMetricsShmReader() = default;
+    ~BridgeMetricsShmReader();
+
+    BridgeMetricsShmReader(const BridgeMetricsShmReader&) = delete;
+    BridgeMetricsShmReader& operator=(const BridgeMetricsShmReader&) = delete;
+
+    /**
+     * @brief 以只读方式映射共享内存
+     * @param shm_name 与写者一致的共享内存名
+     */
+    bool Open(const std::string& shm_name);
+
+    void Close();
+
+    /**
+     * @brief 读取一份一致的拷贝
+     * @param out 输出，可复用以避免重复分配
+     * @param max_retries 写者正在更新时的最大重试次数
+     * @return 写者尚未写入、格式不匹配或重试耗尽时返回false
+     */
+    bool Read(BridgeShmMetricsRegion& out, int max_retries = 100) const;
+
+private:
+    const BridgeShmMetricsRegion* region_ = nullptr;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_COLLECTOR_HPP__
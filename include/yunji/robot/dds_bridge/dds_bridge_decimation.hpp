@@ -0,0 +1,96 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_DECIMATION_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_DECIMATION_HPP__
+
+/**
+ * @file bridge_decimation.hpp
+ * @brief 订阅端抽稀：按时间间隔、每N个取一个、每个时间窗口取最新
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "dds/dds.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+struct ddsi_serdata;
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 抽稀配置，各项均按实例（key）独立计算，可组合使用，依次为keep_every、min_separation、window
+ */
+struct BridgeDecimationOptions {
+    std::chrono::nanoseconds min_separation{0};     // 同一实例两次分发的最小源时间戳间隔，同时设为读者的TimeBasedFilter
+    uint32_t keep_every = 1;                        // 每N个样本保留第1个，1为不抽稀
+    std::chrono::nanoseconds window{0};             // 按源时间戳分窗口，每个窗口只分发最后一个样本
+
+    bool Enabled() const { return min_separation.count() > 0 || keep_every > 1 || window.count() > 0; }
+};
+
+/**
+ * @brief 抽稀统计
+ */
+struct BridgeDecimationStats {
+    uint64_t delivered = 0;             // 通过抽稀、交给反序列化与分发的样本数
+    uint64_t dropped_every = 0;         // 被keep_every丢弃的样本数
+    uint64_t dropped_separation = 0;    // 距上次分发不足min_separation而丢弃的样本数
+    uint64_t dropped_window = 0;        // 同一窗口内被更新样本替换的样本数
+};
+
+/**
+ * @class BridgeDecimator
+ * @brief 一个读者的抽稀状态，在序列化样本上按样本信息决定去留，被丢弃的样本不反序列化
+ * @note window模式不依赖定时器：窗口内的最新样本先持有引用，同一实例下一个窗口的首个样本到达时才分发，
+ *       因此分发比窗口结束晚至多一个发布周期，实例停发后最后一个窗口的样本不会分发。
+ *       新实例首次出现时分配状态，之后的求值路径不分配内存
+ */
+class BridgeDecimator {
+public:
+    explicit BridgeDecimator(const BridgeDecimationOptions& options) : options_(options) {}
+    ~BridgeDecimator();
+
+    BridgeDecimator(const BridgeDecimator&) = delete;
+    BridgeDecimator& operator=(const BridgeDecimator&) = delete;
+
+    /**
+     * @brief 对一个有效样本做抽稀，接管serdata的一个引用
+     * @param info 输入为serdata的样本信息；返回非空时改写为返回样本的信息
+     * @return 应反序列化并分发的样本，引用归调用方；可能是同一实例上一个窗口保留的样本，丢弃或暂存时为nullptr
+     */
+    ddsi_serdata* Offer(ddsi_serdata* serdata, dds_sample_info_t& info);
+
+    BridgeDecimationStats Stats() const;
+
+    const BridgeDecimationOptions& Options() const { return options_; }
+
+private:
+    struct Instance {
+        uint64_t count = 0;                 // 已到达的样本数，用于keep_every
+        int64_t last_delivered = INT64_MIN; // 上次通过min_separation的源时间戳
+        int64_t window = 0;                 // 暂存样本所在窗口序号
+        ddsi_serdata* pending = nullptr;    // window模式下当前窗口的最新样本
+        dds_sample_info_t pending_info{};
+    };
+
+    BridgeDecimationOptions options_;
+    std::mutex mutex_;      // 可重入回调组下同一读者可能被并发take
+    std::unordered_map<dds_instance_handle_t, Instance> instances_;
+    dds_instance_handle_t last_handle_ = 0;     // 单实例话题（如Imu）连续样本免去查表
+    Instance* last_instance_ = nullptr;
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> dropped_every_{0};
+    std::atomic<uint64_t> dropped_separation_{0};
+    std::atomic<uint64_t> dropped_window_{0};
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_DECIMATION_HPP__
@@ -0,0 +1,48 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_DISCOVERY_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_DISCOVERY_HPP__
+
+/**
+ * @file bridge_discovery.hpp
+ * @brief 发现（SPDP/SEDP）参数配置与快速发现预设
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 发现相关的Cyclone配置，由BridgeFactory::Init(domain_id, options)生成CYCLONEDDS_URI
+ * @note 时长为0的项保持Cyclone默认值；通信双方应使用相同的配置
+ */
+struct BridgeDiscoveryOptions {
+    std::string network_interface;                  // 网卡名或地址，空字符串为自动选择
+    bool allow_multicast = true;                    // false时SPDP只发往peers
+    std::vector<std::string> peers;                 // 静态单播对端（地址或主机名）
+    int max_participant_index = 9;                  // 有peers时按参与者序号探测的端口数，需不小于单机参与者数
+    std::chrono::milliseconds spdp_interval{0};     // SPDP周期广播间隔，默认30s
+    std::chrono::milliseconds lease_duration{0};    // 参与者租约，默认10s；越短越快清理已重启对端的残留
+    std::chrono::milliseconds heartbeat_interval{0};    // 可靠写者心跳间隔，默认100ms；影响SEDP端点信息的补发速度
+
+    /**
+     * @brief 快速发现预设：关闭组播、静态单播对端、1s SPDP、3s租约、20ms心跳
+     * @param peers 对端地址，单机部署时为127.0.0.1
+     */
+    static BridgeDiscoveryOptions Fast(const std::vector<std::string>& peers);
+};
+
+/**
+ * @brief 生成对应的Cyclone XML配置
+ */
+std::string BridgeDiscoveryConfigXml(const BridgeDiscoveryOptions& options);
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_DISCOVERY_HPP__
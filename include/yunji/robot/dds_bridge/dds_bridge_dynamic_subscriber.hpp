@@ -0,0 +1,185 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_DYNAMIC_SUBSCRIBER_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_DYNAMIC_SUBSCRIBER_HPP__
+
+/**
+ * @file bridge_dynamic_subscriber.hpp
+ * @brief 运行时确定类型的订阅者：发现发布端时解析类型，不需要编译进IDL类型
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_factory.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_type.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_qos.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+struct ddsi_serdata;
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 动态订阅收到的一条样本，只在回调内有效
+ */
+struct BridgeDynamicSample {
+    BridgeDynamicView view;                     // 字段访问视图，引用读者持有的序列化数据
+    const uint8_t* payload = nullptr;           // 原始CDR（含封装头）
+    uint32_t size = 0;
+    int64_t source_ns = 0;                      // 发布端源时间戳
+    int64_t receive_ns = 0;                     // 本地取出时的墙上时间
+    int64_t latency_ns = 0;                     // 时钟同步运行时已换算到本地时钟
+    dds_instance_handle_t publication_handle = 0;
+};
+
+/**
+ * @class BridgeDynamicSubscriber
+ * @brief 按话题名订阅、运行时解析类型的订阅者，供录制、查看、网关类工具使用
+ * @note 从DCPSPublication内置话题发现该话题的发布端，按其type_info经类型查找服务取回类型
+ *       （即生成代码中的type_map/type_info），建立字段偏移表后才创建读者；解析完成前发布的样本收不到。
+ *       读者用dds_takecdr取出序列化数据，不做反序列化，回调拿到的视图直接按偏移读取字段，
+ *       定长类型每个字段一次定长读取；取数据、等待线程与执行器调度方式与BridgeSubscriber一致
+ */
+class BridgeDynamicSubscriber : public BridgeExecutable {
+public:
+    using CallbackType = std::function<void(const BridgeDynamicSample&)>;
+
+    explicit BridgeDynamicSubscriber(const std::string& topic);
+    ~BridgeDynamicSubscriber() override;
+
+    BridgeDynamicSubscriber(const BridgeDynamicSubscriber&) = delete;
+    BridgeDynamicSubscriber& operator=(const BridgeDynamicSubscriber&) = delete;
+
+    /**
+     * @brief 将订阅交给共享执行器调度，需在InitBridge()之前调用
+     * @note 类型发现仍由本订阅的后台线程完成，解析后不再占用线程
+     */
+    void SetExecutor(BridgeExecutorPtr executor,
+                     BridgePriority priority = BridgePriority::kNormal,
+                     BridgeCallbackGroupPtr group = nullptr);
+
+    /**
+     * @brief 设置QoS预设，需在InitBridge()之前调用
+     */
+    void SetQosPreset(BridgeQosPreset preset) { qos_preset_ = preset; }
+
+    /**
+     * @brief 关闭字段解析，回调中view未绑定，只有原始CDR与时间戳可用，需在InitBridge()之前调用
+     * @note 只统计频率、带宽、延迟时使用，变长类型省去每样本一次的字段定位
+     */
+    void SetDecode(bool decode) { decode_ = decode; }
+
+    /**
+     * @brief 设置分区，名称可含通配符'*'、'?'，为空表示默认分区，需在InitBridge()之前调用
+     * @note 类型发现不受分区限制，任一分区中的发布端都可提供类型
+     */
+    void SetPartitions(const std::vector<std::string>& partitions) { partitions_ = partitions; }
+
+    /**
+     * @brief 只接受该类型的发布端（同一话题上存在多个类型时），需在InitBridge()之前调用
+     */
+    void SetTypeName(const std::string& type_name) { type_filter_ = type_name; }
+
+    /**
+     * @brief 开始发现发布端，不阻塞；类型解析完成后自动创建读者
+     */
+    bool InitBridge(CallbackType callback);
+
+    /**
+     * @brief 等待类型解析完成
+     * @return 超时返回false
+     */
+    bool WaitForType(std::chrono::milliseconds timeout);
+
+    bool IsResolved() const { return resolved_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 解析得到的类型名、type_map与字段表，IsResolved()之后有效
+     */
+    const std::string& TypeName() const { return type_name_; }
+    const std::vector<uint8_t>& TypeMap() const { return type_map_; }
+    const BridgeDynamicLayout& Layout() const { return layout_; }
+
+    /**
+     * @brief 当前已匹配的发布端数量
+     */
+    int32_t MatchedPublishers() const;
+
+    /**
+     * @brief 无法按类型解析（封装格式不支持、数据截断）而丢弃的样本数
+     */
+    uint64_t DecodeErrors() const { return decode_errors_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 取出最多max_samples个样本并分发，max_samples为0表示取完为止；类型解析前返回0
+     */
+    size_t Execute(size_t max_samples) override;
+
+private:
+    static constexpr size_t kTakeBatch = 32;
+
+    void Run();
+    bool PollPublications(bool retry);
+    bool TryPublication(void* sample, const dds_sample_info_t& info);
+    bool Resolve(const dds_typeinfo_t* type_info);
+    bool CreateReader();
+    size_t Deliver(size_t count);
+    static void OnDataAvailable(dds_entity_t reader, void* arg);
+
+    std::shared_ptr<dds::domain::DomainParticipant> participant_;
+    dds_entity_t participant_entity_ = 0;
+    std::string topic_name_;
+    std::string type_filter_;
+    std::vector<std::string> partitions_;
+    BridgeQosPreset qos_preset_ = BridgeQosPreset::kDefault;
+    bool decode_ = true;
+    CallbackType callback_;
+
+    dds_entity_t publications_ = 0;         // DCPSPublication内置读者，解析完成后删除
+    std::vector<dds_instance_handle_t> retry_;      // 类型解析失败、待重试的发布端，只由发现线程访问
+    dds_entity_t topic_ = 0;
+    dds_entity_t subscriber_ = 0;
+    dds_entity_t reader_ = 0;
+    std::atomic<dds_entity_t> reader_entity_{0};
+    dds_entity_t waitset_ = 0;
+    std::thread thread_;
+    std::atomic<bool> running_{true};
+
+    std::string type_name_;
+    std::vector<uint8_t> type_map_;
+    BridgeDynamicLayout layout_;
+    std::atomic<bool> resolved_{false};
+    std::mutex resolved_mutex_;
+    std::condition_variable resolved_cv_;
+
+    std::array<ddsi_serdata*, kTakeBatch> serdata_{};
+    std::array<dds_sample_info_t, kTakeBatch> infos_{};
+    std::vector<uint8_t> scratch_;          // 序列化数据不连续时的拷贝
+    BridgeDynamicSample sample_;
+    std::mutex take_mutex_;                 // 可重入回调组下串行化take与分发
+    std::atomic<uint64_t> decode_errors_{0};
+
+    BridgeExecutorPtr executor_;
+    BridgePriority priority_ = BridgePriority::kNormal;
+    BridgeCallbackGroupPtr group_;
+    BridgeExecutor::Handle handle_;
+
+    BridgeTopicMetricsPtr metrics_;
+    bool metrics_registered_ = false;
+};
+
+using BridgeDynamicSubscriberPtr = std::unique_ptr<BridgeDynamicSubscriber>;
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_DYNAMIC_SUBSCRIBER_HPP__
@@ -0,0 +1,254 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_DYNAMIC_TYPE_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_DYNAMIC_TYPE_HPP__
+
+/**
+ * @file bridge_dynamic_type.hpp
+ * @brief 由XTypes TypeMapping描述的动态类型，以及按类型描述解析CDR样本
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+enum class BridgeDynamicKind : uint8_t {
+    kBool,
+    kChar,
+    kInt8,
+    kUint8,
+    kInt16,
+    kUint16,
+    kInt32,
+    kUint32,
+    kInt64,
+    kUint64,
+    kFloat32,
+    kFloat64,
+    kEnum,          // 按bit_bound编码为整数
+    kString,
+    kArray,
+    kSequence,
+    kStruct
+};
+
+enum class BridgeExtensibility : uint8_t {
+    kFinal,
+    kAppendable,
+    kMutable
+};
+
+struct BridgeDynamicType;
+using BridgeDynamicTypePtr = std::shared_ptr<const BridgeDynamicType>;
+
+struct BridgeDynamicMember {
+    std::string name;
+    uint32_t id = 0;
+    bool key = false;
+    bool optional = false;
+    BridgeDynamicTypePtr type;
+};
+
+/**
+ * @brief 类型树节点
+ */
+struct BridgeDynamicType {
+    BridgeDynamicKind kind = BridgeDynamicKind::kInt32;
+    std::string name;                               // 结构体、枚举的完整类型名
+    BridgeExtensibility extensibility = BridgeExtensibility::kFinal;
+    std::vector<BridgeDynamicMember> members;       // kStruct
+    BridgeDynamicTypePtr element;                   // kArray/kSequence的元素类型
+    std::vector<uint32_t> dims;                     // kArray各维长度
+    uint32_t bound = 0;                             // kSequence/kString上界（0为无界），kEnum为bit_bound
+
+    bool IsPrimitive() const { return kind <= BridgeDynamicKind::kEnum; }
+
+    /**
+     * @brief 基本类型在CDR中的字节数，非基本类型返回0
+     */
+    uint32_t PrimitiveSize() const;
+};
+
+/**
+ * @brief 基本类型名称（如"float32"），用于导出文件和命令行输出
+ */
+const char* BridgeDynamicKindName(BridgeDynamicKind kind);
+
+/**
+ * @brief 从ddscxx生成的type_map（XTypes TypeMapping，XCDR2小端）中解析类型
+ * @param type_name 完整类型名（如"ImuData::Imu"），在COMPLETE类型对象中按名查找
+ * @param error 失败原因，可为nullptr
+ * @note 支持结构体（含继承）、枚举、别名、基本类型、字符串、数组和序列；联合、位掩码、映射、宽字符串不支持
+ */
+bool BridgeParseTypeMap(const std::vector<uint8_t>& type_map, const std::string& type_name,
+                        BridgeDynamicTypePtr& type, std::string* error = nullptr);
+
+/**
+ * @brief 展开后的叶子字段，数组逐元素展开（"state[3].q"），字符串和序列各为一个字段
+ */
+struct BridgeDynamicField {
+    std::string path;
+    BridgeDynamicKind kind = BridgeDynamicKind::kInt32;
+    uint32_t size = 0;              // 基本类型字节数，字符串/序列为0
+    bool key = false;
+    BridgeDynamicTypePtr type;      // 叶子类型节点，序列为序列类型本身
+};
+
+/**
+ * @brief 可选成员缺省时字段的偏移
+ */
+constexpr uint32_t kBridgeFieldAbsent = 0xffffffffu;
+
+/**
+ * @brief 解析得到的字段值，只有与kind对应的成员有意义
+ */
+struct BridgeDynamicValue {
+    int64_t i = 0;                  // 有符号整数、枚举、bool、char
+    uint64_t u = 0;                 // 无符号整数
+    double f = 0.0;                 // 浮点数
+    std::string text;               // 字符串；序列为"[a, b, ...]"
+};
+
+/**
+ * @class BridgeDynamicLayout
+ * @brief 动态类型的展开字段表与CDR解析
+ * @note 不含字符串、序列、可选成员的类型为定长类型，每个字段在样本中的偏移固定（XCDR1/XCDR2各一套），
+ *       可以直接按偏移拷贝而不必逐字段遍历
+ */
+class BridgeDynamicLayout {
+public:
+    bool Build(const BridgeDynamicTypePtr& type);
+
+    const BridgeDynamicTypePtr& Type() const { return type_; }
+    const std::vector<BridgeDynamicField>& Fields() const { return fields_; }
+
+    /**
+     * @brief 按路径查找字段下标，不存在时返回-1
+     */
+    int FindField(const std::string& path) const;
+
+    bool IsFixed() const { return fixed_; }
+
+    /**
+     * @brief 定长类型各字段相对数据起点（封装头之后）的偏移
+     */
+    const std::vector<uint32_t>& FixedOffsets(bool xcdr2) const { return xcdr2 ? xcdr2_offsets_ : xcdr1_offsets_; }
+
+    /**
+     * @brief 定长类型样本的数据长度（不含封装头）
+     */
+    uint32_t FixedSize(bool xcdr2) const { return xcdr2 ? xcdr2_size_ : xcdr1_size_; }
+
+    /**
+     * @brief 解析一个CDR样本（含4字节封装头）的全部字段
+     * @param values 按Fields()顺序输出，大小调整为字段数
+     * @return 封装格式不支持（PL_CDR）或数据截断时返回false
+     */
+    bool Decode(const uint8_t* payload, size_t size, std::vector<BridgeDynamicValue>& values) const;
+
+    /**
+     * @brief 非定长类型按样本计算各字段相对数据起点的偏移，只定位不取值
+     * @param offsets 按Fields()顺序输出；字符串、序列字段指向其长度，缺省的可选成员为kBridgeFieldAbsent
+     * @return 封装格式不支持或数据截断时返回false
+     */
+    bool Locate(const uint8_t* payload, size_t size, std::vector<uint32_t>& offsets) const;
+
+private:
+    BridgeDynamicTypePtr type_;
+    std::vector<BridgeDynamicField> fields_;
+    bool fixed_ = false;
+    std::vector<uint32_t> xcdr1_offsets_;
+    std::vector<uint32_t> xcdr2_offsets_;
+    uint32_t xcdr1_size_ = 0;
+    uint32_t xcdr2_size_ = 0;
+};
+
+/**
+ * @class BridgeDynamicView
+ * @brief 一个CDR样本的字段访问视图，不拷贝、不反序列化
+ * @note 定长类型直接使用BridgeDynamicLayout预先算好的偏移，绑定只检查封装头和长度，
+ *       读取字段为一次按偏移的定长读取（必要时字节交换）；非定长类型绑定时遍历一次样本定位各字段。
+ *       视图只引用layout和payload，两者需在使用视图期间保持有效
+ */
+class BridgeDynamicView {
+public:
+    /**
+     * @brief 绑定一个CDR样本（含4字节封装头）
+     * @return 封装格式不支持、长度不足或数据截断时返回false，此时视图不可用
+     */
+    bool Bind(const BridgeDynamicLayout& layout, const uint8_t* payload, size_t size);
+
+    const BridgeDynamicLayout& Layout() const { return *layout_; }
+
+    size_t FieldCount() const { return layout_->Fields().size(); }
+
+    const BridgeDynamicField& Field(size_t index) const { return layout_->Fields()[index]; }
+
+    /**
+     * @brief 字段是否存在（只有缺省的可选成员返回false）
+     */
+    bool Has(size_t index) const { return offsets_[index] != kBridgeFieldAbsent; }
+
+    /**
+     * @brief 数值字段按有符号整数读取，浮点数截断，非数值字段返回0
+     */
+    int64_t Int(size_t index) const;
+
+    /**
+     * @brief 数值字段按无符号整数读取
+     */
+    uint64_t Uint(size_t index) const;
+
+    /**
+     * @brief 数值字段按浮点数读取
+     */
+    double Double(size_t index) const;
+
+    /**
+     * @brief 字符串的字节数或序列的元素数
+     */
+    uint32_t Length(size_t index) const;
+
+    /**
+     * @brief 字段的文本形式：字符串为原文，序列为"[a, b, ...]"，数值与BridgeDynamicValue的格式化一致
+     */
+    std::string Text(size_t index) const;
+
+    /**
+     * @brief 整个样本的文本形式，每行"path: value"
+     */
+    std::string ToString() const;
+
+    /**
+     * @brief 原始CDR数据起点（封装头之后）
+     */
+    const uint8_t* Data() const { return data_; }
+
+private:
+    uint64_t Raw(size_t index, uint32_t& size) const;
+
+    const BridgeDynamicLayout* layout_ = nullptr;
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool xcdr2_ = false;
+    bool swap_ = false;
+    const uint32_t* offsets_ = nullptr;
+    std::vector<uint32_t> located_;         // 非定长类型本样本的字段偏移
+};
+
+/**
+ * @brief 样本的CDR封装信息
+ * @return 封装头无效或为参数列表格式时返回false
+ */
+bool BridgeCdrEncoding(const uint8_t* payload, size_t size, bool& xcdr2, bool& little_endian);
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_DYNAMIC_TYPE_HPP__
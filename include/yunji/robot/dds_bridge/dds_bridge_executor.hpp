@@ -0,0 +1,258 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_EXECUTOR_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_EXECUTOR_HPP__
+
+/**
+ * @file bridge_executor.hpp
+ * @brief 多话题共享的优先级回调执行器
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+class BridgeTimer;
+struct BridgeTimerOptions;
+
+/**
+ * @brief 订阅回调的优先级类别，数值越小越优先
+ * @note 同一批工作线程上，控制类话题总是先于遥测类话题被分发
+ */
+enum class BridgePriority : uint8_t {
+    kControl = 0,       // 控制闭环（关节状态/指令、IMU）
+    kHigh,
+    kNormal,
+    kTelemetry,         // 遥测、诊断、BMS等
+    kCount
+};
+
+constexpr size_t kBridgePriorityCount = static_cast<size_t>(BridgePriority::kCount);
+
+/**
+ * @brief 回调组类型
+ */
+enum class BridgeCallbackGroupType : uint8_t {
+    kMutuallyExclusive,     // 组内回调互斥，任意时刻最多一个在执行
+    kReentrant              // 组内回调（包括同一订阅的多次触发）可并发执行
+};
+
+/**
+ * @class BridgeCallbackGroup
+ * @brief 回调组，约束挂在同一组下的订阅之间的并发关系
+ */
+class BridgeCallbackGroup {
+public:
+    explicit BridgeCallbackGroup(BridgeCallbackGroupType type = BridgeCallbackGroupType::kMutuallyExclusive)
+        : type_(type) {}
+
+    BridgeCallbackGroupType Type() const { return type_; }
+
+private:
+    friend class BridgeExecutor;
+
+    BridgeCallbackGroupType type_;
+    bool busy_ = false;     // 由执行器内部锁保护
+};
+
+using BridgeCallbackGroupPtr = std::shared_ptr<BridgeCallbackGroup>;
+
+/**
+ * @class BridgeExecutable
+ * @brief 可被执行器调度的实体（如订阅者）
+ */
+class BridgeExecutable {
+public:
+    virtual ~BridgeExecutable() = default;
+
+    /**
+     * @brief 取出并处理最多max_samples个样本
+     * @return 实际处理的样本数；等于max_samples时执行器认为可能仍有剩余数据
+     */
+    virtual size_t Execute(size_t max_samples) = 0;
+};
+
+/**
+ * @brief 执行器运行模式
+ */
+enum class BridgeExecutorMode : uint8_t {
+    kThreaded,      // 后台工作线程按数据到达调度
+    kStepping       // 无后台线程，由应用调用Step()/SpinUntilIdle()确定性地推进
+};
+
+/**
+ * @brief 执行器配置
+ */
+struct BridgeExecutorOptions {
+    BridgeExecutorMode mode = BridgeExecutorMode::kThreaded;       // 运行模式
+    size_t num_threads = 2;                                         // 工作线程数（仅kThreaded）
+    size_t max_batch = 32;                                          // 单次调度最多处理的样本数，限制突发对高优先级的阻塞时间
+    std::chrono::nanoseconds starvation_threshold{std::chrono::milliseconds(1)};   // 排队超过该时长计为一次饥饿
+    int timer_thread_priority = 0;                                  // 定时线程SCHED_FIFO优先级，0表示不修改
+    bool realtime_threads = false;                                  // 将工作线程和定时线程标记为实时线程，见BridgeAllocTracker严格模式
+};
+
+/**
+ * @brief 单个优先级类别的调度统计
+ */
+struct BridgePriorityStats {
+    uint64_t dispatched = 0;        // 已调度次数
+    uint64_t samples = 0;           // 已处理样本数
+    uint64_t total_wait_ns = 0;     // 累计排队时长
+    uint64_t max_wait_ns = 0;       // 最大排队时长
+    uint64_t starved = 0;           // 排队时长超过阈值的次数
+    size_t queue_depth = 0;         // 当前排队数
+    size_t max_queue_depth = 0;     // 历史最大排队数
+};
+
+using BridgeExecutorStats = std::array<BridgePriorityStats, kBridgePriorityCount>;
+
+/**
+ * @class BridgeExecutor
+ * @brief 多个订阅共享的工作线程池，按优先级类别和回调组调度
+ * @note 订阅数据到达时调用Notify()入队，工作线程总是先取最高优先级且所属回调组空闲的实体。
+ *       未指定回调组的实体各自独占一个互斥组，保证单个订阅的回调按序串行执行。
+ *       kStepping模式下不创建线程，Notify()被忽略，由Step()主动轮询，用于仿真和CI。
+ */
+class BridgeExecutor {
+public:
+    struct Entry;
+    using Handle = std::shared_ptr<Entry>;
+
+    explicit BridgeExecutor(const BridgeExecutorOptions& options = BridgeExecutorOptions());
+    ~BridgeExecutor();
+
+    BridgeExecutor(const BridgeExecutor&) = delete;
+    BridgeExecutor& operator=(const BridgeExecutor&) = delete;
+
+    /**
+     * @brief 启动工作线程（重复调用无副作用）
+     */
+    void Start();
+
+    /**
+     * @brief 停止并回收工作线程，正在执行的回调会先完成
+     */
+    void Stop();
+
+    /**
+     * @brief 注册可调度实体
+     * @param executable 实体指针，需在Remove()返回前保持有效
+     * @param priority 优先级类别
+     * @param group 回调组，为空时实体独占一个互斥组
+     * @return 用于Notify()/Remove()的句柄
+     */
+    Handle Add(BridgeExecutable* executable,
+               BridgePriority priority = BridgePriority::kNormal,
+               BridgeCallbackGroupPtr group = nullptr);
+
+    /**
+     * @brief 注销实体，阻塞直到该实体上正在执行的回调完成
+     */
+    void Remove(const Handle& handle);
+
+    /**
+     * @brief 通知实体有新数据，可在DDS监听线程中调用
+     * @note 实体已在队列中时不会重复入队
+     */
+    void Notify(const Handle& handle);
+
+    /**
+     * @brief 创建周期定时器，首次触发在一个周期之后
+     * @param period 周期
+     * @param callback 回调
+     * @return 定时器句柄，调用Cancel()停止
+     * @note kThreaded模式下由专用定时线程按绝对截止时刻唤醒（timerfd），
+     *       kStepping模式下在Step()中按BridgeClock时间触发
+     */
+    std::shared_ptr<BridgeTimer> CreateTimer(std::chrono::nanoseconds period,
+                                             std::function<void()> callback);
+
+    std::shared_ptr<BridgeTimer> CreateTimer(std::chrono::nanoseconds period,
+                                             std::function<void()> callback,
+                                             const BridgeTimerOptions& options);
+
+    /**
+     * @brief 步进一次（仅kStepping模式）
+     * @param delta 仿真时钟推进量；BridgeClock处于仿真模式时先推进时间
+     * @return 本次处理的样本数（含定时器触发次数）
+     * @note 先按截止时刻触发到期定时器，再按优先级、同优先级内按注册顺序轮询所有实体并取空其数据，
+     *       执行顺序与线程调度无关
+     */
+    size_t Step(std::chrono::nanoseconds delta = std::chrono::nanoseconds(0));
+
+    /**
+     * @brief 反复Step()直到没有任何实体处理数据（仅kStepping模式）
+     * @param max_rounds 最大轮数，防止回调间互相发布导致死循环
+     * @return 累计处理的样本数
+     */
+    size_t SpinUntilIdle(size_t max_rounds = 1000);
+
+    bool IsStepping() const { return options_.mode == BridgeExecutorMode::kStepping; }
+
+    /**
+     * @brief 获取各优先级类别的调度与饥饿统计
+     */
+    BridgeExecutorStats Stats() const;
+
+    const BridgeExecutorOptions& Options() const { return options_; }
+
+private:
+    void WorkerLoop();
+    void TimerLoop();
+    void WakeTimerThread();
+    size_t FireDueTimers(int64_t now_ns);
+    void Enqueue(const Handle& handle);
+    Handle PickRunnable();
+
+    BridgeExecutorOptions options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::array<std::vector<Handle>, kBridgePriorityCount> queues_;     // 按实体数预留容量，入队不分配
+    std::vector<Handle> entries_;       // 全部已注册实体，按注册顺序
+    BridgeExecutorStats stats_;
+
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{false};      // 在mutex_下修改，定时器线程忙等时无锁读取
+
+    std::vector<std::shared_ptr<BridgeTimer>> timers_;     // 由mutex_保护
+    std::thread timer_thread_;
+    int timer_fd_ = -1;
+    int wake_fd_ = -1;
+};
+
+/**
+ * @brief 执行器内部记录的实体信息
+ */
+struct BridgeExecutor::Entry {
+    BridgeExecutable* executable = nullptr;
+    BridgePriority priority = BridgePriority::kNormal;
+    BridgeCallbackGroupPtr group;
+    std::atomic<bool> scheduled{false};     // 已在队列中
+    bool removed = false;                   // 以下字段由执行器内部锁保护
+    int running = 0;
+    std::chrono::steady_clock::time_point enqueue_time;
+};
+
+using BridgeExecutorPtr = std::shared_ptr<BridgeExecutor>;
+
+}
+}
+
+#include "yunji/robot/dds_bridge/dds_bridge_timer.hpp"
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_EXECUTOR_HPP__
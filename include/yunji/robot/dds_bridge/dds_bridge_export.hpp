@@ -0,0 +1,183 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_EXPORT_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_EXPORT_HPP__
+
+/**
+ * @file bridge_export.hpp
+ * @brief 录制分段的并行解析与列式/CSV导出
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_type.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+constexpr uint32_t kBridgeColumnMagic = 0x594A4346;       // "YJCF"
+constexpr uint32_t kBridgeColumnVersion = 1;
+constexpr uint32_t kBridgeColumnAlignment = 64;
+
+/**
+ * @brief 列式文件头
+ * @note 文件布局：文件头、column_count个列描述、名称表（话题名、类型名、各列名依次排列，不含结尾0），
+ *       之后是各列的连续数组，每列起点按64字节对齐；数值按小端存储，可直接映射为float/int64_t等数组使用
+ */
+struct BridgeColumnHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t rows;
+    uint64_t type_hash;         // 同BridgeTopicRecordHeader::type_hash
+    uint32_t column_count;
+    uint32_t names_size;        // 名称表字节数
+    uint16_t topic_name_size;
+    uint16_t type_name_size;
+    uint8_t reserved[28];
+};
+
+/**
+ * @brief 列描述
+ */
+struct BridgeColumnDescriptor {
+    uint64_t data_offset;       // 列数据在文件中的偏移，长度为rows * element_size
+    uint32_t name_offset;       // 列名在名称表中的偏移
+    uint16_t name_size;
+    uint8_t kind;               // BridgeDynamicKind，枚举按int32存储
+    uint8_t element_size;
+    uint8_t key;                // 是否为@key字段
+    uint8_t reserved[15];
+};
+
+static_assert(sizeof(BridgeColumnHeader) == 64, "column header layout");
+static_assert(sizeof(BridgeColumnDescriptor) == 32, "column descriptor layout");
+
+enum class BridgeExportFormat : uint8_t {
+    kColumnar,      // 每个话题一个<topic>.yjcol列式文件，只含数值字段
+    kCsv            // 每个话题一个<topic>.csv，含全部字段
+};
+
+/**
+ * @brief 导出配置
+ */
+struct BridgeExportOptions {
+    std::string directory = ".";                    // 输出目录，不存在时创建（仅一级）
+    BridgeExportFormat format = BridgeExportFormat::kColumnar;
+    size_t threads = 0;                             // 解析线程数，0为硬件线程数
+    std::vector<std::string> topics;                // 只导出这些话题，为空时导出全部
+};
+
+/**
+ * @brief 导出统计
+ */
+struct BridgeExportStats {
+    uint64_t segments = 0;          // 读取的分段数
+    uint64_t topics = 0;            // 导出的话题数
+    uint64_t rows = 0;              // 导出的样本行数
+    uint64_t errors = 0;            // 解析失败的样本数（列式文件中对应行为0，CSV中跳过）
+};
+
+/**
+ * @class BridgeExporter
+ * @brief 把录制分段按话题导出为列式文件或CSV
+ * @note 样本按录制时写入的type_map离线解析，无需编译期类型。
+ *       先并行统计各分段每个话题的样本数，由前缀和确定每个分段在输出中的行号区间，
+ *       再并行解析各分段并直接写入映射的输出文件，线程之间不共享可写状态，耗时随核数近似线性下降。
+ *       定长类型（见BridgeDynamicLayout）按固定偏移逐列拷贝，不逐字段遍历。
+ *       同一话题的行按分段开始时刻、通道号、分段序号排序，话题只在一个通道录制时即为接收时间顺序
+ */
+class BridgeExporter {
+public:
+    explicit BridgeExporter(const BridgeExportOptions& options = BridgeExportOptions());
+    ~BridgeExporter();
+
+    BridgeExporter(const BridgeExporter&) = delete;
+    BridgeExporter& operator=(const BridgeExporter&) = delete;
+
+    /**
+     * @brief 导出一组分段文件，阻塞直到完成
+     * @param segments 分段文件路径，可以来自多个通道，顺序任意
+     * @return 没有可读分段或输出文件创建失败时返回false
+     */
+    bool Run(const std::vector<std::string>& segments);
+
+    const BridgeExportStats& Stats() const { return stats_; }
+
+private:
+    struct Segment;
+    struct Topic;
+
+    void Scan(Segment& segment);
+    bool Plan(std::vector<Segment>& segments);
+    Topic* AddTopic(const BridgeRecordedTopic& recorded);
+    bool CreateColumnFile(Topic& topic);
+    bool CreateCsvFile(Topic& topic);
+    void ExportColumns(const Segment& segment);
+    void ExportCsv(const Segment& segment, std::vector<std::string>& buffers);
+    bool Finish(bool ok);
+    void RunParallel(size_t count, const std::function<void(size_t)>& work) const;
+
+    BridgeExportOptions options_;
+    BridgeExportStats stats_;
+    std::vector<std::unique_ptr<Topic>> topics_;
+    std::atomic<uint64_t> errors_{0};
+};
+
+/**
+ * @class BridgeColumnFile
+ * @brief 以只读映射方式打开列式文件
+ */
+class BridgeColumnFile {
+public:
+    BridgeColumnFile() = default;
+    ~BridgeColumnFile();
+
+    BridgeColumnFile(const BridgeColumnFile&) = delete;
+    BridgeColumnFile& operator=(const BridgeColumnFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    const BridgeColumnHeader& Header() const { return *header_; }
+    uint64_t Rows() const { return header_->rows; }
+    std::string TopicName() const;
+    std::string TypeName() const;
+
+    size_t ColumnCount() const { return header_->column_count; }
+    const BridgeColumnDescriptor& Column(size_t index) const { return columns_[index]; }
+    std::string ColumnName(size_t index) const;
+
+    /**
+     * @brief 按列名查找，不存在时返回-1
+     */
+    int FindColumn(const std::string& name) const;
+
+    /**
+     * @brief 列数据，T的大小与列的element_size不一致时返回nullptr
+     */
+    template <typename T>
+    const T* Data(size_t index) const {
+        const BridgeColumnDescriptor& column = columns_[index];
+        return column.element_size == sizeof(T) ? reinterpret_cast<const T*>(base_ + column.data_offset) : nullptr;
+    }
+
+private:
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    const BridgeColumnHeader* header_ = nullptr;
+    const BridgeColumnDescriptor* columns_ = nullptr;
+    const char* names_ = nullptr;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_EXPORT_HPP__
@@ -8,8 +8,18 @@
  */
 
 #include <dds/dds.hpp>  // CycloneDDS核心头文件
+#include <dds/ddsc/dds_statistics.h>
 #include <thread>  // 添加这行
 
+#include "yunji/robot/dds_bridge/dds_bridge_metrics.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_discovery.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct dds_statistics;
+
 namespace yunji
 {
 
@@ -41,6 +51,13 @@ public:
      */
     void Init(const std::string& config_path = "");
 
+    /**
+     * @brief 初始化DDS通信层（通过发现参数，如BridgeDiscoveryOptions::Fast()）
+     * @param domain_id DDS域ID
+     * @param options 发现参数，会覆盖CYCLONEDDS_URI
+     */
+    void Init(int domain_id, const BridgeDiscoveryOptions& options);
+
 
 
 
@@ -50,11 +67,43 @@ public:
 
     }
 
+    /**
+     * @brief 获取所有已注册桥接端点的统计快照
+     * @note 速率按距上一次调用Metrics()的时间间隔计算，首次调用按端点注册以来计算。
+     *       同时刷新各端点底层实体的Cyclone统计（dds_statistics）并一并返回。
+     *       已启动BridgeMetricsCollector时应改用其Latest()，避免两处调用互相打乱速率区间
+     */
+    BridgeMetricsSnapshot Metrics();
+
+    /**
+     * @brief 注册端点统计（由BridgePublisher/BridgeSubscriber在初始化成功后调用）
+     */
+    void RegisterMetrics(const BridgeTopicMetricsPtr& metrics);
+
+    /**
+     * @brief 注销端点统计（由BridgePublisher/BridgeSubscriber在析构时调用）
+     */
+    void UnregisterMetrics(const BridgeTopicMetricsPtr& metrics);
+
 private:
 
     BridgeFactory() = default;
 
+    using DdsStatisticsPtr = std::unique_ptr<dds_statistics, decltype(&dds_delete_statistics)>;
+
+    struct MetricsEntry {
+        BridgeTopicMetricsPtr metrics;
+        uint64_t last_messages = 0;
+        uint64_t last_bytes = 0;
+        int64_t last_time_ns = 0;
+        DdsStatisticsPtr dds_stats{nullptr, &dds_delete_statistics};      // 首次快照时按实体句柄创建
+        std::vector<uint64_t> last_dds_values;
+    };
+
     std::shared_ptr<dds::domain::DomainParticipant> participant_;
+
+    std::mutex metrics_mutex_;
+    std::vector<MetricsEntry> metrics_;
 };
 
 }
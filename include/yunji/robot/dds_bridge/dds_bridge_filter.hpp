@@ -0,0 +1,171 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_FILTER_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_FILTER_HPP__
+
+/**
+ * @file bridge_filter.hpp
+ * @brief 在序列化数据上求值的订阅内容过滤
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_type.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+enum class BridgeFilterOp : uint8_t {
+    kEq,
+    kNe,
+    kLt,
+    kLe,
+    kGt,
+    kGe
+};
+
+/**
+ * @class BridgeContentFilter
+ * @brief 订阅内容过滤条件，各条件之间为"与"关系
+ * @note key条件作用于类型的第一个数值@key成员（如id），字段条件按展开路径（如"state[0].q"）比较数值。
+ *       条件先用Compile()按类型字段表解析为下标，之后在BridgeDynamicView上求值，不反序列化
+ */
+class BridgeContentFilter {
+public:
+    /**
+     * @brief key等于ids之一
+     */
+    BridgeContentFilter& KeyIn(std::vector<int64_t> ids);
+
+    /**
+     * @brief key在闭区间[min, max]内
+     */
+    BridgeContentFilter& KeyRange(int64_t min, int64_t max);
+
+    /**
+     * @brief 数值字段与value比较，整数字段按整数比较
+     */
+    BridgeContentFilter& Where(const std::string& path, BridgeFilterOp op, double value);
+
+    bool Empty() const { return key_sets_.empty() && key_ranges_.empty() && predicates_.empty(); }
+
+    bool HasKeyCondition() const { return !key_sets_.empty() || !key_ranges_.empty(); }
+
+    /**
+     * @brief 按字段表解析key成员与字段路径
+     * @return 类型没有数值key而设置了key条件，或字段不存在、不是数值字段时返回false
+     */
+    bool Compile(const BridgeDynamicLayout& layout, std::string* error = nullptr);
+
+    /**
+     * @brief 样本的key是否满足全部key条件，没有key条件时为true
+     */
+    bool MatchesKey(const BridgeDynamicView& view) const;
+
+    /**
+     * @brief 样本是否满足全部字段条件
+     */
+    bool MatchesFields(const BridgeDynamicView& view) const;
+
+    bool Matches(const BridgeDynamicView& view) const { return MatchesKey(view) && MatchesFields(view); }
+
+    std::string ToString() const;
+
+private:
+    struct Predicate {
+        std::string path;
+        BridgeFilterOp op = BridgeFilterOp::kEq;
+        double value = 0.0;
+        int index = -1;
+        bool integer = false;
+    };
+
+    std::vector<std::vector<int64_t>> key_sets_;        // 每组已排序
+    std::vector<std::pair<int64_t, int64_t>> key_ranges_;
+    std::vector<Predicate> predicates_;
+    int key_index_ = -1;
+};
+
+/**
+ * @brief 过滤统计
+ */
+struct BridgeFilterStats {
+    uint64_t passed = 0;                // 通过过滤、已反序列化并分发的样本数
+    uint64_t rejected = 0;              // take后在序列化数据上被拒绝的样本数（未反序列化）
+    uint64_t dropped_in_reader = 0;     // 实例已按key被拒绝，读者存入历史之前即丢弃的样本数
+    uint64_t errors = 0;                // 序列化数据无法按类型定位字段的样本数
+};
+
+/**
+ * @class BridgeReaderFilter
+ * @brief 一个读者的过滤状态：编译后的条件、已按key拒绝的实例表与统计
+ * @note 求值分两级。take路径上每个样本先在序列化数据上求值，只有通过的才反序列化；
+ *       key不满足时记下该样本的实例句柄。读者话题上另挂一个只看样本信息的Cyclone话题过滤器，
+ *       已记下的实例的后续样本在存入读者历史之前即被丢弃，不拷贝、不反序列化、不触发数据到达。
+ *       Cyclone 0.10不把读者过滤条件传给远端写者，同进程写者的样本在写者线程上经过同一过滤器
+ */
+class BridgeReaderFilter {
+public:
+    explicit BridgeReaderFilter(BridgeContentFilter filter) : filter_(std::move(filter)) {}
+
+    BridgeReaderFilter(const BridgeReaderFilter&) = delete;
+    BridgeReaderFilter& operator=(const BridgeReaderFilter&) = delete;
+
+    /**
+     * @brief 按类型T的type_map建立字段表并编译条件
+     */
+    template <typename T>
+    bool Build() {
+        const BridgeTypeDescriptor descriptor = BridgeTypeDescriptorOf<T>();
+        return Build(descriptor.type_map, descriptor.type_name);
+    }
+
+    bool Build(const std::vector<uint8_t>& type_map, const std::string& type_name);
+
+    /**
+     * @brief 在读者专用的话题实体上挂样本信息过滤器，需在创建读者之前调用
+     */
+    bool Install(dds_entity_t topic);
+
+    /**
+     * @brief 摘除Install()挂上的过滤器，之后Cyclone不再回调本对象，需在本对象析构之前调用
+     */
+    void Uninstall(dds_entity_t topic);
+
+    /**
+     * @brief 对一个序列化样本求值并计数
+     * @param view 调用方持有的视图，求值后仍绑定在该样本上
+     * @param instance 样本所属实例，key不满足时记入拒绝表
+     */
+    bool Accept(BridgeDynamicView& view, const uint8_t* payload, size_t size, dds_instance_handle_t instance);
+
+    BridgeFilterStats Stats() const;
+
+    const BridgeDynamicLayout& Layout() const { return layout_; }
+
+private:
+    static constexpr size_t kInstanceSlots = 1024;     // 2的幂；表满时新实例不再提前丢弃，仍在take路径上过滤
+    static constexpr size_t kProbeLimit = 16;
+
+    static bool OnStore(const dds_sample_info_t* info, void* arg);
+
+    void RejectInstance(dds_instance_handle_t instance);
+    bool IsRejected(dds_instance_handle_t instance) const;
+
+    BridgeContentFilter filter_;
+    BridgeDynamicLayout layout_;
+    std::array<std::atomic<uint64_t>, kInstanceSlots> rejected_instances_{};   // 开放寻址，0为空槽
+    std::atomic<uint64_t> passed_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> errors_{0};
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_FILTER_HPP__
@@ -0,0 +1,163 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_INTEGRITY_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_INTEGRITY_HPP__
+
+/**
+ * @file bridge_integrity.hpp
+ * @brief 基于sequence_frame/timestamp字段的丢包、乱序、重复与时效检测
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_metrics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 检测消息类型是否带有@key id字段（机器人IDL类型均为id()）
+ */
+template <typename T, typename = void>
+struct BridgeHasIdKey : std::false_type {};
+
+template <typename T>
+struct BridgeHasIdKey<T, std::void_t<decltype(std::declval<const T&>().id())>> : std::true_type {};
+
+/**
+ * @brief 取消息的key，无key类型返回0
+ */
+template <typename T>
+inline int64_t BridgeMessageKey(const T& msg) {
+    if constexpr (BridgeHasIdKey<T>::value) {
+        return static_cast<int64_t>(msg.id());
+    } else {
+        (void)msg;
+        return 0;
+    }
+}
+
+/**
+ * @brief 检测消息类型是否带有sequence_frame与timestamp字段（机器人IDL类型均有）
+ */
+template <typename T, typename = void>
+struct BridgeHasSequenceStamp : std::false_type {};
+
+template <typename T>
+struct BridgeHasSequenceStamp<T, std::void_t<decltype(std::declval<T&>().sequence_frame(uint64_t())),
+                                             decltype(std::declval<T&>().timestamp(uint64_t())),
+                                             decltype(std::declval<const T&>().sequence_frame()),
+                                             decltype(std::declval<const T&>().timestamp())>>
+    : std::true_type {};
+
+/**
+ * @brief 一次丢包事件
+ */
+struct BridgeLossEvent {
+    int64_t key = 0;                // 消息的@key id，无key类型为0
+    uint64_t expected = 0;          // 期望收到的序号
+    uint64_t received = 0;          // 实际收到的序号
+    uint64_t lost = 0;              // 本次缺失的条数（received - expected）
+};
+
+using BridgeLossCallback = std::function<void(const BridgeLossEvent&)>;
+
+/**
+ * @brief 订阅侧完整性检测配置
+ */
+struct BridgeIntegrityOptions {
+    std::chrono::nanoseconds max_age{0};    // 到达时已超过该时长的样本计为过期，0表示不检查
+    bool drop_stale = false;                // 过期样本不交给回调
+    BridgeLossCallback on_loss;             // 检测到序号缺口时在分发线程上调用，需足够短
+};
+
+/**
+ * @brief 完整性统计
+ */
+struct BridgeIntegrityStats {
+    uint64_t received = 0;          // 参与检测的样本数
+    uint64_t lost = 0;              // 缺失条数（后续迟到的样本会从中扣除）
+    uint64_t reordered = 0;         // 迟到但在窗口内的样本数
+    uint64_t duplicates = 0;        // 重复样本数
+    uint64_t resets = 0;            // 序号大幅回退（发布端重启）的次数
+    uint64_t stale = 0;             // 过期样本数
+    size_t keys = 0;                // 跟踪的key数量
+    BridgeHistogramSnapshot age_ns; // 消息timestamp到分发时刻的时长
+};
+
+/**
+ * @class BridgeSequenceTracker
+ * @brief 按key跟踪序号，区分缺口、乱序与重复
+ * @note 每个key保存最大序号和其之前64个序号的接收位图：更大的序号之间的空缺计为丢失，
+ *       窗口内迟到且未见过的计为乱序并冲减丢失，窗口内已见过的计为重复，
+ *       落后超过窗口或回到序号1（BridgeSequenceStamper的首个值）的视为发布端重启并重新建立基线
+ */
+class BridgeSequenceTracker {
+public:
+    static constexpr uint64_t kWindow = 64;
+
+    explicit BridgeSequenceTracker(const BridgeIntegrityOptions& options);
+
+    /**
+     * @brief 处理一个样本
+     * @param key 消息key
+     * @param sequence 消息序号，0表示发布端未打序号，跳过序号检测
+     * @param timestamp_ns 消息时间戳（纳秒），0表示未打时间戳，跳过时效检测
+     * @param now_ns 分发时刻（与timestamp同一时钟）
+     * @return 样本应当交给回调时返回true（未开启drop_stale或未过期）
+     */
+    bool Observe(int64_t key, uint64_t sequence, uint64_t timestamp_ns, int64_t now_ns);
+
+    BridgeIntegrityStats Stats() const;
+
+private:
+    static constexpr uint64_t kAllSeen = ~0ULL;        // 基线之前的序号不计丢失
+    static constexpr uint64_t kFirstSequence = 1;
+
+    struct KeyState {
+        uint64_t highest = 0;
+        uint64_t window = 0;        // bit i表示序号highest - i已收到
+    };
+
+    BridgeIntegrityOptions options_;
+
+    mutable std::mutex mutex_;      // 可重入回调组下可能被多个工作线程同时调用
+    std::unordered_map<int64_t, KeyState> keys_;
+
+    std::atomic<uint64_t> received_{0};
+    std::atomic<int64_t> lost_{0};
+    std::atomic<uint64_t> reordered_{0};
+    std::atomic<uint64_t> duplicates_{0};
+    std::atomic<uint64_t> resets_{0};
+    std::atomic<uint64_t> stale_{0};
+    BridgeHistogram age_ns_;
+};
+
+/**
+ * @class BridgeSequenceStamper
+ * @brief 发布侧按key生成单调递增序号（从1开始）
+ */
+class BridgeSequenceStamper {
+public:
+    uint64_t Next(int64_t key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ++sequences_[key];
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<int64_t, uint64_t> sequences_;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_INTEGRITY_HPP__
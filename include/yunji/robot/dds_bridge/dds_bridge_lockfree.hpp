@@ -0,0 +1,170 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_LOCKFREE_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_LOCKFREE_HPP__
+
+/**
+ * @file bridge_lockfree.hpp
+ * @brief 桥接层内部使用的无锁定长队列
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+constexpr size_t kBridgeCacheLineSize = 64;
+
+/**
+ * @brief 向上取整到2的幂，便于用掩码取模
+ */
+inline size_t BridgeRoundUpPow2(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ * @class BridgeSpscRing
+ * @brief 单生产者单消费者定长环形队列
+ * @note 消费者身份可以在线程间转移，但转移本身需要由外部的acquire/release同步保证
+ */
+template <typename V>
+class BridgeSpscRing {
+public:
+    explicit BridgeSpscRing(size_t capacity)
+        : capacity_(BridgeRoundUpPow2(capacity == 0 ? 1 : capacity)),
+          mask_(capacity_ - 1),
+          buffer_(new V[capacity_]) {}
+
+    BridgeSpscRing(const BridgeSpscRing&) = delete;
+    BridgeSpscRing& operator=(const BridgeSpscRing&) = delete;
+
+    bool TryPush(const V& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= capacity_) {
+            return false;
+        }
+        buffer_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 原地消费队首元素，避免额外拷贝
+     * @return 队列为空时返回false
+     */
+    template <typename F>
+    bool ConsumeOne(F&& consumer) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        consumer(buffer_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Empty() const {
+        return head_.load(std::memory_order_seq_cst) == tail_.load(std::memory_order_seq_cst);
+    }
+
+    size_t Capacity() const { return capacity_; }
+
+private:
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<V[]> buffer_;
+    alignas(kBridgeCacheLineSize) std::atomic<size_t> head_{0};    // 消费者写
+    alignas(kBridgeCacheLineSize) std::atomic<size_t> tail_{0};    // 生产者写
+};
+
+/**
+ * @class BridgeMpmcQueue
+ * @brief 多生产者多消费者定长队列（基于序号的有界无锁队列）
+ */
+template <typename V>
+class BridgeMpmcQueue {
+public:
+    explicit BridgeMpmcQueue(size_t capacity)
+        : capacity_(BridgeRoundUpPow2(capacity < 2 ? 2 : capacity)),
+          mask_(capacity_ - 1),
+          cells_(new Cell[capacity_]) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BridgeMpmcQueue(const BridgeMpmcQueue&) = delete;
+    BridgeMpmcQueue& operator=(const BridgeMpmcQueue&) = delete;
+
+    bool TryPush(const V& value) {
+        Cell* cell = nullptr;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;       // 队列已满
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(V& value) {
+        Cell* cell = nullptr;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;       // 队列为空
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t Capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        V value{};
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(kBridgeCacheLineSize) std::atomic<size_t> enqueue_pos_{0};
+    alignas(kBridgeCacheLineSize) std::atomic<size_t> dequeue_pos_{0};
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_LOCKFREE_HPP__
@@ -0,0 +1,226 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_METRICS_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_METRICS_HPP__
+
+/**
+ * @file bridge_metrics.hpp
+ * @brief 桥接层每话题的延迟直方图与吞吐统计
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <dds/dds.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 直方图快照，可计算分位数
+ */
+struct BridgeHistogramSnapshot {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets;      // 与BridgeHistogram的桶一一对应
+
+    double Mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+
+    /**
+     * @brief 估算分位数
+     * @param quantile 取值[0,1]，如0.99
+     * @return 所在桶的中值，相对误差约3%
+     */
+    uint64_t Percentile(double quantile) const;
+};
+
+/**
+ * @class BridgeHistogram
+ * @brief 无锁、固定内存的HDR风格直方图（对数分段+段内线性）
+ * @note 每个2的幂区间分32个子桶，相对精度约3%，覆盖0~2^47（纳秒单位约39小时）。
+ *       Record()只有若干次relaxed原子操作，不分配内存，可常开
+ */
+class BridgeHistogram {
+public:
+    static constexpr int kSubBucketBits = 5;
+    static constexpr int kMaxValueBits = 47;
+    static constexpr size_t kLinearBuckets = size_t(1) << (kSubBucketBits + 1);
+    static constexpr size_t kBucketCount =
+        kLinearBuckets + size_t(kMaxValueBits - kSubBucketBits - 1) * (size_t(1) << kSubBucketBits);
+
+    void Record(uint64_t value) {
+        buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+        uint64_t current = max_.load(std::memory_order_relaxed);
+        while (value > current && !max_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+        current = min_.load(std::memory_order_relaxed);
+        while (value < current && !min_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    BridgeHistogramSnapshot Snapshot() const;
+
+    void Reset();
+
+    static size_t BucketIndex(uint64_t value) {
+        if (value < kLinearBuckets) {
+            return static_cast<size_t>(value);
+        }
+        const int msb = 63 - __builtin_clzll(value);
+        if (msb >= kMaxValueBits) {
+            return kBucketCount - 1;
+        }
+        const int shift = msb - kSubBucketBits;
+        const size_t sub = static_cast<size_t>(value >> shift) - (size_t(1) << kSubBucketBits);
+        return kLinearBuckets + size_t(msb - kSubBucketBits - 1) * (size_t(1) << kSubBucketBits) + sub;
+    }
+
+    /**
+     * @brief 桶所覆盖区间的下界
+     */
+    static uint64_t BucketLowerBound(size_t index);
+
+    /**
+     * @brief 桶所覆盖区间的宽度
+     */
+    static uint64_t BucketWidth(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{UINT64_MAX};
+    std::atomic<uint64_t> max_{0};
+};
+
+/**
+ * @brief 消息的CDR序列化字节数（含4字节封装头），用于字节速率统计
+ * @note 定长类型由ddscxx缓存结果，不会重复遍历；计算失败时返回0
+ */
+template <typename T>
+inline uint64_t BridgeSerializedBytes(const T& msg) {
+    size_t size = 0;
+    if (!::get_serialized_size<T, org::eclipse::cyclonedds::core::cdr::basic_cdr_stream>(
+            msg, false, size)) {
+        return 0;
+    }
+    return size + 4;
+}
+
+/**
+ * @brief 端点角色
+ */
+enum class BridgeEndpointKind : uint8_t {
+    kPublisher,
+    kSubscriber
+};
+
+/**
+ * @class BridgeTopicMetrics
+ * @brief 单个桥接端点的统计，发布者/订阅者各持有一份并注册到BridgeFactory
+ */
+class BridgeTopicMetrics {
+public:
+    BridgeTopicMetrics(BridgeEndpointKind kind, const std::string& topic, const std::string& type)
+        : kind_(kind), topic_(topic), type_(type) {}
+
+    void AddMessage(uint64_t bytes) {
+        messages_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 累加发布/接收路径上的堆分配次数（需链接分配钩子，见BridgeAllocTracker）
+     */
+    void AddAllocations(uint64_t count) {
+        if (count != 0) {
+            allocations_.fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 记录底层DataWriter/DataReader句柄，供采集Cyclone内部统计（dds_statistics）
+     * @note 切换分区会重建端点，句柄随之更新
+     */
+    void SetEntity(dds_entity_t entity) { entity_.store(entity, std::memory_order_release); }
+
+    dds_entity_t Entity() const { return entity_.load(std::memory_order_acquire); }
+
+    BridgeEndpointKind Kind() const { return kind_; }
+    const std::string& Topic() const { return topic_; }
+    const std::string& Type() const { return type_; }
+    uint64_t Messages() const { return messages_.load(std::memory_order_relaxed); }
+    uint64_t Bytes() const { return bytes_.load(std::memory_order_relaxed); }
+    uint64_t Allocations() const { return allocations_.load(std::memory_order_relaxed); }
+
+    BridgeHistogram publish_ns;     // 发布者：write()耗时
+    BridgeHistogram latency_ns;     // 订阅者：源时间戳到回调开始的延迟
+    BridgeHistogram callback_ns;    // 订阅者：回调耗时
+
+private:
+    BridgeEndpointKind kind_;
+    std::string topic_;
+    std::string type_;
+    std::atomic<uint64_t> messages_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> allocations_{0};
+    std::atomic<dds_entity_t> entity_{0};
+};
+
+using BridgeTopicMetricsPtr = std::shared_ptr<BridgeTopicMetrics>;
+
+/**
+ * @brief Cyclone内部统计项（如rexmit_bytes、throttle_count、discarded_bytes）
+ * @note 统计项名称和集合由Cyclone版本决定，按原样透传
+ */
+struct BridgeDdsStatistic {
+    std::string name;
+    uint64_t value = 0;
+    double rate = 0.0;              // 距上次快照的增长速率（/秒）
+};
+
+/**
+ * @brief 单个端点的统计快照
+ */
+struct BridgeTopicMetricsSnapshot {
+    BridgeEndpointKind kind = BridgeEndpointKind::kPublisher;
+    std::string topic;
+    std::string type;
+    uint64_t messages = 0;
+    uint64_t bytes = 0;
+    uint64_t allocations = 0;       // 发布：write()内的分配；订阅：take和分发的分配，不含用户回调
+    double message_rate = 0.0;      // 距上次快照的消息速率（条/秒）
+    double byte_rate = 0.0;         // 距上次快照的字节速率（字节/秒）
+    BridgeHistogramSnapshot publish_ns;
+    BridgeHistogramSnapshot latency_ns;
+    BridgeHistogramSnapshot callback_ns;
+    std::vector<BridgeDdsStatistic> dds_statistics;     // 底层DataWriter/DataReader的Cyclone统计
+};
+
+/**
+ * @brief BridgeFactory::Metrics()返回的全局快照
+ */
+struct BridgeMetricsSnapshot {
+    int64_t time_ns = 0;            // 快照时刻（单调时钟）
+    std::vector<BridgeTopicMetricsSnapshot> topics;
+
+    /**
+     * @brief 格式化为便于打印的文本表格
+     */
+    std::string ToString() const;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_METRICS_HPP__
@@ -0,0 +1,268 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_OFFLOAD_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_OFFLOAD_HPP__
+
+/**
+ * @file bridge_offload.hpp
+ * @brief 订阅回调卸载用的工作窃取线程池
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_lockfree.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_integrity.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_metrics.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_trace.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 卸载线程池配置
+ */
+struct BridgeOffloadOptions {
+    size_t num_workers = 2;         // 工作线程数
+    size_t num_strands = 0;         // 按key划分的串行通道数，0表示num_workers * 4
+    size_t strand_capacity = 256;   // 每个通道缓存的样本数
+    size_t strand_budget = 64;      // 工作线程一次连续处理同一通道的样本上限
+};
+
+/**
+ * @brief 卸载线程池统计
+ */
+struct BridgeOffloadStats {
+    uint64_t submitted = 0;             // 分发线程提交的样本数
+    uint64_t processed = 0;             // 工作线程处理完的样本数
+    uint64_t stolen = 0;                // 从其他工作线程窃取的通道调度次数
+    uint64_t backpressure_waits = 0;    // 通道满时分发线程等待的次数
+};
+
+/**
+ * @class BridgeOffloadPool
+ * @brief 将耗时回调从订阅分发线程卸载到多核的工作窃取线程池
+ * @note 样本按key映射到串行通道(strand)，通道内保持FIFO；通道整体作为调度单位进入
+ *       所属工作线程的无锁队列，空闲线程从其他线程的队列窃取整条通道。
+ *       同一时刻一个通道只被一个线程处理，因此同一id的消息不会乱序；
+ *       无key类型按轮询分配通道，不保证顺序。回调会在多个工作线程上并发执行。
+ */
+template <typename T, typename Callback>
+class BridgeOffloadPool {
+public:
+    /**
+     * @param metrics 非空时在工作线程上记录回调耗时callback_ns，并以trace_name记录回调区间
+     */
+    BridgeOffloadPool(const BridgeOffloadOptions& options, Callback& callback,
+                      BridgeTopicMetricsPtr metrics = nullptr, const char* trace_name = nullptr)
+        : options_(options), callback_(callback), metrics_(std::move(metrics)), trace_name_(trace_name) {
+        if (options_.num_workers == 0) {
+            options_.num_workers = 1;
+        }
+        if (options_.num_strands == 0) {
+            options_.num_strands = options_.num_workers * 4;
+        }
+        if (options_.strand_budget == 0) {
+            options_.strand_budget = 1;
+        }
+
+        strands_.reserve(options_.num_strands);
+        for (size_t i = 0; i < options_.num_strands; ++i) {
+            strands_.emplace_back(new Strand(options_.strand_capacity));
+        }
+        for (size_t i = 0; i < options_.num_workers; ++i) {
+            // 队列容量不小于通道总数，每个通道同时至多在一个队列中出现一次，入队不会失败
+            workers_.emplace_back(new Worker(options_.num_strands));
+        }
+        for (size_t i = 0; i < options_.num_workers; ++i) {
+            workers_[i]->thread = std::thread(&BridgeOffloadPool::WorkerLoop, this, i);
+        }
+    }
+
+    ~BridgeOffloadPool() {
+        running_.store(false, std::memory_order_release);
+        sleep_cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+    }
+
+    BridgeOffloadPool(const BridgeOffloadPool&) = delete;
+    BridgeOffloadPool& operator=(const BridgeOffloadPool&) = delete;
+
+    /**
+     * @brief 提交一个样本，只能由单个分发线程调用
+     * @note 对应通道已满时自旋让出，直到工作线程腾出空间（背压）
+     */
+    void Submit(const T& sample) {
+        const size_t index = StrandIndex(sample);
+        Strand& strand = *strands_[index];
+        while (!strand.ring.TryPush(sample)) {
+            ++backpressure_waits_;
+            WakeWorkers();
+            std::this_thread::yield();
+        }
+        ++submitted_;
+        Schedule(index, index % workers_.size());
+    }
+
+    BridgeOffloadStats Stats() const {
+        BridgeOffloadStats stats;
+        stats.submitted = submitted_;
+        stats.backpressure_waits = backpressure_waits_;
+        for (const auto& worker : workers_) {
+            stats.processed += worker->processed.load(std::memory_order_relaxed);
+            stats.stolen += worker->stolen.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+private:
+    struct Strand {
+        explicit Strand(size_t capacity) : ring(capacity) {}
+        BridgeSpscRing<T> ring;
+        std::atomic<bool> scheduled{false};
+    };
+
+    struct Worker {
+        explicit Worker(size_t capacity) : queue(capacity) {}
+        BridgeMpmcQueue<uint32_t> queue;       // 待处理的通道下标
+        std::thread thread;
+        alignas(kBridgeCacheLineSize) std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> stolen{0};
+    };
+
+    size_t StrandIndex(const T& sample) {
+        if constexpr (BridgeHasIdKey<T>::value) {
+            return std::hash<int64_t>()(BridgeMessageKey(sample)) % strands_.size();
+        } else {
+            return round_robin_++ % strands_.size();
+        }
+    }
+
+    void Schedule(size_t strand_index, size_t worker_index) {
+        // 通道从空闲变为待调度时才入队，保证同一通道最多被一个线程持有
+        if (strands_[strand_index]->scheduled.exchange(true, std::memory_order_seq_cst)) {
+            return;
+        }
+        workers_[worker_index]->queue.TryPush(static_cast<uint32_t>(strand_index));
+        if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+            WakeWorkers();
+        }
+    }
+
+    void WakeWorkers() {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.notify_all();
+    }
+
+    bool FindWork(size_t self, uint32_t& strand_index) {
+        if (workers_[self]->queue.TryPop(strand_index)) {
+            return true;
+        }
+        for (size_t i = 1; i < workers_.size(); ++i) {
+            const size_t victim = (self + i) % workers_.size();
+            if (workers_[victim]->queue.TryPop(strand_index)) {
+                workers_[self]->stolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RunStrand(size_t self, uint32_t strand_index) {
+        Strand& strand = *strands_[strand_index];
+        size_t count = 0;
+        while (count < options_.strand_budget &&
+               strand.ring.ConsumeOne([this](const T& sample) { Invoke(sample); })) {
+            ++count;
+        }
+        workers_[self]->processed.fetch_add(count, std::memory_order_relaxed);
+
+        // 释放通道后若仍有剩余样本（预算用尽或释放前有新样本到达），重新调度到本线程
+        strand.scheduled.store(false, std::memory_order_seq_cst);
+        if (!strand.ring.Empty()) {
+            Schedule(strand_index, self);
+        }
+    }
+
+    void Invoke(const T& sample) {
+        const int64_t start = BridgeTracer::NowNs();
+        try {
+            callback_(sample);
+        } catch (const std::exception& e) {
+            std::cerr << "Offload callback error: " << e.what() << std::endl;
+        }
+        if (metrics_) {
+            const int64_t elapsed = BridgeTracer::NowNs() - start;
+            metrics_->callback_ns.Record(static_cast<uint64_t>(elapsed));
+            if (trace_name_ != nullptr) {
+                BridgeTracer::Instance()->Complete(trace_name_, "callback", start, elapsed);
+            }
+        }
+    }
+
+    void WorkerLoop(size_t self) {
+        constexpr int kSpinRounds = 64;
+        int idle_rounds = 0;
+        while (running_.load(std::memory_order_acquire)) {
+            uint32_t strand_index = 0;
+            if (FindWork(self, strand_index)) {
+                RunStrand(self, strand_index);
+                idle_rounds = 0;
+                continue;
+            }
+            if (++idle_rounds < kSpinRounds) {
+                std::this_thread::yield();
+                continue;
+            }
+            // 长时间无任务时睡眠；登记睡眠后再检查一次队列，与Schedule()配合避免丢失唤醒
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            const bool found = FindWork(self, strand_index);
+            if (!found) {
+                sleep_cv_.wait_for(lock, std::chrono::milliseconds(10));
+            }
+            sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+            lock.unlock();
+            if (found) {
+                RunStrand(self, strand_index);
+            }
+            idle_rounds = 0;
+        }
+    }
+
+    BridgeOffloadOptions options_;
+    Callback& callback_;
+    BridgeTopicMetricsPtr metrics_;
+    const char* trace_name_;
+
+    std::vector<std::unique_ptr<Strand>> strands_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::atomic<bool> running_{true};
+    std::atomic<int> sleepers_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+
+    // 以下计数只由分发线程写
+    size_t round_robin_ = 0;
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> backpressure_waits_{0};
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_OFFLOAD_HPP__
@@ -8,6 +8,12 @@
  */
 
 #include "yunji/robot/dds_bridge/dds_bridge_factory.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_trace.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_integrity.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_qos.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_alloc.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_serdata.hpp"
 
 namespace yunji
 {
@@ -32,11 +38,48 @@ public:
     explicit BridgePublisher(const std::string& topic)
         : participant_(BridgeFactory::Instance()->GetParticipant()), topic_name_(topic) {}
 
+    ~BridgePublisher() {
+        if (metrics_) {
+            BridgeFactory::Instance()->UnregisterMetrics(metrics_);
+        }
+    }
+
+    /**
+     * @brief 设置QoS预设，需在InitBridge()之前调用
+     */
+    void SetQosPreset(BridgeQosPreset preset) { qos_preset_ = preset; }
+
+    /**
+     * @brief 设置分区，只与分区匹配的订阅端通信，名称可含通配符'*'、'?'，为空表示默认分区
+     * @note InitBridge()之前调用只记录配置；之后调用在运行时切换。Cyclone不支持修改已启用实体的分区，
+     *       切换时以新分区重建发布者和写者，订阅端需重新匹配，切换期间写出的样本可能丢失。
+     *       不可与Write()并发调用
+     */
+    bool SetPartitions(const std::vector<std::string>& partitions) {
+        partitions_ = partitions;
+        if (!writer_) {
+            return true;
+        }
+        try {
+            CreateWriter();
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Publisher " << topic_name_ << " partition change failed: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    const std::vector<std::string>& Partitions() const { return partitions_; }
+
     bool InitBridge() {
         try {
             topic_ = std::make_shared<dds::topic::Topic<T>>(*participant_, topic_name_);
-            publisher_ = std::make_shared<dds::pub::Publisher>(*participant_);
-            writer_ = std::make_shared<dds::pub::DataWriter<T>>(* publisher_, *topic_);
+            metrics_ = std::make_shared<BridgeTopicMetrics>(BridgeEndpointKind::kPublisher, topic_name_,
+                                                            topic_->type_name());
+            pool_ = BridgeSerdataPool<T>::Create(topic_->delegate()->get_ser_type());
+            CreateWriter();
+            trace_name_ = BridgeTracer::Instance()->Intern(topic_name_);
+            BridgeFactory::Instance()->RegisterMetrics(metrics_);
             return true;
         } catch (const std::exception& e) {
             std::cerr << "Publisher init failed: " << e.what() << std::endl;
@@ -44,9 +87,86 @@ public:
         }
     }
 
+    /**
+     * @brief 开启自动打戳：每次Write()按key填入从1开始的单调sequence_frame，
+     *        并以BridgeClock::WallTime()（纳秒）填入timestamp，覆盖调用方的取值
+     * @note 仅对带sequence_frame/timestamp字段的类型生效，其他类型调用无效果
+     */
+    void EnableStamping() {
+        if constexpr (BridgeHasSequenceStamp<T>::value) {
+            stamper_ = std::make_unique<BridgeSequenceStamper>();
+        }
+    }
+
     bool Write(const T& msg) {
+        if constexpr (BridgeHasSequenceStamp<T>::value) {
+            if (stamper_) {
+                T stamped(msg);     // 定长类型在栈上拷贝，不分配内存
+                stamped.sequence_frame(stamper_->Next(BridgeMessageKey(msg)));
+                stamped.timestamp(static_cast<uint64_t>(BridgeClock::Instance()->WallTime()));
+                return WriteSample(stamped);
+            }
+        }
+        return WriteSample(msg);
+    }
+
+    /**
+     * @brief 当前已匹配的订阅端数量
+     */
+    int32_t MatchedSubscribers() const {
+        return writer_ ? writer_->publication_matched_status().current_count() : 0;
+    }
+
+private:
+    /**
+     * @brief 以当前分区创建发布者和写者，替换掉原有的（若有）
+     */
+    void CreateWriter() {
+        auto publisher = std::make_shared<dds::pub::Publisher>(
+            *participant_, BridgePublisherQos(partitions_, participant_->default_publisher_qos()));
+        auto writer = std::make_shared<dds::pub::DataWriter<T>>(
+            *publisher, *topic_, BridgeWriterQos(qos_preset_, publisher->default_datawriter_qos()));
+        publisher_.swap(publisher);
+        writer_.swap(writer);
+        writer_handle_ = writer_->delegate()->get_ddsc_entity();
+        // 共享内存写者走iceoryx借出路径，不接受池中的serdata
+        use_pool_ = pool_ && !dds_is_shared_memory_available(writer_handle_);
+        metrics_->SetEntity(writer_handle_);
+        if (writer) {
+            writer->close();
+            publisher->close();
+        }
+    }
+
+    bool WriteSample(const T& msg) {
         try {
-            writer_->write(msg);
+            BridgeClock* clock = BridgeClock::Instance();
+            const uint64_t allocations = BridgeAllocTracker::ThreadAllocations();
+            const int64_t start = BridgeTracer::NowNs();
+            // 仿真时间下用仿真时钟作为源时间戳，保证回放和步进运行可复现
+            if (use_pool_) {
+                ddsi_serdata* serdata = pool_->Acquire(msg, clock->IsSimulated() ? clock->WallTime() : dds_time());
+                if (serdata == nullptr) {
+                    std::cerr << "Publish error: serialization failed" << std::endl;
+                    return false;
+                }
+                const dds_return_t ret = dds_forwardcdr(writer_handle_, serdata);
+                if (ret != DDS_RETCODE_OK) {
+                    std::cerr << "Publish error: " << dds_strretcode(ret) << std::endl;
+                    return false;
+                }
+            } else if (clock->IsSimulated()) {
+                const int64_t now = clock->WallTime();
+                writer_->write(msg, dds::core::Time(now / 1000000000LL,
+                                                    static_cast<uint32_t>(now % 1000000000LL)));
+            } else {
+                writer_->write(msg);
+            }
+            const int64_t elapsed = BridgeTracer::NowNs() - start;
+            metrics_->publish_ns.Record(static_cast<uint64_t>(elapsed));
+            BridgeTracer::Instance()->Complete(trace_name_, "write", start, elapsed);
+            metrics_->AddMessage(BridgeSerializedBytes(msg));
+            metrics_->AddAllocations(BridgeAllocTracker::ThreadAllocations() - allocations);
             return true;
         } catch (const std::exception& e) {
             std::cerr << "Publish error: " << e.what() << std::endl;
@@ -54,12 +174,19 @@ public:
         }
     }
 
-private:
     std::shared_ptr<dds::domain::DomainParticipant> participant_;
     std::string topic_name_;
     std::shared_ptr<dds::topic::Topic<T>> topic_;
     std::shared_ptr<dds::pub::Publisher> publisher_;
     std::shared_ptr<dds::pub::DataWriter<T>> writer_;
+    dds_entity_t writer_handle_ = 0;
+    typename BridgeSerdataPool<T>::Ptr pool_;     // 定长类型的发布样本池，不适用时为空
+    bool use_pool_ = false;
+    BridgeQosPreset qos_preset_ = BridgeQosPreset::kDefault;
+    std::vector<std::string> partitions_;
+    BridgeTopicMetricsPtr metrics_;
+    const char* trace_name_ = nullptr;
+    std::unique_ptr<BridgeSequenceStamper> stamper_;
 };
 
 }
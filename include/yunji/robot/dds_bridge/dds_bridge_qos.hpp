@@ -0,0 +1,70 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_QOS_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_QOS_HPP__
+
+/**
+ * @file bridge_qos.hpp
+ * @brief 桥接端点的QoS预设
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <dds/dds.hpp>
+
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief QoS预设，收发两端应使用相同预设
+ */
+enum class BridgeQosPreset : uint8_t {
+    kDefault,       // Cyclone默认（写者可靠、读者尽力而为）
+    kControl,       // 尽力而为、只保留最新1条：控制闭环只关心最新值，不重传过期数据
+    kReliable,      // 可靠、保留最近16条：指令类话题，不容许丢失
+    kTelemetry,     // 尽力而为、保留最近16条：遥测、诊断，允许丢失但要平滑突发
+    kLatched        // 可靠、保留最近1条、TransientLocal：配置/状态类，后加入的订阅者也能拿到最新值
+};
+
+/**
+ * @brief 预设名称（小写，如"control"），用于日志和基准输出
+ */
+const char* BridgeQosPresetName(BridgeQosPreset preset);
+
+/**
+ * @brief 按名称解析预设
+ * @return 名称无效时返回false
+ */
+bool BridgeQosPresetFromName(const std::string& name, BridgeQosPreset& preset);
+
+/**
+ * @brief 在给定的默认写者QoS上应用预设
+ */
+dds::pub::qos::DataWriterQos BridgeWriterQos(BridgeQosPreset preset, dds::pub::qos::DataWriterQos qos);
+
+/**
+ * @brief 在给定的默认读者QoS上应用预设
+ */
+dds::sub::qos::DataReaderQos BridgeReaderQos(BridgeQosPreset preset, dds::sub::qos::DataReaderQos qos);
+
+/**
+ * @brief 在给定的默认发布者QoS上设置分区
+ * @param partitions 分区名，可含通配符'*'、'?'（如"robot3*"）；为空时保持默认分区""
+ * @note 两端都含通配符的分区名互不匹配
+ */
+dds::pub::qos::PublisherQos BridgePublisherQos(const std::vector<std::string>& partitions,
+                                               dds::pub::qos::PublisherQos qos);
+
+/**
+ * @brief 在给定的默认订阅者QoS上设置分区，规则同BridgePublisherQos
+ */
+dds::sub::qos::SubscriberQos BridgeSubscriberQos(const std::vector<std::string>& partitions,
+                                                 dds::sub::qos::SubscriberQos qos);
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_QOS_HPP__
@@ -0,0 +1,116 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_RECORD_CODEC_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_RECORD_CODEC_HPP__
+
+/**
+ * @file bridge_record_codec.hpp
+ * @brief 录制样本的逐字段增量/量化编码
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_type.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @class BridgeDeltaCodec
+ * @brief 定长类型样本相对同一话题上一条样本的逐字段编码
+ * @note 字段按type_map展开后定位：整数（含时间戳、帧序号）用二阶差分预测，浮点数与上一值按位异或，
+ *       设置量化步长时浮点数先量化为整数再做二阶差分，重建误差不超过步长的一半。
+ *       残差为0的字段只占位图中的1位，其余残差按zigzag变长整数存储。
+ *       编码端与解码端按同样的规则维护基准（上一条样本的重建结果），关键帧原样存储并重置基准；
+ *       录制时每个索引项都落在关键帧上，按索引跳转后即可独立解码
+ */
+class BridgeDeltaCodec {
+public:
+    /**
+     * @brief 按type_map初始化
+     * @param quantization 浮点字段量化步长，0为无损
+     * @return 类型无法解析或不是定长类型时返回false，该话题应原样录制
+     */
+    bool Init(const std::vector<uint8_t>& type_map, const std::string& type_name, double quantization);
+
+    double Quantization() const { return quantization_; }
+
+    /**
+     * @brief 清除基准，下一条样本必须为关键帧（新分段开头、读取端跳转后）
+     */
+    void Reset() { has_base_ = false; }
+
+    bool HasBase() const { return has_base_; }
+
+    /**
+     * @brief 编码输出的最大字节数
+     */
+    size_t MaxEncodedSize() const { return (fields_.size() + 7) / 8 + fields_.size() * 10; }
+
+    /**
+     * @brief 编码一条样本（含4字节封装头），out至少有MaxEncodedSize()字节
+     * @param keyframe 要求作为关键帧
+     * @return 编码后的字节数；返回0表示应作为关键帧原样存储（此时已以该样本为基准）
+     */
+    size_t Encode(const uint8_t* payload, size_t size, bool keyframe, uint8_t* out);
+
+    /**
+     * @brief 解码端遇到关键帧时以其为基准
+     */
+    void SetBase(const uint8_t* payload, size_t size);
+
+    /**
+     * @brief 把增量记录应用到基准上，结果见Base()
+     * @return 没有基准或数据损坏时返回false
+     */
+    bool Decode(const uint8_t* data, size_t size);
+
+    /**
+     * @brief 当前基准，即最近一条样本的重建结果（含封装头）
+     */
+    const std::vector<uint8_t>& Base() const { return base_; }
+
+private:
+    enum class Mode : uint8_t {
+        kInteger,       // 二阶差分
+        kXor,           // 与上一值按位异或
+        kQuantized      // 量化为整数后二阶差分
+    };
+
+    struct Field {
+        uint32_t offsets[2];        // XCDR1/XCDR2中相对数据起点的偏移
+        uint8_t size;
+        Mode mode;
+    };
+
+    struct State {
+        uint64_t value = 0;         // 整数值、浮点位模式或量化值
+        int64_t delta = 0;          // 上一次的一阶差分
+    };
+
+    bool Residuals(const uint8_t* payload, std::vector<uint64_t>& values) const;
+    void Rebase(const uint8_t* payload, size_t size);
+    void Apply(const std::vector<uint64_t>& values);
+
+    std::vector<Field> fields_;
+    std::vector<std::pair<uint32_t, uint32_t>> gaps_[2];    // 字段之外的字节区间（填充、DHEADER）
+    uint32_t fixed_size_[2] = {0, 0};
+    double quantization_ = 0.0;
+
+    bool has_base_ = false;
+    bool xcdr2_ = false;
+    bool swap_ = false;
+    uint32_t run_ = 0;                  // 自上一关键帧以来的增量记录数
+    std::vector<uint8_t> base_;
+    std::vector<State> states_;
+    std::vector<uint64_t> values_;      // 编码/解码过程中的新值
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_RECORD_CODEC_HPP__
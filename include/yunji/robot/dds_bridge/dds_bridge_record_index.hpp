@@ -0,0 +1,173 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_RECORD_INDEX_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_RECORD_INDEX_HPP__
+
+/**
+ * @file bridge_record_index.hpp
+ * @brief 录制分段的稀疏时间索引与键索引
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+constexpr uint32_t kBridgeIndexMagic = 0x594A5249;        // "YJRI"
+constexpr uint32_t kBridgeIndexVersion = 1;
+
+/**
+ * @brief 索引文件头，其后依次为time_entries个时间索引项和key_entries个键索引项
+ * @note 索引文件与分段同名、扩展名为.yjidx，分段关闭时写出；segment_bytes与分段的used_bytes不一致时索引已过期
+ */
+struct BridgeIndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t lane;
+    uint32_t sequence;
+    uint64_t segment_bytes;     // 建立索引时分段的used_bytes
+    int64_t interval_ns;        // 相邻索引项的最小时间间隔
+    uint64_t time_entries;
+    uint64_t key_entries;
+    uint8_t reserved[16];
+};
+
+/**
+ * @brief 时间索引项，按(topic_id, receive_ns)排序
+ */
+struct BridgeTimeIndexEntry {
+    uint16_t topic_id;
+    uint16_t reserved;
+    uint32_t reserved2;
+    int64_t receive_ns;
+    uint64_t offset;            // 该话题在receive_ns时刻的第一条记录
+};
+
+/**
+ * @brief 键索引项，按(topic_id, key, receive_ns)排序，只为带@key的话题建立
+ */
+struct BridgeKeyIndexEntry {
+    uint64_t key;
+    uint16_t topic_id;
+    uint16_t reserved;
+    uint32_t reserved2;
+    int64_t receive_ns;
+    uint64_t offset;
+};
+
+static_assert(sizeof(BridgeIndexHeader) == 64, "index header layout");
+static_assert(sizeof(BridgeTimeIndexEntry) == 24, "time index entry layout");
+static_assert(sizeof(BridgeKeyIndexEntry) == 32, "key index entry layout");
+
+/**
+ * @brief 分段文件对应的索引文件路径
+ */
+std::string BridgeIndexPath(const std::string& segment_path);
+
+/**
+ * @class BridgeIndexBuilder
+ * @brief 随录制增量建立稀疏索引
+ * @note 每个话题（以及话题的每个键）距上一个索引项超过interval才追加新项，
+ *       索引大小与录制时长成正比而与样本率无关；Add()只做比较和追加，排序留到Write()。
+ *       各数组和键表的容量跨分段保留，Reset()按分段时长预留，稳态下Add()不分配内存；
+ *       只有首个分段或键数超过以往最大值时才会扩容
+ */
+class BridgeIndexBuilder {
+public:
+    /**
+     * @brief 清空并开始新分段的索引
+     * @param topic_count 话题id上限
+     * @param duration_ns 分段最长时长，用于预留索引项，0为不预留（沿用上一分段留下的容量）
+     */
+    void Reset(int64_t interval_ns, size_t topic_count, int64_t duration_ns = 0);
+
+    /**
+     * @return 为该记录新增了时间或键索引项时返回true，录制端据此把该记录编码为关键帧
+     */
+    bool Add(uint16_t topic_id, bool keyed, uint64_t key, int64_t receive_ns, uint64_t offset);
+
+    /**
+     * @brief 排序并写出索引文件，先写临时文件再改名，崩溃时不会留下不完整的索引
+     */
+    bool Write(const std::string& path, const BridgeSegmentHeader& segment, uint64_t segment_bytes);
+
+    /**
+     * @brief 扫描分段重建索引（用于录制进程崩溃后留下的无索引分段）
+     */
+    bool Rebuild(const std::string& segment_path, int64_t interval_ns);
+
+    size_t TimeEntries() const { return time_entries_.size(); }
+    size_t KeyEntries() const { return key_entries_.size(); }
+
+private:
+    struct KeySlot {
+        uint64_t key = 0;
+        int64_t last_ns = 0;        // 该键最近一个索引项的时刻
+        uint16_t topic_id = 0;
+        bool used = false;
+    };
+
+    KeySlot& FindKey(uint16_t topic_id, uint64_t key);
+    void GrowKeys();
+
+    int64_t interval_ns_ = 0;
+    std::vector<int64_t> topic_last_ns_;            // 每个话题最近一个索引项的时刻，按id下标
+    std::vector<KeySlot> key_slots_;                // 开放寻址键表，容量为2的幂，装载率不超过1/2
+    size_t key_count_ = 0;
+    std::vector<BridgeTimeIndexEntry> time_entries_;
+    std::vector<BridgeKeyIndexEntry> key_entries_;
+};
+
+/**
+ * @class BridgeSegmentIndex
+ * @brief 以只读映射方式打开索引文件，二分查找定位记录偏移
+ * @note 查到的偏移交给BridgeSegmentReader::Seek()，从该处顺序读取并跳过receive_ns早于目标的记录，
+ *       跳过的数据量不超过一个索引间隔
+ */
+class BridgeSegmentIndex {
+public:
+    BridgeSegmentIndex() = default;
+    ~BridgeSegmentIndex();
+
+    BridgeSegmentIndex(const BridgeSegmentIndex&) = delete;
+    BridgeSegmentIndex& operator=(const BridgeSegmentIndex&) = delete;
+
+    /**
+     * @brief 打开索引文件
+     * @param segment 对应的分段，用于校验索引是否与分段一致，可为nullptr
+     */
+    bool Open(const std::string& path, const BridgeSegmentHeader* segment = nullptr);
+
+    void Close();
+
+    const BridgeIndexHeader& Header() const { return *header_; }
+
+    /**
+     * @brief 话题在time_ns时刻或之前最近的索引项偏移，time_ns早于第一项时返回第一项
+     * @return 索引中没有该话题时返回false
+     */
+    bool SeekTime(uint16_t topic_id, int64_t time_ns, uint64_t& offset) const;
+
+    /**
+     * @brief 话题中键为key的实例在time_ns时刻或之前最近的索引项偏移
+     */
+    bool SeekKey(uint16_t topic_id, uint64_t key, int64_t time_ns, uint64_t& offset) const;
+
+private:
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    const BridgeIndexHeader* header_ = nullptr;
+    const BridgeTimeIndexEntry* time_entries_ = nullptr;
+    const BridgeKeyIndexEntry* key_entries_ = nullptr;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_RECORD_INDEX_HPP__
@@ -0,0 +1,346 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_RECORDER_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_RECORDER_HPP__
+
+/**
+ * @file bridge_recorder.hpp
+ * @brief 话题录制：原始CDR样本顺序写入预分配的内存映射分段文件
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_factory.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_record_codec.hpp"
+#include "org/eclipse/cyclonedds/topic/datatopic.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+constexpr uint32_t kBridgeRecordMagic = 0x594A5243;       // "YJRC"
+constexpr uint32_t kBridgeRecordVersion = 3;
+constexpr uint32_t kBridgeRecordMinVersion = 2;           // 读取端兼容的最早版本（无增量记录）
+constexpr size_t kBridgeRecordAlignment = 8;
+
+/**
+ * @brief 分段文件头，位于文件偏移0
+ * @note 录制过程中每写完一批更新used_bytes/records/end_ns；录制进程异常退出时以记录头kind为0处为结尾
+ */
+struct BridgeSegmentHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t lane;              // 写入通道号
+    uint32_t sequence;          // 通道内的分段序号，从0开始
+    int64_t start_ns;           // 分段创建时刻（墙上时间）
+    int64_t end_ns;             // 最后一条样本的接收时刻
+    uint64_t used_bytes;        // 已写入字节数（含文件头）
+    uint64_t records;           // 样本记录数（不含话题记录）
+    int64_t session_ns;         // 所属录制会话的Start()时刻（墙上时间），早期版本的文件为0
+    uint8_t reserved[8];
+};
+
+enum class BridgeRecordKind : uint16_t {
+    kEnd = 0,                   // 预分配区域的零填充，表示没有更多记录
+    kTopic = 1,                 // 话题描述，每个分段开头为本通道的每个话题写一条
+    kSample = 2,                // 原始CDR样本（含4字节封装头）
+    kDelta = 3                  // 相对同一话题上一条样本的增量编码（见BridgeDeltaCodec）
+};
+
+/**
+ * @brief 记录头，记录按8字节对齐，payload紧随其后
+ */
+struct BridgeRecordHeader {
+    uint32_t size;              // payload字节数（不含对齐填充）
+    uint16_t kind;              // BridgeRecordKind
+    uint16_t topic_id;
+    int64_t source_ns;          // 发布端源时间戳
+    int64_t receive_ns;         // 录制端接收时刻
+    uint64_t key;               // 样本键值的哈希（见BridgeRecordKeyOf），无键话题为常量
+};
+
+/**
+ * @brief 话题记录payload的定长部分，其后依次为话题名、类型名、type_map、type_info，
+ *        带kBridgeTopicDelta时最后是8字节的量化步长（double）
+ */
+struct BridgeTopicRecordHeader {
+    uint64_t type_hash;         // type_info（无类型信息时为类型名）的FNV-1a哈希
+    uint16_t name_size;
+    uint16_t type_name_size;
+    uint32_t type_map_size;     // ddscxx生成的XTypes TypeMapping，可用于离线解析样本
+    uint32_t type_info_size;
+    uint32_t flags;             // kBridgeTopicKeyed等
+};
+
+constexpr uint32_t kBridgeTopicKeyed = 1u << 0;     // 话题类型带@key成员，记录的key可区分实例
+constexpr uint32_t kBridgeTopicDelta = 1u << 1;     // 话题样本按BridgeDeltaCodec编码，可能出现kDelta记录
+
+static_assert(sizeof(BridgeSegmentHeader) == 64, "segment header layout");
+static_assert(sizeof(BridgeRecordHeader) == 32, "record header layout");
+static_assert(sizeof(BridgeTopicRecordHeader) == 24, "topic record header layout");
+
+inline uint64_t BridgeFnv1a(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief 由DDS键哈希（键成员的大端XCDR2序列化，超过16字节时为MD5）得到记录中的key
+ */
+inline uint64_t BridgeRecordKey(const ddsi_keyhash_t& keyhash) {
+    return BridgeFnv1a(keyhash.value, sizeof(keyhash.value));
+}
+
+/**
+ * @brief 样本的记录key，用于按键查询索引，例如只设置了id的探测样本
+ */
+template <typename T>
+uint64_t BridgeRecordKeyOf(const T& sample) {
+    ddsi_keyhash_t keyhash;
+    ::to_key(sample, keyhash);
+    return BridgeRecordKey(keyhash);
+}
+
+/**
+ * @brief 录制的类型描述
+ */
+struct BridgeTypeDescriptor {
+    std::string type_name;
+    uint64_t type_hash = 0;
+    bool keyed = false;
+    std::vector<uint8_t> type_map;
+    std::vector<uint8_t> type_info;
+};
+
+template <typename T>
+BridgeTypeDescriptor BridgeTypeDescriptorOf() {
+    using Traits = org::eclipse::cyclonedds::topic::TopicTraits<T>;
+    BridgeTypeDescriptor descriptor;
+    descriptor.type_name = Traits::getTypeName();
+    descriptor.keyed = !Traits::isKeyless();
+#ifdef DDSCXX_HAS_TYPE_DISCOVERY
+    descriptor.type_map.assign(Traits::type_map_blob(), Traits::type_map_blob() + Traits::type_map_blob_sz());
+    descriptor.type_info.assign(Traits::type_info_blob(), Traits::type_info_blob() + Traits::type_info_blob_sz());
+#endif
+    descriptor.type_hash = descriptor.type_info.empty()
+        ? BridgeFnv1a(descriptor.type_name.data(), descriptor.type_name.size())
+        : BridgeFnv1a(descriptor.type_info.data(), descriptor.type_info.size());
+    return descriptor;
+}
+
+/**
+ * @brief 录制样本的编码方式
+ */
+enum class BridgeRecordCodec : uint8_t {
+    kRaw,           // 原样存储CDR
+    kDelta          // 定长类型逐字段增量编码，每个索引项处为关键帧；非定长类型仍原样存储
+};
+
+/**
+ * @brief 录制配置
+ */
+struct BridgeRecorderOptions {
+    std::string directory = ".";                    // 输出目录，不存在时创建（仅一级）
+    std::string prefix = "yjrec";                   // 文件名为<prefix>_<会话开始时间>_<lane>_<sequence>.yjrec
+    size_t lanes = 2;                               // 写入通道（线程）数，话题按添加顺序轮流分配
+    size_t segment_bytes = 64u << 20;               // 分段大小，创建时整体预分配
+    std::chrono::seconds segment_duration{60};      // 分段最长时长，0为只按大小切分
+    size_t writeback_bytes = 4u << 20;              // 每写入这么多字节就异步下发一次回写，平滑SD卡写入
+    uint32_t reader_depth = 256;                    // 录制读者的历史深度，分段切换期间由它缓冲
+    std::chrono::milliseconds index_interval{100};  // 稀疏索引间隔，0为不生成索引文件
+    bool reliable = false;                          // 录制读者默认尽力而为，不对发布端形成背压
+    BridgeRecordCodec codec = BridgeRecordCodec::kRaw;
+    double quantization = 0.0;                      // kDelta时浮点字段的量化步长，0为无损
+    std::vector<std::string> partitions;            // 录制读者所在分区，可含通配符，空为默认分区
+};
+
+/**
+ * @brief 录制统计
+ */
+struct BridgeRecorderStats {
+    uint64_t records = 0;           // 已写入的样本数
+    uint64_t bytes = 0;             // 已写入的字节数（含记录头和话题记录）
+    uint64_t raw_bytes = 0;         // 样本按原样存储时应写入的字节数，与bytes之比约为压缩比
+    uint64_t segments = 0;          // 已创建的分段数
+    uint64_t lost = 0;              // 读者报告的丢失样本数（历史溢出、尽力而为丢包）
+    uint64_t errors = 0;            // 分段创建失败等导致未写入的样本数
+};
+
+/**
+ * @class BridgeRecorder
+ * @brief 飞行记录仪式的话题录制器
+ * @note 录制读者通过dds_takecdr直接取出序列化数据，不做反序列化，数据从serdata一次拷贝进映射内存。
+ *       每个通道一个线程，独占自己的分段文件，写路径不加锁，稳态下不分配内存（分段切换和索引的首次扩容除外）。
+ *       同进程内的读者由发布线程直接投递，录制对控制环要求严格时应在单独进程中运行（见yj_bridge_record）
+ */
+class BridgeRecorder {
+public:
+    explicit BridgeRecorder(const BridgeRecorderOptions& options = BridgeRecorderOptions());
+    ~BridgeRecorder();
+
+    BridgeRecorder(const BridgeRecorder&) = delete;
+    BridgeRecorder& operator=(const BridgeRecorder&) = delete;
+
+    /**
+     * @brief 添加录制话题，需在Start()之前调用
+     * @return 话题创建失败、重复添加或已启动时返回false
+     */
+    template <typename T>
+    bool AddTopic(const std::string& topic) {
+        try {
+            auto participant = BridgeFactory::Instance()->GetParticipant();
+            auto dds_topic = std::make_shared<dds::topic::Topic<T>>(*participant, topic);
+            return AddTopicEntity(topic, BridgeTypeDescriptorOf<T>(), dds_topic->delegate()->get_ddsc_entity(),
+                                  dds_topic);
+        } catch (const std::exception& e) {
+            std::cerr << "Recorder topic " << topic << " failed: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    /**
+     * @brief 创建录制读者并启动各通道线程
+     */
+    bool Start();
+
+    /**
+     * @brief 停止录制，关闭当前分段并截断到实际长度
+     */
+    void Stop();
+
+    BridgeRecorderStats Stats() const;
+
+private:
+    struct Topic;
+    struct Lane;
+
+    bool AddTopicEntity(const std::string& topic, BridgeTypeDescriptor type, dds_entity_t topic_entity,
+                        std::shared_ptr<void> keepalive);
+    void Run(Lane& lane);
+    size_t Drain(Lane& lane, Topic& topic);
+    uint8_t* Reserve(Lane& lane, size_t payload_size);
+    void Commit(Lane& lane, size_t payload_size, size_t raw_size);
+    bool OpenSegment(Lane& lane, size_t min_bytes);
+    void CloseSegment(Lane& lane);
+    void WriteTopicRecord(Lane& lane, const Topic& topic);
+
+    BridgeRecorderOptions options_;
+    std::vector<std::unique_ptr<Topic>> topics_;
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    dds_entity_t subscriber_ = 0;   // 设置了分区时录制读者所属的订阅者
+    int64_t session_ns_ = 0;        // 本次Start()的时刻，写入分段头并用于文件名
+    std::string session_;           // 文件名中的会话部分，YYYYMMDD-HHMMSS
+    std::atomic<bool> running_{false};
+
+    std::atomic<uint64_t> records_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> raw_bytes_{0};
+    std::atomic<uint64_t> segments_{0};
+    std::atomic<uint64_t> errors_{0};
+};
+
+/**
+ * @brief 分段文件中的话题描述
+ */
+struct BridgeRecordedTopic {
+    uint16_t id = 0;
+    std::string name;
+    BridgeTypeDescriptor type;
+    BridgeRecordCodec codec = BridgeRecordCodec::kRaw;
+    double quantization = 0.0;
+};
+
+/**
+ * @brief 分段文件中的一条样本，payload指向映射内存，在读取器关闭前有效；
+ *        增量记录解码后的payload指向读取器内部缓冲，在读取同一话题的下一条样本前有效
+ */
+struct BridgeRecordedSample {
+    uint16_t topic_id = 0;
+    int64_t source_ns = 0;
+    int64_t receive_ns = 0;
+    uint64_t key = 0;
+    const uint8_t* payload = nullptr;
+    uint32_t size = 0;
+    uint32_t stored_size = 0;       // 记录中实际存储的字节数，增量记录小于size
+    bool delta = false;             // 由增量记录解码得到，不能作为随机访问的起点
+    uint64_t offset = 0;            // 记录头在文件中的偏移
+};
+
+/**
+ * @class BridgeSegmentReader
+ * @brief 以只读映射方式顺序读取分段文件
+ */
+class BridgeSegmentReader {
+public:
+    BridgeSegmentReader() = default;
+    ~BridgeSegmentReader();
+
+    BridgeSegmentReader(const BridgeSegmentReader&) = delete;
+    BridgeSegmentReader& operator=(const BridgeSegmentReader&) = delete;
+
+    /**
+     * @brief 打开分段文件，校验文件头
+     */
+    bool Open(const std::string& path);
+
+    void Close();
+
+    const BridgeSegmentHeader& Header() const { return *header_; }
+
+    /**
+     * @brief 读取下一条样本，途经的新话题记录登记进Topics()
+     * @note 增量记录在解码后返回；跳转后到该话题的下一个关键帧之前的增量记录无法解码，直接跳过
+     * @return 到达结尾或遇到损坏记录时返回false
+     */
+    bool Next(BridgeRecordedSample& sample);
+
+    /**
+     * @brief 从指定偏移处读取一条样本（用于按索引随机访问），增量记录返回false
+     */
+    bool ReadAt(uint64_t offset, BridgeRecordedSample& sample) const;
+
+    /**
+     * @brief 回到第一条记录
+     */
+    void Rewind() { Seek(sizeof(BridgeSegmentHeader)); }
+
+    /**
+     * @brief 从指定偏移处继续顺序读取，偏移通常来自BridgeSegmentIndex
+     * @note 增量编码的话题从各自的下一个关键帧开始解码，索引项都指向关键帧
+     */
+    void Seek(uint64_t offset);
+
+    /**
+     * @brief 分段中的话题，Open()时从分段开头的话题记录读取，按id查找
+     */
+    const std::vector<BridgeRecordedTopic>& Topics() const { return topics_; }
+
+    const BridgeRecordedTopic* FindTopic(uint16_t id) const;
+
+private:
+    bool ParseRecord(uint64_t offset, const BridgeRecordHeader*& header) const;
+    void AddTopicRecord(const BridgeRecordHeader& header, const uint8_t* payload);
+    void FillSample(uint64_t offset, const BridgeRecordHeader& header, BridgeRecordedSample& sample) const;
+
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    const BridgeSegmentHeader* header_ = nullptr;
+    uint64_t cursor_ = 0;
+    std::vector<BridgeRecordedTopic> topics_;
+    std::vector<std::unique_ptr<BridgeDeltaCodec>> codecs_;    // 按话题id下标，非增量编码的话题为nullptr
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_RECORDER_HPP__
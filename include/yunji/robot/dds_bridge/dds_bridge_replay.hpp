@@ -0,0 +1,150 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_REPLAY_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_REPLAY_HPP__
+
+/**
+ * @file bridge_replay.hpp
+ * @brief 录制回放：按原始节奏（可缩放）或尽可能快地重新发布原始CDR样本
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_qos.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 回放样本的源时间戳
+ */
+enum class BridgeReplayTimestamps : uint8_t {
+    kOriginal,      // 沿用录制时的发布端源时间戳
+    kRewrite        // 以回放时的BridgeClock::WallTime()重新打戳（仿真时间下即录制时的接收时刻）
+};
+
+/**
+ * @brief 回放配置
+ */
+struct BridgeReplayOptions {
+    double rate = 1.0;                  // 回放倍率（如0.1~100），0为尽可能快
+    BridgeReplayTimestamps timestamps = BridgeReplayTimestamps::kOriginal;
+    int64_t start_ns = 0;               // 只回放接收时刻不早于start_ns的样本，0为从头开始；有索引时直接跳转
+    int64_t end_ns = 0;                 // 只回放接收时刻早于end_ns的样本，0为到结尾
+    /**
+     * @brief kStepping模式的执行器：仿真时钟跟随录制的接收时刻推进，每批样本写出后SpinUntilIdle()，
+     *        被测控制器的回调与定时器按录制时间线确定性地执行；此时忽略rate
+     */
+    std::shared_ptr<BridgeExecutor> executor;
+};
+
+/**
+ * @brief 回放统计
+ */
+struct BridgeReplayStats {
+    uint64_t samples = 0;           // 已发布的样本数
+    uint64_t bytes = 0;             // 已发布的CDR字节数
+    uint64_t skipped = 0;           // 未添加回放话题或类型不一致而跳过的样本数
+    uint64_t errors = 0;            // 构造或发布失败的样本数
+    int64_t recording_ns = 0;       // 已回放的录制时长
+};
+
+/**
+ * @class BridgeReplayer
+ * @brief 把录制分段重新发布到DDS
+ * @note 多个通道的分段按接收时刻归并，时刻相同时按通道号、再按通道内的写入顺序，同一组文件每次回放顺序一致。
+ *       样本不经反序列化由dds_forwardcdr直接发布，源时间戳由本类设置。
+ *       按原始节奏回放时以第一条样本为基准计算每批样本的发布时刻，调度误差不累积
+ */
+class BridgeReplayer {
+public:
+    explicit BridgeReplayer(const BridgeReplayOptions& options = BridgeReplayOptions());
+    ~BridgeReplayer();
+
+    BridgeReplayer(const BridgeReplayer&) = delete;
+    BridgeReplayer& operator=(const BridgeReplayer&) = delete;
+
+    /**
+     * @brief 添加回放话题，需在Run()之前调用
+     * @param recorded_topic 录制时的话题名
+     * @param output_topic 回放发布的话题名，为空时与录制时相同
+     * @return 写者创建失败或重复添加时返回false
+     */
+    template <typename T>
+    bool AddTopic(const std::string& recorded_topic, const std::string& output_topic = "",
+                  BridgeQosPreset preset = BridgeQosPreset::kDefault) {
+        try {
+            auto participant = BridgeFactory::Instance()->GetParticipant();
+            auto endpoint = std::make_shared<Endpoint<T>>(*participant,
+                                                          output_topic.empty() ? recorded_topic : output_topic, preset);
+            return AddWriter(recorded_topic, BridgeTypeDescriptorOf<T>(),
+                             endpoint->writer.delegate()->get_ddsc_entity(),
+                             endpoint->topic.delegate()->get_ser_type(), endpoint);
+        } catch (const std::exception& e) {
+            std::cerr << "Replay topic " << recorded_topic << " failed: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    /**
+     * @brief 回放一组分段文件，阻塞直到回放结束或Stop()
+     * @param segments 分段文件路径，可以来自多个通道，顺序任意
+     * @return 没有可读分段时返回false
+     */
+    bool Run(const std::vector<std::string>& segments);
+
+    /**
+     * @brief 请求停止，可在其他线程或信号处理中调用
+     */
+    void Stop() { stop_.store(true, std::memory_order_release); }
+
+    BridgeReplayStats Stats() const;
+
+private:
+    template <typename T>
+    struct Endpoint {
+        Endpoint(const dds::domain::DomainParticipant& participant, const std::string& name, BridgeQosPreset preset)
+            : topic(participant, name), publisher(participant),
+              writer(publisher, topic, BridgeWriterQos(preset, publisher.default_datawriter_qos())) {}
+
+        dds::topic::Topic<T> topic;
+        dds::pub::Publisher publisher;
+        dds::pub::DataWriter<T> writer;
+    };
+
+    struct Writer;
+    struct Lane;
+
+    bool AddWriter(const std::string& recorded_topic, BridgeTypeDescriptor type, dds_entity_t writer,
+                   ddsi_sertype* sertype, std::shared_ptr<void> keepalive);
+    bool OpenNext(Lane& lane);
+    bool Advance(Lane& lane);
+    void Publish(Lane& lane);
+    void WaitUntil(int64_t recording_ns);
+
+    BridgeReplayOptions options_;
+    std::vector<std::unique_ptr<Writer>> writers_;
+    std::atomic<bool> stop_{false};
+
+    int64_t first_ns_ = 0;                  // 第一条样本的接收时刻
+    int64_t wall_start_ns_ = 0;             // 回放开始时的单调时间
+
+    std::atomic<uint64_t> samples_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> skipped_{0};
+    std::atomic<uint64_t> errors_{0};
+    std::atomic<int64_t> recording_ns_{0};
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_REPLAY_HPP__
@@ -0,0 +1,235 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_SERDATA_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_SERDATA_HPP__
+
+/**
+ * @file bridge_serdata.hpp
+ * @brief 定长类型的序列化样本池，发布路径稳态下不分配内存
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "dds/dds.h"
+#include "org/eclipse/cyclonedds/topic/datatopic.hpp"
+#include "org/eclipse/cyclonedds/topic/hash.hpp"
+
+#include <dds/ddsc/dds_loan_api.h>
+#include <dds/ddsi/ddsi_serdata.h>
+#include <dds/ddsrt/md5.h>
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @class BridgeSerdataPool
+ * @brief 复用ddscxx_serdata<T>对象的发布样本池，样本序列化进池中对象后经dds_forwardcdr写出
+ * @note ddscxx每次write都新建serdata、CDR缓冲、样本副本和key缓冲。池中对象在首次使用时分配这些内存，
+ *       之后只覆盖内容：key按ddscxx的规则在对象自带的缓冲里计算，样本副本用赋值更新。
+ *       除释放外沿用ddscxx的serdata操作，因此与ddscxx产生的样本可比较key，同进程读者直接引用池中对象；
+ *       最后一个引用（写者历史、读者缓存）释放时对象回到池中。
+ *       只支持定长类型且话题使用ddscxx的XCDR1 sertype，否则Create()返回空，调用方退回ddscxx的write。
+ *       所有者销毁池后，借出的对象仍然有效，全部归还时池才释放
+ */
+template <typename T>
+class BridgeSerdataPool {
+public:
+    struct Closer {
+        void operator()(BridgeSerdataPool* pool) const { pool->Close(); }
+    };
+    using Ptr = std::unique_ptr<BridgeSerdataPool, Closer>;
+
+    /**
+     * @param type 话题的sertype，即写者写出样本所用的类型
+     */
+    static Ptr Create(const ddsi_sertype* type) {
+        using Sertype = ddscxx_sertype<T, basic_cdr_stream>;
+        if (!TopicTraits<T>::isSelfContained() || type == nullptr ||
+            type->serdata_ops != &Sertype::serdata_ops) {
+            return Ptr();
+        }
+        Ptr pool(new BridgeSerdataPool(type));
+        return pool->Measure() ? std::move(pool) : Ptr();
+    }
+
+    BridgeSerdataPool(const BridgeSerdataPool&) = delete;
+    BridgeSerdataPool& operator=(const BridgeSerdataPool&) = delete;
+
+    /**
+     * @brief 把样本序列化进一个池中对象
+     * @param timestamp 源时间戳（纳秒）
+     * @return 引用计数为1的serdata，交给dds_forwardcdr（接管该引用）；序列化失败时为nullptr
+     */
+    ddsi_serdata* Acquire(const T& msg, int64_t timestamp) {
+        Entry* entry = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_.empty()) {
+                entry = free_.back();
+                free_.pop_back();
+            } else {
+                ++created_;
+                free_.reserve(created_);    // 归还时push_back不再分配
+            }
+        }
+        if (entry == nullptr) {
+            entry = new Entry(this, type_, size_, key_buffer_size_);
+        }
+        ddsi_serdata_init(entry, type_, SDK_DATA);
+        entry->ops = &ops_;
+        if (!::serialize_into<T, basic_cdr_stream>(entry->data(), size_, msg, false) || !SetKey(*entry, msg)) {
+            ddsi_serdata_unref(entry);
+            return nullptr;
+        }
+        entry->setT(&msg);      // 首次分配样本副本，之后为赋值
+        entry->timestamp.v = timestamp;
+        return entry;
+    }
+
+    /**
+     * @brief 已创建的池中对象数量（含借出的）
+     */
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return created_;
+    }
+
+private:
+    struct Entry : public ddscxx_serdata<T> {
+        Entry(BridgeSerdataPool* owner, const ddsi_sertype* type, size_t size, size_t key_size)
+            : ddscxx_serdata<T>(type, SDK_DATA), pool(owner), key_stream(endianness::big_endian),
+              key_buffer(key_size, 0) {
+            this->resize(size);
+        }
+
+        BridgeSerdataPool* pool;
+        basic_cdr_stream key_stream;            // key按大端序列化，与ddscxx的to_key一致
+        std::vector<unsigned char> key_buffer;  // 不足16字节的部分保持为0
+    };
+
+    explicit BridgeSerdataPool(const ddsi_sertype* type) : type_(type) {
+        ops_ = ddscxx_sertype<T, basic_cdr_stream>::serdata_ops;
+        ops_.free = &Free;
+    }
+
+    ~BridgeSerdataPool() = default;
+
+    /**
+     * @brief 计算定长的序列化长度和key长度，并按ddscxx的规则决定key是否取MD5
+     */
+    bool Measure() {
+        const T sample{};
+        size_t size = 0;
+        if (!::get_serialized_size<T, basic_cdr_stream>(sample, false, size)) {
+            return false;
+        }
+        size_ = size + CDR_HEADER_SIZE;
+        if (TopicTraits<T>::isKeyless()) {
+            return true;
+        }
+        if (!::get_serialized_size<T, basic_cdr_stream>(sample, true, key_size_)) {
+            return false;
+        }
+        key_buffer_size_ = key_size_ < 16 ? 16 : key_size_;
+        basic_cdr_stream probe(endianness::big_endian);
+        if (!max(probe, sample, true)) {
+            return false;
+        }
+        simple_key_ = probe.position() <= 16;
+        return true;
+    }
+
+    /**
+     * @brief 等同ddscxx的to_key与populate_hash，但使用对象自带的缓冲
+     */
+    bool SetKey(Entry& entry, const T& msg) const {
+        if (TopicTraits<T>::isKeyless()) {
+            std::memset(entry.key().value, 0, sizeof(entry.key().value));
+            entry.key_md5_hashed() = true;
+        } else {
+            entry.key_stream.set_buffer(entry.key_buffer.data(), key_size_);
+            if (!write(entry.key_stream, msg, true)) {
+                return false;
+            }
+            entry.key_md5_hashed() = simple_key_
+                ? org::eclipse::cyclonedds::topic::simple_key(entry.key_buffer, entry.key())
+                : org::eclipse::cyclonedds::topic::complex_key(entry.key_buffer, entry.key());
+        }
+        if (!entry.key_md5_hashed()) {
+            ddsi_keyhash_t digest;
+            ddsrt_md5_state_t md5st;
+            ddsrt_md5_init(&md5st);
+            ddsrt_md5_append(&md5st, static_cast<const ddsrt_md5_byte_t*>(entry.key().value), 16);
+            ddsrt_md5_finish(&md5st, static_cast<ddsrt_md5_byte_t*>(digest.value));
+            std::memcpy(&entry.hash, digest.value, 4);
+        } else {
+            std::memcpy(&entry.hash, entry.key().value, 4);
+        }
+        entry.hash ^= type_->serdata_basehash;
+        entry.hash_populated = true;
+        return true;
+    }
+
+    static void Free(ddsi_serdata* serdata) {
+        Entry* entry = static_cast<Entry*>(static_cast<ddscxx_serdata<T>*>(serdata));
+        entry->pool->Release(entry);
+    }
+
+    void Release(Entry* entry) {
+        bool destroy = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!closed_) {
+                free_.push_back(entry);
+                return;
+            }
+            destroy = --created_ == 0;
+        }
+        delete entry;
+        if (destroy) {
+            delete this;
+        }
+    }
+
+    /**
+     * @brief 所有者放弃池：空闲对象立即释放，借出的对象归还时释放，最后一个归还时销毁池
+     */
+    void Close() {
+        std::vector<Entry*> idle;
+        bool destroy = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            idle.swap(free_);
+            created_ -= idle.size();
+            destroy = created_ == 0;
+        }
+        for (Entry* entry : idle) {
+            delete entry;
+        }
+        if (destroy) {
+            delete this;
+        }
+    }
+
+    const ddsi_sertype* type_;
+    ddsi_serdata_ops ops_;          // ddscxx的serdata操作，释放改为归还到池
+    size_t size_ = 0;               // 含4字节封装头的序列化长度
+    size_t key_size_ = 0;
+    size_t key_buffer_size_ = 0;
+    bool simple_key_ = true;        // key不超过16字节时直接作为keyhash，否则取MD5
+    mutable std::mutex mutex_;
+    std::vector<Entry*> free_;
+    size_t created_ = 0;
+    bool closed_ = false;
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_SERDATA_HPP__
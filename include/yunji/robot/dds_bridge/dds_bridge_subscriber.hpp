@@ -1,59 +1,236 @@
 #ifndef __UT_ROBOT_SDK_Bridge_SUBSCRIBER_HPP__
 #define __UT_ROBOT_SDK_Bridge_SUBSCRIBER_HPP__
 
+/**
+ * @file bridge_subscriber.hpp
+ * @brief DDS消息订阅者通道封装类
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
 #include "yunji/robot/dds_bridge/dds_bridge_factory.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_offload.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_trace.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_integrity.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_qos.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_alloc.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_time_sync.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_filter.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_decimation.hpp"
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 namespace yunji
 {
 namespace robot
 {
-    
 
-template <typename T>
-class BridgeSubscriber {
+/**
+ * @class BridgeSubscriber
+ * @brief 泛型DDS消息订阅者模板类
+ * @tparam T 订阅的消息类型（需支持DDS序列化）
+ * @tparam Callback 回调类型，默认为std::function以兼容旧接口；
+ *                  传入具体的可调用类型（如lambda）可去掉每条消息的类型擦除间接调用
+ * @note 样本直接take进InitBridge时预分配的缓冲，等待线程使用Cyclone C接口的WaitSet，
+ *       分发路径本身不再分配堆内存（HelloWorld等含string的类型在字符串容量足够后同样不分配）
+ */
+template <typename T, typename Callback = std::function<void(const T&)>>
+class BridgeSubscriber : public BridgeExecutable {
 public:
     using RawCallbackType = std::function<void(const T&)>;
+    using CallbackType = Callback;
 
     explicit BridgeSubscriber(const std::string& topic)
         : participant_(BridgeFactory::Instance()->GetParticipant()), topic_name_(topic) {}
 
-    bool InitBridge(RawCallbackType callback, int queue_size = 1) {
+    /**
+     * @brief 将订阅交给共享执行器调度，不再创建独立的等待线程
+     * @param executor 共享执行器
+     * @param priority 优先级类别
+     * @param group 回调组，为空时本订阅独占一个互斥组
+     * @note 需在InitBridge()之前调用
+     */
+    void SetExecutor(BridgeExecutorPtr executor,
+                     BridgePriority priority = BridgePriority::kNormal,
+                     BridgeCallbackGroupPtr group = nullptr) {
+        executor_ = std::move(executor);
+        priority_ = priority;
+        group_ = std::move(group);
+    }
+
+    /**
+     * @brief 开启回调卸载：分发线程只负责take，样本交给工作窃取线程池执行回调
+     * @param options 线程池配置
+     * @note 需在InitBridge()之前调用；同一id的消息保持顺序，回调需可并发执行。
+     *       线程池的提交端为单生产者，订阅处于可重入回调组时InitBridge()失败
+     */
+    void EnableOffload(const BridgeOffloadOptions& options = BridgeOffloadOptions()) {
+        offload_options_ = options;
+    }
+
+    /**
+     * @brief 获取卸载线程池统计，未开启卸载时全为0
+     */
+    BridgeOffloadStats OffloadStats() const {
+        return offload_ ? offload_->Stats() : BridgeOffloadStats();
+    }
+
+    /**
+     * @brief 开启完整性检测：按key跟踪sequence_frame的缺口、乱序和重复，统计timestamp到分发时刻的时长
+     * @param options 检测配置（过期阈值、丢包回调等）
+     * @note 需在InitBridge()之前调用；仅对带sequence_frame/timestamp字段的类型生效，
+     *       发布端需调用BridgePublisher::EnableStamping()或自行填写这两个字段
+     */
+    void EnableIntegrity(const BridgeIntegrityOptions& options = BridgeIntegrityOptions()) {
+        if constexpr (BridgeHasSequenceStamp<T>::value) {
+            integrity_ = std::make_unique<BridgeSequenceTracker>(options);
+        }
+    }
+
+    /**
+     * @brief 获取完整性统计，未开启时全为0
+     */
+    BridgeIntegrityStats IntegrityStats() const {
+        return integrity_ ? integrity_->Stats() : BridgeIntegrityStats();
+    }
+
+    /**
+     * @brief 设置QoS预设，需在InitBridge()之前调用
+     */
+    void SetQosPreset(BridgeQosPreset preset) { qos_preset_ = preset; }
+
+    /**
+     * @brief 设置内容过滤，只分发满足条件的样本，需在InitBridge()之前调用
+     * @note 样本以序列化形式取出，先在CDR上按偏移求值，只有满足条件的才反序列化；
+     *       key不满足的实例记入拒绝表，其后续样本在读者存入历史之前即被丢弃。见BridgeReaderFilter
+     */
+    void SetFilter(const BridgeContentFilter& filter) { filter_ = std::make_unique<BridgeReaderFilter>(filter); }
+
+    /**
+     * @brief 获取过滤统计，未设置过滤时全为0
+     */
+    BridgeFilterStats FilterStats() const {
+        return filter_ ? filter_->Stats() : BridgeFilterStats();
+    }
+
+    /**
+     * @brief 设置抽稀，只分发其中一部分样本，需在InitBridge()之前调用
+     * @note 与内容过滤一样以序列化形式取出样本，被抽掉的样本不反序列化、不计入消息统计；
+     *       min_separation同时写入读者的TimeBasedFilter，支持该策略的远端写者可据此少发。见BridgeDecimator
+     */
+    void SetDecimation(const BridgeDecimationOptions& options) {
+        decimator_ = options.Enabled() ? std::make_unique<BridgeDecimator>(options) : nullptr;
+    }
+
+    /**
+     * @brief 获取抽稀统计，未设置抽稀时全为0
+     */
+    BridgeDecimationStats DecimationStats() const {
+        return decimator_ ? decimator_->Stats() : BridgeDecimationStats();
+    }
+
+    /**
+     * @brief 设置分区，只接收分区匹配的发布端的数据，名称可含通配符'*'、'?'（如"robot3*"），为空表示默认分区
+     * @note InitBridge()之前调用只记录配置；之后调用在运行时切换。Cyclone不支持修改已启用实体的分区，
+     *       切换时以新分区重建订阅者和读者，原读者中尚未取出的样本丢弃，发布端需重新匹配
+     */
+    bool SetPartitions(const std::vector<std::string>& partitions) {
+        partitions_ = partitions;
+        if (reader_entity_.load(std::memory_order_acquire) == 0) {
+            return true;
+        }
         try {
-            callback_ = callback;
+            CreateReader();
+            if (listener_) {
+                executor_->Notify(handle_);
+            }
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Subscriber " << topic_name_ << " partition change failed: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    const std::vector<std::string>& Partitions() const { return partitions_; }
+
+    /**
+     * @brief 当前已匹配的发布端数量
+     */
+    int32_t MatchedPublishers() const {
+        std::lock_guard<std::mutex> lock(reader_mutex_);
+        return reader_ ? reader_->subscription_matched_status().current_count() : 0;
+    }
+
+    /**
+     * @param queue_size 已废弃，仅为源码兼容保留；读者历史深度由SetQosPreset()选择的QoS决定
+     */
+    bool InitBridge(Callback callback, [[maybe_unused]] int queue_size = 1) {
+        try {
+            callback_.emplace(std::move(callback));
+            take_buffer_ = std::make_unique<TakeBuffer>();
+            if (offload_options_ && executor_ && group_ && group_->Type() == BridgeCallbackGroupType::kReentrant) {
+                // 可重入组下同一订阅会在多个工作线程上并发Execute，单生产者通道会被并发写入
+                throw std::runtime_error("offload requires a mutually exclusive callback group");
+            }
 
             topic_ = std::make_shared<dds::topic::Topic<T>>(*participant_, topic_name_);
-            subscriber_ = std::make_shared<dds::sub::Subscriber>(*participant_);
-            reader_ = std::make_shared<dds::sub::DataReader<T>>(*subscriber_, *topic_);
-
-            waitset_ = dds::core::cond::WaitSet();      //创建dds等待集
-
-            cond_ = std::make_shared<dds::sub::cond::ReadCondition>(        //创建条件
-                *reader_,
-                dds::sub::status::DataState::any(),
-                [this](dds::core::cond::Condition&) {
-                    auto samples = reader_->take();
-                    for (const auto& sample : samples) {
-                        if (sample.info().valid()) {
-                            callback_(sample.data());
-                        }
-                    }
+            // 话题实体为本订阅独有，过滤器须在创建读者之前挂上
+            if (filter_ && !(filter_->Build<T>() && filter_->Install(topic_->delegate()->get_ddsc_entity()))) {
+                throw std::runtime_error("content filter unavailable");
+            }
+
+            metrics_ = std::make_shared<BridgeTopicMetrics>(BridgeEndpointKind::kSubscriber, topic_name_,
+                                                            topic_->type_name());
+            trace_name_ = BridgeTracer::Instance()->Intern(topic_name_);
+            if (offload_options_) {
+                // 卸载的回调在工作线程上计时，记入同一份指标和追踪
+                offload_ = std::make_unique<BridgeOffloadPool<T, Callback>>(*offload_options_, *callback_, metrics_,
+                                                                           trace_name_);
+            }
+
+            if (executor_) {
+                handle_ = executor_->Add(this, priority_, group_);
+                if (executor_->IsStepping()) {
+                    // 步进模式：不挂监听器，由Step()在调用线程上轮询
+                    CreateReader();
+                    return true;
                 }
-            );
+                // 执行器模式：数据到达时由监听器通知执行器，在共享工作线程上take并分发
+                listener_ = std::make_unique<DataListener>(this);
+                CreateReader();
+                executor_->Notify(handle_);     //取走挂监听器之前已到达的数据
+                return true;
+            }
 
-            waitset_.attach_condition(*cond_);              //将条件附加到等待集
+            // C++ WaitSet每次dispatch都会构造触发条件列表，这里直接用C接口等待
+            waitset_ = dds_create_waitset(participant_->delegate()->get_ddsc_entity());      //创建dds等待集
+            if (waitset_ < 0) {
+                throw std::runtime_error(dds_strretcode(waitset_));
+            }
+            CreateReader();
 
             wait_thread_ = std::thread([this]() {
                 while (running_) {
+                    const dds_return_t triggered = dds_waitset_wait(waitset_, nullptr, 0, DDS_SECS(2));
+                    if (triggered < 0) {
+                        std::cerr << "WaitSet wait error: " << dds_strretcode(triggered) << std::endl;
+                        break;
+                    }
+                    if (triggered == 0 || !running_) {
+                        continue;       // 超时正常，忽略
+                    }
                     try {
-                        waitset_.dispatch(dds::core::Duration(2));
-                    } catch (const dds::core::TimeoutError&) {
-                        // 超时正常，忽略
+                        Execute(0);
                     } catch (const std::exception& e) {
                         std::cerr << "WaitSet dispatch error: " << e.what() << std::endl;
                     }
                 }
             });
-
             return true;
         } catch (const std::exception& e) {
             std::cerr << "Subscriber init failed: " << e.what() << std::endl;
@@ -63,26 +240,336 @@ public:
 
     ~BridgeSubscriber() {
         running_ = false;
+        if (waitset_ > 0) {
+            dds_waitset_set_trigger(waitset_, true);       //唤醒等待线程，无需等到超时
+        }
         if (wait_thread_.joinable()) {
             wait_thread_.join();
         }
+        if (waitset_ > 0) {
+            dds_delete(waitset_);
+        }
+        if (handle_) {
+            if (listener_) {
+                reader_->listener(nullptr, dds::core::status::StatusMask::none());
+            }
+            executor_->Remove(handle_);
+        }
+        // 话题过滤器持有filter_的裸指针，成员析构前先摘除过滤器并删除读者，Cyclone接收线程不再回调
+        if (filter_ && topic_) {
+            filter_->Uninstall(topic_->delegate()->get_ddsc_entity());
+        }
+        if (reader_) {
+            reader_->close();
+            subscriber_->close();
+        }
+        if (metrics_registered_) {
+            BridgeFactory::Instance()->UnregisterMetrics(metrics_);
+        }
+    }
+
+    /**
+     * @brief 取出最多max_samples个样本并分发（执行器工作线程调用），max_samples为0表示取完为止
+     * @return 取出的样本数
+     */
+    size_t Execute(size_t max_samples) override {
+        if (reader_entity_.load(std::memory_order_acquire) == 0) {
+            return 0;       // 监听器先于InitBridge完成触发，InitBridge末尾会再通知一次
+        }
+        const uint64_t allocations = BridgeAllocTracker::ThreadAllocations();
+        // 可重入回调组下同一订阅可能被并发执行，此时后来者使用临时缓冲
+        std::unique_ptr<TakeBuffer> spare;
+        TakeBuffer* buffer = take_buffer_.get();
+        const bool owns_shared = !take_busy_.exchange(true, std::memory_order_acquire);
+        if (!owns_shared) {
+            spare = std::make_unique<TakeBuffer>();
+            buffer = spare.get();
+        }
+        uint64_t callback_allocations = 0;
+        size_t total = 0;
+        while (max_samples == 0 || total < max_samples) {
+            const size_t limit = max_samples == 0 ? kTakeBatch : std::min(kTakeBatch, max_samples - total);
+            const size_t count = Take(*buffer, limit);
+            callback_allocations += Deliver(*buffer, buffer->ready);
+            total += count;
+            if (count < limit) {
+                break;
+            }
+        }
+        if (owns_shared) {
+            take_busy_.store(false, std::memory_order_release);
+        }
+        metrics_->AddAllocations(BridgeAllocTracker::ThreadAllocations() - allocations - callback_allocations);
+        return total;
     }
 
 private:
+    static constexpr size_t kTakeBatch = 32;       // 单次take的样本数，与执行器默认max_batch一致
+
+    /**
+     * @brief take目标缓冲，样本对象跨批次复用，反序列化直接覆盖已有对象
+     */
+    struct TakeBuffer {
+        TakeBuffer() : samples(kTakeBatch) {
+            for (size_t i = 0; i < kTakeBatch; ++i) {
+                pointers[i] = &samples[i];
+            }
+        }
+
+        std::vector<T> samples;
+        std::array<void*, kTakeBatch> pointers{};
+        std::array<dds_sample_info_t, kTakeBatch> infos{};
+        size_t ready = 0;                                   // 待分发的前ready个样本
+
+        // 内容过滤或抽稀时使用：序列化样本、求值视图与不连续数据的拷贝
+        std::array<ddsi_serdata*, kTakeBatch> serdata{};
+        BridgeDynamicView view;
+        std::vector<uint8_t> scratch;
+    };
+
+    /**
+     * @brief 将最多limit个样本take进缓冲并记录take区间
+     * @return 取出的样本数（含无效样本与被过滤的样本）
+     */
+    size_t Take(TakeBuffer& buffer, size_t limit) {
+        BridgeTraceScope scope(trace_name_, "take");
+        const dds_entity_t reader = reader_entity_.load(std::memory_order_relaxed);
+        size_t count = 0;
+        if (filter_ || decimator_) {
+            const dds_return_t ret = dds_takecdr(reader, buffer.serdata.data(), static_cast<uint32_t>(limit),
+                                                 buffer.infos.data(), DDS_ANY_STATE);
+            count = ret > 0 ? static_cast<size_t>(ret) : 0;
+            buffer.ready = SelectSerialized(buffer, count);
+        } else {
+            const dds_return_t ret = dds_take_mask(reader, buffer.pointers.data(), buffer.infos.data(), limit,
+                                                   static_cast<uint32_t>(limit), DDS_ANY_STATE);
+            count = ret > 0 ? static_cast<size_t>(ret) : 0;
+            buffer.ready = count;
+        }
+        scope.SetArg(count);
+        return count;
+    }
+
+    /**
+     * @brief 在序列化数据上依次做内容过滤与抽稀，选中的样本反序列化并依次移到缓冲前部
+     * @return 选中的样本数
+     */
+    size_t SelectSerialized(TakeBuffer& buffer, size_t count) {
+        size_t ready = 0;
+        for (size_t i = 0; i < count; ++i) {
+            ddsi_serdata* serdata = buffer.serdata[i];
+            dds_sample_info_t info = buffer.infos[i];
+            bool selected = info.valid_data;
+            if (selected && filter_) {
+                selected = WithPayload(buffer, serdata, [&](uint8_t* payload, size_t size) {
+                    return filter_->Accept(buffer.view, payload, size, info.instance_handle);
+                });
+            }
+            if (!selected) {
+                ddsi_serdata_unref(serdata);
+                continue;
+            }
+            if (decimator_) {
+                serdata = decimator_->Offer(serdata, info);     // 接管引用，返回的可能是上一个窗口暂存的样本
+                if (serdata == nullptr) {
+                    continue;
+                }
+            }
+            T& sample = buffer.samples[ready];
+            if (WithPayload(buffer, serdata, [&sample](uint8_t* payload, size_t size) {
+                    return deserialize_sample_from_buffer(payload, size, sample);
+                })) {
+                buffer.infos[ready++] = info;
+            }
+            ddsi_serdata_unref(serdata);
+        }
+        return ready;
+    }
+
+    /**
+     * @brief 以连续内存的形式访问序列化样本，数据不连续时拷贝到缓冲的scratch中
+     */
+    template <typename Visitor>
+    static bool WithPayload(TakeBuffer& buffer, ddsi_serdata* serdata, Visitor&& visitor) {
+        const uint32_t size = ddsi_serdata_size(serdata);
+        ddsrt_iovec_t ref{};
+        ddsi_serdata* held = ddsi_serdata_to_ser_ref(serdata, 0, size, &ref);
+        if (held != nullptr && ref.iov_len == size) {
+            const bool result = visitor(static_cast<uint8_t*>(ref.iov_base), size);
+            ddsi_serdata_to_ser_unref(held, &ref);
+            return result;
+        }
+        if (held != nullptr) {
+            ddsi_serdata_to_ser_unref(held, &ref);
+        }
+        buffer.scratch.resize(size);
+        ddsi_serdata_to_ser(serdata, 0, size, buffer.scratch.data());
+        return visitor(buffer.scratch.data(), size);
+    }
+
+    /**
+     * @brief 以当前分区创建订阅者和读者，挂上监听器或等待集条件后登记为当前读者并注册统计
+     * @note 替换掉的读者随即删除，其读条件随之从等待集移除；此时正在其上take的调用返回0个样本
+     */
+    void CreateReader() {
+        auto subscriber = std::make_shared<dds::sub::Subscriber>(
+            *participant_, BridgeSubscriberQos(partitions_, participant_->default_subscriber_qos()));
+        dds::sub::qos::DataReaderQos reader_qos = BridgeReaderQos(qos_preset_, subscriber->default_datareader_qos());
+        if (decimator_ && decimator_->Options().min_separation.count() > 0) {
+            const int64_t separation = decimator_->Options().min_separation.count();
+            reader_qos << dds::core::policy::TimeBasedFilter(
+                dds::core::Duration(separation / 1000000000, static_cast<uint32_t>(separation % 1000000000)));
+        }
+        auto reader = listener_
+            ? std::make_shared<dds::sub::DataReader<T>>(*subscriber, *topic_, reader_qos, listener_.get(),
+                                                        dds::core::status::StatusMask::data_available())
+            : std::make_shared<dds::sub::DataReader<T>>(*subscriber, *topic_, reader_qos);
+        const dds_entity_t entity = reader->delegate()->get_ddsc_entity();
+        if (waitset_ > 0) {
+            const dds_entity_t condition = dds_create_readcondition(entity, DDS_ANY_STATE);     //创建条件
+            if (condition < 0 || dds_waitset_attach(waitset_, condition, 0) < 0) {     //将条件附加到等待集
+                throw std::runtime_error("attach read condition failed");
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(reader_mutex_);
+            subscriber_.swap(subscriber);
+            reader_.swap(reader);
+        }
+        metrics_->SetEntity(entity);
+        if (!metrics_registered_) {
+            BridgeFactory::Instance()->RegisterMetrics(metrics_);
+            metrics_registered_ = true;
+        }
+        reader_entity_.store(entity, std::memory_order_release);
+        if (reader) {
+            if (listener_) {
+                reader->listener(nullptr, dds::core::status::StatusMask::none());
+            }
+            reader->close();
+            subscriber->close();
+        }
+    }
+
+    /**
+     * @brief 分发缓冲中的前count个样本并记录统计
+     * @note 延迟为源时间戳到回调开始（卸载模式下为提交到线程池）的时间。BridgeTimeSync运行时
+     *       按发布端所属参与者的时钟偏差修正，否则要求收发两端时钟同步；
+     *       墙钟与时钟偏差快照每批只取一次，单条消息的额外开销为若干次relaxed原子操作和一次快照内的二分查找
+     * @return 用户回调内发生的分配次数，不计入订阅路径的分配统计
+     */
+    uint64_t Deliver(const TakeBuffer& buffer, size_t count) {
+        if (count == 0) {
+            return 0;
+        }
+        uint64_t callback_allocations = 0;
+        const int64_t now_ns = BridgeClock::Instance()->WallTime();
+        BridgeTimeSync* time_sync = BridgeTimeSync::Instance();
+        const BridgePublicationOffsetsPtr offsets = time_sync->PublicationOffsets();     // 未运行时为空
+        for (size_t i = 0; i < count; ++i) {
+            const dds_sample_info_t& info = buffer.infos[i];
+            if (!info.valid_data) {
+                continue;
+            }
+            const T& data = buffer.samples[i];
+            int64_t latency_ns = now_ns - info.source_timestamp;
+            int64_t offset_ns = 0;
+            if (offsets && time_sync->PublicationOffset(*offsets, reader_entity_.load(std::memory_order_relaxed),
+                                                        info.publication_handle, now_ns, offset_ns)) {
+                latency_ns += offset_ns;        // 源时间戳换算到本地时钟
+            }
+            metrics_->latency_ns.Record(latency_ns > 0 ? static_cast<uint64_t>(latency_ns) : 0);
+            metrics_->AddMessage(BridgeSerializedBytes(data));
+            if constexpr (BridgeHasSequenceStamp<T>::value) {
+                if (integrity_ && !integrity_->Observe(BridgeMessageKey(data), data.sequence_frame(),
+                                                       data.timestamp(), now_ns)) {
+                    continue;
+                }
+            }
+            if (offload_) {
+                offload_->Submit(data);
+                continue;
+            }
+            const uint64_t allocations = BridgeAllocTracker::ThreadAllocations();
+            const int64_t start = BridgeTracer::NowNs();
+            (*callback_)(data);
+            const int64_t elapsed = BridgeTracer::NowNs() - start;
+            callback_allocations += BridgeAllocTracker::ThreadAllocations() - allocations;
+            metrics_->callback_ns.Record(static_cast<uint64_t>(elapsed));
+            BridgeTracer::Instance()->Complete(trace_name_, "callback", start, elapsed);
+        }
+        return callback_allocations;
+    }
+
+    class DataListener : public dds::sub::NoOpDataReaderListener<T> {
+    public:
+        explicit DataListener(BridgeSubscriber* owner) : owner_(owner) {}
+
+        void on_data_available(dds::sub::DataReader<T>&) override {
+            owner_->executor_->Notify(owner_->handle_);
+        }
+
+    private:
+        BridgeSubscriber* owner_;
+    };
+
     std::shared_ptr<dds::domain::DomainParticipant> participant_;
     std::string topic_name_;
     std::shared_ptr<dds::topic::Topic<T>> topic_;
     std::shared_ptr<dds::sub::Subscriber> subscriber_;
     std::shared_ptr<dds::sub::DataReader<T>> reader_;
+    std::atomic<dds_entity_t> reader_entity_{0};
+    mutable std::mutex reader_mutex_;       // 切换分区时替换reader_，保护MatchedPublishers()
+    std::vector<std::string> partitions_;
+
+    std::unique_ptr<TakeBuffer> take_buffer_;
+    std::atomic<bool> take_busy_{false};
 
-    std::shared_ptr<dds::sub::cond::ReadCondition> cond_;
-    dds::core::cond::WaitSet waitset_;
+    dds_entity_t waitset_ = 0;
     std::thread wait_thread_;
     std::atomic<bool> running_{true};
 
-    RawCallbackType callback_;
+    std::optional<Callback> callback_;      //可调用对象不一定可默认构造，延迟到InitBridge时构造
+
+    BridgeQosPreset qos_preset_ = BridgeQosPreset::kDefault;
+
+    BridgeExecutorPtr executor_;
+    BridgePriority priority_ = BridgePriority::kNormal;
+    BridgeCallbackGroupPtr group_;
+    BridgeExecutor::Handle handle_;
+    std::unique_ptr<DataListener> listener_;
+
+    std::optional<BridgeOffloadOptions> offload_options_;
+    std::unique_ptr<BridgeOffloadPool<T, Callback>> offload_;    //需先于callback_析构
+
+    std::unique_ptr<BridgeSequenceTracker> integrity_;
+    std::unique_ptr<BridgeReaderFilter> filter_;
+    std::unique_ptr<BridgeDecimator> decimator_;
+
+    BridgeTopicMetricsPtr metrics_;     //InitBridge开始即创建，分发路径无需判空
+    bool metrics_registered_ = false;
+    const char* trace_name_ = nullptr;
 };
 
+template <typename T, typename Callback = std::function<void(const T&)>>
+using BridgeSubscriberPtr = std::unique_ptr<BridgeSubscriber<T, Callback>>;
+
+/**
+ * @brief 创建以具体可调用类型实例化的订阅者，回调可被内联进分发循环
+ * @param topic 话题名
+ * @param callback 回调（lambda、函数对象等）
+ * @return 初始化失败时返回nullptr
+ */
+template <typename T, typename Callback>
+BridgeSubscriberPtr<T, std::decay_t<Callback>> CreateBridgeSubscriber(
+    const std::string& topic, Callback&& callback) {
+    auto subscriber = std::make_unique<BridgeSubscriber<T, std::decay_t<Callback>>>(topic);
+    if (!subscriber->InitBridge(std::forward<Callback>(callback))) {
+        return nullptr;
+    }
+    return subscriber;
+}
+
 }
 }
 
@@ -0,0 +1,228 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_TIME_SYNC_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_TIME_SYNC_HPP__
+
+/**
+ * @file bridge_time_sync.hpp
+ * @brief 跨主机时钟偏差估计服务
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_lockfree.hpp"
+
+#include <dds/dds.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace TimeSync
+{
+class Ping;
+}
+
+namespace yunji
+{
+
+namespace robot
+{
+
+using BridgeParticipantGuid = std::array<uint8_t, 16>;
+
+/**
+ * @brief 时钟同步配置，通信双方应使用相同的话题名
+ */
+struct BridgeTimeSyncOptions {
+    std::chrono::milliseconds interval{200};        // 请求周期
+    size_t window = 16;                             // 最小RTT滤波窗口（最近的交换次数）
+    size_t drift_history = 32;                      // 拟合漂移使用的滤波点数
+    std::chrono::milliseconds min_drift_span{2000}; // 滤波点跨度不足时不估计漂移
+    std::chrono::milliseconds peer_timeout{5000};   // 超过该时长无应答的对端估计失效
+    std::string request_topic = "rt/bridge/time_sync/request";
+    std::string reply_topic = "rt/bridge/time_sync/reply";
+};
+
+/**
+ * @brief 单个远端参与者的时钟估计
+ * @note offset为远端墙上时钟减本地墙上时钟，远端时间戳t对应的本地时间为t - OffsetAt(本地时间)
+ */
+struct BridgeClockEstimate {
+    BridgeParticipantGuid peer{};   // 远端参与者GUID
+    bool valid = false;
+    int64_t offset_ns = 0;          // reference_ns时刻的偏差
+    double drift_ppm = 0.0;         // 远端时钟相对本地时钟的频率偏差
+    int64_t rtt_ns = 0;             // 所选样本（窗口内最小RTT）的往返时间，偏差误差不超过其一半
+    int64_t reference_ns = 0;       // 所选样本的本地墙上时间
+    uint64_t exchanges = 0;         // 累计完成的交换次数
+
+    int64_t OffsetAt(int64_t local_ns) const {
+        return offset_ns + static_cast<int64_t>(drift_ppm * 1e-6 * static_cast<double>(local_ns - reference_ns));
+    }
+};
+
+/**
+ * @class BridgePublicationOffsets
+ * @brief 按发布端索引的时钟估计只读快照，由请求线程周期重建
+ * @note 订阅端每批取一次快照，逐条样本在有序数组上二分查找，不加锁、不分配内存
+ */
+class BridgePublicationOffsets {
+public:
+    /**
+     * @brief 快照中是否已有该发布端（含本进程的发布端和尚无估计的远端）
+     */
+    bool Contains(dds_instance_handle_t publication) const { return Find(publication) != nullptr; }
+
+    /**
+     * @brief 发布端所属参与者在local_ns时刻的时钟偏差，本进程的发布端、尚无估计或估计已过期时返回false
+     */
+    bool Offset(dds_instance_handle_t publication, int64_t local_ns, int64_t& offset_ns) const {
+        const Entry* entry = Find(publication);
+        if (entry == nullptr || !entry->estimate.valid || local_ns > entry->expires_ns) {
+            return false;
+        }
+        offset_ns = entry->estimate.OffsetAt(local_ns);
+        return true;
+    }
+
+private:
+    friend class BridgeTimeSync;
+
+    struct Entry {
+        dds_instance_handle_t publication = 0;
+        BridgeClockEstimate estimate;       // 本进程的发布端valid为false
+        int64_t expires_ns = 0;             // 超过该本地时间未再收到应答则估计失效
+    };
+
+    const Entry* Find(dds_instance_handle_t publication) const {
+        auto it = std::lower_bound(entries_.begin(), entries_.end(), publication,
+                                   [](const Entry& entry, dds_instance_handle_t key) { return entry.publication < key; });
+        return it != entries_.end() && it->publication == publication ? &*it : nullptr;
+    }
+
+    std::vector<Entry> entries_;        // 按publication升序
+};
+
+using BridgePublicationOffsetsPtr = std::shared_ptr<const BridgePublicationOffsets>;
+
+/**
+ * @class BridgeTimeSync
+ * @brief NTP式的请求/应答时钟同步：每个进程周期发出请求，同时应答其他进程的请求
+ * @note 每次交换得到t1~t4四个时间戳，offset = ((t2 - t1) + (t3 - t4)) / 2，
+ *       rtt = (t4 - t1) - (t3 - t2)。窗口内取RTT最小的样本作为偏差估计（排队和调度延迟只会增大RTT），
+ *       再对历次滤波结果做最小二乘拟合得到漂移。运行期间BridgeSubscriber按样本的发布端
+ *       所属参与者修正延迟直方图，得到真正的单向延迟
+ */
+class BridgeTimeSync {
+
+public:
+
+    static BridgeTimeSync* Instance() {
+
+        static BridgeTimeSync instance;
+
+        return &instance;
+    }
+
+    ~BridgeTimeSync();
+
+    BridgeTimeSync(const BridgeTimeSync&) = delete;
+    BridgeTimeSync& operator=(const BridgeTimeSync&) = delete;
+
+    /**
+     * @brief 创建请求/应答端点并启动请求线程，需在BridgeFactory::Init()之后调用
+     */
+    bool Start(const BridgeTimeSyncOptions& options = BridgeTimeSyncOptions());
+
+    void Stop();
+
+    bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 所有已知远端的估计
+     */
+    std::vector<BridgeClockEstimate> Estimates() const;
+
+    /**
+     * @brief 指定远端参与者的估计，无有效估计时返回false
+     */
+    bool Estimate(const BridgeParticipantGuid& peer, BridgeClockEstimate& estimate) const;
+
+    /**
+     * @brief 当前的发布端时钟偏差快照，未运行时为空
+     * @note 订阅端每批样本取一次，之后用PublicationOffset()逐条查询
+     */
+    BridgePublicationOffsetsPtr PublicationOffsets() const { return std::atomic_load(&offsets_); }
+
+    /**
+     * @brief 在快照上查询样本发布端所属参与者在local_ns时刻的时钟偏差
+     * @param reader 收到样本的读者
+     * @param publication 样本信息中的publication_handle
+     * @note 快照中没有的发布端登记到无锁队列，由请求线程通过dds_get_matched_publication_data解析，
+     *       下一周期起的快照中即包含该发布端；take路径上不加锁、不分配内存。
+     *       本进程内的发布端和尚无有效估计的远端返回false
+     */
+    bool PublicationOffset(const BridgePublicationOffsets& offsets, dds_entity_t reader,
+                           dds_instance_handle_t publication, int64_t local_ns, int64_t& offset_ns);
+
+private:
+
+    BridgeTimeSync();
+
+    struct Exchange {
+        int64_t local_ns = 0;       // 请求发出与应答到达的中点（本地时间）
+        int64_t offset_ns = 0;
+        int64_t rtt_ns = 0;
+    };
+
+    struct Peer {
+        std::vector<Exchange> window;           // 环形缓冲
+        size_t next = 0;
+        std::vector<Exchange> history;          // 历次最小RTT样本，用于拟合漂移
+        int64_t last_reply_ns = 0;
+        BridgeClockEstimate estimate;
+    };
+
+    struct Endpoints;
+
+    struct PendingPublication {
+        dds_entity_t reader = 0;
+        dds_instance_handle_t publication = 0;
+    };
+
+    void Run();
+    void OnRequest(Endpoints& endpoints, const TimeSync::Ping& request);
+    void OnReply(const TimeSync::Ping& reply);
+    void UpdatePeer(Peer& peer, const Exchange& exchange) const;
+    bool IsFresh(const Peer& peer, int64_t now_ns) const;
+    void PublishOffsets();
+
+    BridgeTimeSyncOptions options_;
+    int32_t node_id_ = 0;
+    BridgeParticipantGuid local_guid_{};
+
+    std::atomic<bool> running_{false};
+    std::unique_ptr<Endpoints> endpoints_;
+    std::mutex thread_mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+
+    mutable std::mutex mutex_;
+    std::map<BridgeParticipantGuid, Peer> peers_;
+
+    std::unordered_map<dds_instance_handle_t, BridgeParticipantGuid> publications_;    // 只由请求线程访问
+    BridgeMpmcQueue<PendingPublication> pending_{256};      // 订阅端登记的待解析发布端
+    std::shared_ptr<const BridgePublicationOffsets> offsets_;  // 以std::atomic_load/atomic_store访问
+};
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_TIME_SYNC_HPP__
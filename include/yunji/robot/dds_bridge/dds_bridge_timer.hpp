@@ -0,0 +1,107 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_TIMER_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_TIMER_HPP__
+
+/**
+ * @file bridge_timer.hpp
+ * @brief 执行器托管的周期定时器
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
+
+#include <functional>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 定时器配置
+ */
+struct BridgeTimerOptions {
+    BridgePriority priority = BridgePriority::kControl;     // 非内联执行时在工作线程上的优先级
+    bool inline_callback = true;                             // 在定时线程上直接执行回调，抖动最小；回调需足够短
+    std::chrono::nanoseconds busy_wait_tail{0};              // 到期前提前唤醒并忙等的时长，用于压低唤醒抖动
+};
+
+/**
+ * @brief 定时器统计，抖动为实际触发时刻相对绝对截止时刻的偏差
+ */
+struct BridgeTimerStats {
+    uint64_t fired = 0;             // 触发次数
+    uint64_t overruns = 0;          // 因回调或调度超时而跳过的周期数
+    int64_t min_jitter_ns = 0;
+    int64_t max_jitter_ns = 0;
+    double mean_abs_jitter_ns = 0.0;
+    uint64_t max_callback_ns = 0;   // 回调最长执行时间（仅内联执行时统计）
+};
+
+/**
+ * @class BridgeTimer
+ * @brief 固定频率定时器，按绝对截止时刻排程，长期运行不漂移
+ * @note 通过BridgeExecutor::CreateTimer()创建
+ */
+class BridgeTimer : public BridgeExecutable {
+public:
+    using Callback = std::function<void()>;
+
+    BridgeTimer(std::chrono::nanoseconds period, Callback callback,
+                const BridgeTimerOptions& options, int64_t first_deadline_ns);
+
+    /**
+     * @brief 取消定时器，已排队的回调仍可能执行一次
+     */
+    void Cancel() { cancelled_.store(true, std::memory_order_release); }
+
+    bool IsCancelled() const { return cancelled_.load(std::memory_order_acquire); }
+
+    std::chrono::nanoseconds Period() const { return std::chrono::nanoseconds(period_ns_); }
+
+    const BridgeTimerOptions& Options() const { return options_; }
+
+    BridgeTimerStats Stats() const;
+
+    /**
+     * @brief 执行已触发但尚未运行的回调（非内联模式下由工作线程调用）
+     */
+    size_t Execute(size_t max_samples) override;
+
+private:
+    friend class BridgeExecutor;
+
+    /**
+     * @brief 到期处理：记录抖动，执行或挂起回调，并推进下一个截止时刻
+     * @param now_ns 实际触发时刻
+     * @param run_inline 是否在当前线程执行回调
+     * @return 是否需要通知执行器调度挂起的回调
+     */
+    bool Fire(int64_t now_ns, bool run_inline);
+
+    void RunCallback();
+
+    const int64_t period_ns_;
+    Callback callback_;
+    BridgeTimerOptions options_;
+    std::atomic<bool> cancelled_{false};
+
+    int64_t next_deadline_ns_;              // 仅由定时线程（或步进线程）读写
+    std::atomic<uint32_t> pending_{0};
+    BridgeExecutor::Handle handle_;
+
+    // 统计只有一个写者，原子变量保证并发读取安全
+    std::atomic<uint64_t> fired_{0};
+    std::atomic<uint64_t> overruns_{0};
+    std::atomic<int64_t> min_jitter_ns_{0};
+    std::atomic<int64_t> max_jitter_ns_{0};
+    std::atomic<uint64_t> sum_abs_jitter_ns_{0};
+    std::atomic<uint64_t> max_callback_ns_{0};
+};
+
+using BridgeTimerPtr = std::shared_ptr<BridgeTimer>;
+
+}
+}
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_TIMER_HPP__
@@ -0,0 +1,213 @@
+#ifndef __YJ_ROBOT_SDK_BRIDGE_TRACE_HPP__
+#define __YJ_ROBOT_SDK_BRIDGE_TRACE_HPP__
+
+/**
+ * @file bridge_trace.hpp
+ * @brief 每线程无锁追踪环形缓冲，可导出为Chrome trace JSON
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+/**
+ * @brief 一条追踪事件
+ * @note name/category只保存指针，需指向字符串字面量或BridgeTracer::Intern()返回的字符串
+ */
+struct BridgeTraceEvent {
+    const char* name = nullptr;
+    const char* category = nullptr;
+    int64_t start_ns = 0;           // steady_clock时间
+    int64_t duration_ns = -1;       // 小于0表示瞬时事件
+    uint64_t arg = 0;               // 附加参数（如样本数）
+};
+
+/**
+ * @class BridgeTraceRing
+ * @brief 单线程写入、固定容量的追踪环，写满后覆盖最旧的事件
+ * @note 每个槽位带序号（seqlock），导出线程可在写入的同时读取而不会读到撕裂的事件
+ */
+class BridgeTraceRing {
+public:
+    BridgeTraceRing(size_t capacity, uint64_t thread_id, const std::string& thread_name);
+
+    void Push(const BridgeTraceEvent& event) {
+        const uint64_t index = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[index & mask_];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.event = event;
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        head_.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief 拷贝当前仍在缓冲中的事件，按写入顺序追加到out
+     */
+    void Snapshot(std::vector<BridgeTraceEvent>& out) const;
+
+    uint64_t ThreadId() const { return thread_id_; }
+    const std::string& ThreadName() const { return thread_name_; }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        BridgeTraceEvent event;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<uint64_t> head_{0};
+    uint64_t thread_id_;
+    std::string thread_name_;
+};
+
+/**
+ * @class BridgeTracer
+ * @brief 全局追踪开关与各线程追踪环的登记处
+ * @note 关闭时每个埋点只多一次relaxed原子读；开启后每个线程首次写入时分配一次追踪环，
+ *       此后记录事件不分配内存、不加锁。桥接层自动记录write/take/callback/timer，
+ *       用户可用YJ_TRACE_SCOPE添加自定义区间
+ */
+class BridgeTracer {
+
+public:
+
+    static BridgeTracer* Instance() {
+
+        static BridgeTracer instance;
+
+        return &instance;
+    }
+
+    ~BridgeTracer();
+
+    /**
+     * @brief 开启追踪
+     * @param ring_capacity 每个线程的事件数上限（向上取2的幂），对已创建的追踪环无效
+     */
+    void Enable(size_t ring_capacity = 16384);
+
+    void Disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 记录一个完整区间
+     */
+    void Complete(const char* name, const char* category, int64_t start_ns, int64_t duration_ns, uint64_t arg = 0);
+
+    /**
+     * @brief 记录一个瞬时事件
+     */
+    void Instant(const char* name, const char* category, uint64_t arg = 0);
+
+    /**
+     * @brief 驻留字符串，返回的指针在进程生命周期内有效（用于话题名等动态名称）
+     * @note 会加锁和分配内存，应在初始化阶段调用
+     */
+    const char* Intern(const std::string& text);
+
+    /**
+     * @brief 将所有线程缓冲中的事件导出为Chrome trace JSON（chrome://tracing或Perfetto可直接打开）
+     */
+    std::string ChromeTraceJson() const;
+
+    /**
+     * @brief 导出到文件
+     */
+    bool DumpChromeTrace(const std::string& path) const;
+
+    /**
+     * @brief 设置截止时刻错过时自动导出的文件路径，为空则不自动导出
+     * @param path 导出路径
+     * @param min_interval 两次自动导出的最小间隔，避免持续超限时反复写盘
+     */
+    void SetDumpOnDeadlineMiss(const std::string& path,
+                               std::chrono::milliseconds min_interval = std::chrono::milliseconds(5000));
+
+    /**
+     * @brief 报告一次截止时刻错过（定时器超限时自动调用）
+     * @note 记录瞬时事件；配置了导出路径时在后台线程导出，不阻塞调用方
+     */
+    void DeadlineMiss(const char* name, uint64_t missed = 1);
+
+    static int64_t NowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+
+    BridgeTracer() = default;
+
+    BridgeTraceRing* ThreadRing();
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<size_t> ring_capacity_{16384};
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<BridgeTraceRing>> rings_;      // 线程退出后保留，便于事后导出
+    std::unordered_set<std::string> interned_;
+
+    std::string dump_path_;
+    int64_t dump_interval_ns_ = 0;
+    std::atomic<int64_t> last_dump_ns_{0};
+    std::atomic<bool> dumping_{false};
+    std::thread dump_thread_;
+};
+
+/**
+ * @class BridgeTraceScope
+ * @brief RAII区间，构造时记录开始，析构时写入追踪环
+ */
+class BridgeTraceScope {
+public:
+    explicit BridgeTraceScope(const char* name, const char* category = "user", uint64_t arg = 0)
+        : name_(name), category_(category), arg_(arg),
+          start_ns_(BridgeTracer::Instance()->IsEnabled() ? BridgeTracer::NowNs() : 0) {}
+
+    ~BridgeTraceScope() {
+        if (start_ns_ != 0) {
+            BridgeTracer::Instance()->Complete(name_, category_, start_ns_, BridgeTracer::NowNs() - start_ns_, arg_);
+        }
+    }
+
+    void SetArg(uint64_t arg) { arg_ = arg; }
+
+    BridgeTraceScope(const BridgeTraceScope&) = delete;
+    BridgeTraceScope& operator=(const BridgeTraceScope&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    uint64_t arg_;
+    int64_t start_ns_;
+};
+
+}
+}
+
+#define YJ_TRACE_CONCAT_INNER(a, b) a##b
+#define YJ_TRACE_CONCAT(a, b) YJ_TRACE_CONCAT_INNER(a, b)
+
+/**
+ * @brief 在当前作用域添加一个用户追踪区间，name需为字符串字面量
+ */
+#define YJ_TRACE_SCOPE(name) \
+    ::yunji::robot::BridgeTraceScope YJ_TRACE_CONCAT(yj_trace_scope_, __LINE__)(name)
+
+#endif//__YJ_ROBOT_SDK_BRIDGE_TRACE_HPP__
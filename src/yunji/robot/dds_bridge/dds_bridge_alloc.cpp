@@ -0,0 +1,137 @@
+/**
+ * @file bridge_alloc.cpp
+ * @brief 堆分配计数实现文件
+ * @note 实现BridgeAllocTracker类的具体功能；本文件的函数会在malloc内部被调用，不得分配内存
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_alloc.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#include <execinfo.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+struct ThreadAllocState {
+    uint64_t allocations;
+    uint64_t frees;
+    uint64_t bytes;
+    bool realtime;
+    bool reporting;         // 打印调用栈期间的分配不再重复上报
+};
+
+// initial-exec：访问时不经过__tls_get_addr，避免在malloc内部再次分配
+thread_local ThreadAllocState t_state __attribute__((tls_model("initial-exec"))) = {0, 0, 0, false, false};
+
+std::atomic<bool> g_hooks_installed{false};
+std::atomic<uint64_t> g_allocations{0};
+std::atomic<uint64_t> g_frees{0};
+std::atomic<uint64_t> g_bytes{0};
+std::atomic<uint64_t> g_violations{0};
+std::atomic<uint8_t> g_strict_mode{static_cast<uint8_t>(BridgeAllocStrictMode::kOff)};
+
+void ReportViolation(size_t size, BridgeAllocStrictMode mode) {
+    g_violations.fetch_add(1, std::memory_order_relaxed);
+    if (mode == BridgeAllocStrictMode::kCount || t_state.reporting) {
+        return;
+    }
+    t_state.reporting = true;
+    char line[128];
+    const int length = std::snprintf(line, sizeof(line), "yj_alloc: %zu bytes allocated on realtime thread %ld\n",
+                                     size, static_cast<long>(::syscall(SYS_gettid)));
+    if (length > 0) {
+        ssize_t ret = ::write(STDERR_FILENO, line, static_cast<size_t>(length));
+        (void)ret;
+    }
+    void* frames[32];
+    const int depth = ::backtrace(frames, 32);
+    ::backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+    t_state.reporting = false;
+    if (mode == BridgeAllocStrictMode::kAbort) {
+        std::abort();
+    }
+}
+
+}
+
+bool BridgeAllocTracker::HooksInstalled() {
+    return g_hooks_installed.load(std::memory_order_relaxed);
+}
+
+void BridgeAllocTracker::SetHooksInstalled() {
+    g_hooks_installed.store(true, std::memory_order_relaxed);
+}
+
+uint64_t BridgeAllocTracker::ThreadAllocations() {
+    return t_state.allocations;
+}
+
+BridgeAllocCounters BridgeAllocTracker::ThreadCounters() {
+    BridgeAllocCounters counters;
+    counters.allocations = t_state.allocations;
+    counters.frees = t_state.frees;
+    counters.bytes = t_state.bytes;
+    return counters;
+}
+
+BridgeAllocCounters BridgeAllocTracker::ProcessCounters() {
+    BridgeAllocCounters counters;
+    counters.allocations = g_allocations.load(std::memory_order_relaxed);
+    counters.frees = g_frees.load(std::memory_order_relaxed);
+    counters.bytes = g_bytes.load(std::memory_order_relaxed);
+    return counters;
+}
+
+void BridgeAllocTracker::MarkRealtimeThread(bool realtime) {
+    if (realtime) {
+        // backtrace()首次调用会加载libgcc_s并分配内存，提前在非实时状态下触发
+        void* frame[1];
+        ::backtrace(frame, 1);
+    }
+    t_state.realtime = realtime;
+}
+
+bool BridgeAllocTracker::IsRealtimeThread() {
+    return t_state.realtime;
+}
+
+void BridgeAllocTracker::SetStrictMode(BridgeAllocStrictMode mode) {
+    g_strict_mode.store(static_cast<uint8_t>(mode), std::memory_order_relaxed);
+}
+
+BridgeAllocStrictMode BridgeAllocTracker::StrictMode() {
+    return static_cast<BridgeAllocStrictMode>(g_strict_mode.load(std::memory_order_relaxed));
+}
+
+uint64_t BridgeAllocTracker::RealtimeViolations() {
+    return g_violations.load(std::memory_order_relaxed);
+}
+
+void BridgeAllocTracker::OnAllocate(size_t size) {
+    ThreadAllocState& state = t_state;
+    ++state.allocations;
+    state.bytes += size;
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (state.realtime) {
+        const BridgeAllocStrictMode mode = StrictMode();
+        if (mode != BridgeAllocStrictMode::kOff) {
+            ReportViolation(size, mode);
+        }
+    }
+}
+
+void BridgeAllocTracker::OnFree() {
+    ++t_state.frees;
+    g_frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,78 @@
+/**
+ * @file bridge_alloc_hooks.cpp
+ * @brief 替换glibc malloc族函数的分配钩子
+ * @note 不编进yunji_sdk库，以yunji_alloc_hooks目标单独提供，只链接到基准和测试程序。
+ *       各函数计数后转发给glibc的__libc_*实现；operator new经由malloc，因此同样被统计。
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_alloc.hpp"
+
+#include <cerrno>
+#include <cstddef>
+
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+
+}
+
+namespace
+{
+
+using yunji::robot::BridgeAllocTracker;
+
+const bool kHooksInstalled = (BridgeAllocTracker::SetHooksInstalled(), true);
+
+}
+
+extern "C" {
+
+void* malloc(size_t size) {
+    BridgeAllocTracker::OnAllocate(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    BridgeAllocTracker::OnAllocate(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    BridgeAllocTracker::OnAllocate(size);
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    BridgeAllocTracker::OnAllocate(size);
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    BridgeAllocTracker::OnAllocate(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    BridgeAllocTracker::OnAllocate(size);
+    void* ptr = __libc_memalign(alignment, size);
+    if (ptr == nullptr) {
+        return ENOMEM;
+    }
+    *out = ptr;
+    return 0;
+}
+
+void free(void* ptr) {
+    if (ptr != nullptr) {
+        BridgeAllocTracker::OnFree();
+    }
+    __libc_free(ptr);
+}
+
+}
@@ -0,0 +1,64 @@
+/**
+ * @file bridge_clock.cpp
+ * @brief 桥接层时钟源实现文件
+ * @note 实现BridgeClock类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+
+#include <time.h>
+
+namespace yunji {
+namespace robot {
+
+namespace {
+
+int64_t ReadClock(clockid_t id) {
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+}
+
+int64_t BridgeClock::Now() const {
+    if (IsSimulated()) {
+        return sim_time_ns_.load(std::memory_order_acquire);
+    }
+    return ReadClock(CLOCK_MONOTONIC);
+}
+
+int64_t BridgeClock::WallTime() const {
+    if (IsSimulated()) {
+        return sim_time_ns_.load(std::memory_order_acquire);
+    }
+    return ReadClock(CLOCK_REALTIME);
+}
+
+void BridgeClock::UseSimulatedTime(int64_t start_ns) {
+    sim_time_ns_.store(start_ns, std::memory_order_release);
+    simulated_.store(true, std::memory_order_release);
+}
+
+void BridgeClock::UseSystemTime() {
+    simulated_.store(false, std::memory_order_release);
+}
+
+void BridgeClock::Advance(int64_t delta_ns) {
+    if (!IsSimulated() || delta_ns <= 0) {
+        return;
+    }
+    sim_time_ns_.fetch_add(delta_ns, std::memory_order_acq_rel);
+}
+
+void BridgeClock::Set(int64_t time_ns) {
+    if (!IsSimulated()) {
+        return;
+    }
+    int64_t current = sim_time_ns_.load(std::memory_order_acquire);
+    while (time_ns > current &&
+           !sim_time_ns_.compare_exchange_weak(current, time_ns, std::memory_order_acq_rel)) {
+    }
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,221 @@
+/**
+ * @file bridge_collector.cpp
+ * @brief 统计采集器实现文件
+ * @note 实现BridgeMetricsCollector与BridgeMetricsShmReader类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_collector.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_factory.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+static void CopyName(char* dst, size_t size, const std::string& src) {
+    const size_t len = src.size() < size - 1 ? src.size() : size - 1;
+    std::memcpy(dst, src.data(), len);
+    dst[len] = '\0';
+}
+
+BridgeMetricsCollector::BridgeMetricsCollector(const BridgeMetricsCollectorOptions& options)
+    : options_(options) {}
+
+BridgeMetricsCollector::~BridgeMetricsCollector() {
+    Stop();
+}
+
+bool BridgeMetricsCollector::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return true;
+    }
+    if (!options_.shm_name.empty() && region_ == nullptr && !OpenShm()) {
+        return false;
+    }
+    running_ = true;
+    thread_ = std::thread(&BridgeMetricsCollector::Run, this);
+    return true;
+}
+
+void BridgeMetricsCollector::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    CloseShm();
+}
+
+void BridgeMetricsCollector::CollectOnce() {
+    std::lock_guard<std::mutex> collect_lock(collect_mutex_);
+    BridgeMetricsSnapshot snapshot = BridgeFactory::Instance()->Metrics();
+    if (region_ != nullptr) {
+        WriteShm(snapshot);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    latest_ = std::move(snapshot);
+}
+
+BridgeMetricsSnapshot BridgeMetricsCollector::Latest() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return latest_;
+}
+
+void BridgeMetricsCollector::Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto deadline = std::chrono::steady_clock::now();
+    while (running_) {
+        deadline += options_.period;
+        if (cv_.wait_until(lock, deadline, [this]() { return !running_; })) {
+            break;
+        }
+        lock.unlock();
+        CollectOnce();
+        lock.lock();
+    }
+}
+
+bool BridgeMetricsCollector::OpenShm() {
+    const int fd = ::shm_open(options_.shm_name.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        std::cerr << "Metrics shm_open failed: " << options_.shm_name << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    if (::ftruncate(fd, sizeof(BridgeShmMetricsRegion)) != 0) {
+        std::cerr << "Metrics shm ftruncate failed: " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+    void* addr = ::mmap(nullptr, sizeof(BridgeShmMetricsRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        std::cerr << "Metrics shm mmap failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    region_ = static_cast<BridgeShmMetricsRegion*>(addr);
+    region_->sequence.store(0, std::memory_order_relaxed);
+    region_->time_ns = 0;
+    region_->pid = static_cast<uint32_t>(::getpid());
+    region_->topic_count = 0;
+    region_->version = kBridgeMetricsShmVersion;
+    // magic最后写入，读者据此判断区域已初始化
+    std::atomic_thread_fence(std::memory_order_release);
+    region_->magic = kBridgeMetricsShmMagic;
+    return true;
+}
+
+void BridgeMetricsCollector::CloseShm() {
+    if (region_ == nullptr) {
+        return;
+    }
+    ::munmap(region_, sizeof(BridgeShmMetricsRegion));
+    ::shm_unlink(options_.shm_name.c_str());
+    region_ = nullptr;
+}
+
+void BridgeMetricsCollector::WriteShm(const BridgeMetricsSnapshot& snapshot) {
+    const uint64_t sequence = region_->sequence.load(std::memory_order_relaxed);
+    region_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const size_t count = snapshot.topics.size() < kBridgeMetricsShmMaxTopics
+                             ? snapshot.topics.size() : kBridgeMetricsShmMaxTopics;
+    region_->time_ns = snapshot.time_ns;
+    region_->topic_count = static_cast<uint32_t>(count);
+    for (size_t i = 0; i < count; ++i) {
+        const BridgeTopicMetricsSnapshot& src = snapshot.topics[i];
+        BridgeShmTopicMetrics& dst = region_->topics[i];
+        const bool is_pub = src.kind == BridgeEndpointKind::kPublisher;
+        const BridgeHistogramSnapshot& hist = is_pub ? src.publish_ns : src.latency_ns;
+
+        CopyName(dst.topic, sizeof(dst.topic), src.topic);
+        CopyName(dst.type, sizeof(dst.type), src.type);
+        dst.kind = static_cast<uint32_t>(src.kind);
+        dst.messages = src.messages;
+        dst.bytes = src.bytes;
+        dst.message_rate = src.message_rate;
+        dst.byte_rate = src.byte_rate;
+        dst.latency_p50_ns = hist.Percentile(0.5);
+        dst.latency_p99_ns = hist.Percentile(0.99);
+        dst.latency_p999_ns = hist.Percentile(0.999);
+        dst.latency_max_ns = hist.max;
+        dst.callback_p99_ns = is_pub ? 0 : src.callback_ns.Percentile(0.99);
+        dst.callback_max_ns = is_pub ? 0 : src.callback_ns.max;
+
+        const size_t stat_count = src.dds_statistics.size() < kBridgeMetricsShmMaxDdsStats
+                                      ? src.dds_statistics.size() : kBridgeMetricsShmMaxDdsStats;
+        dst.dds_stat_count = static_cast<uint32_t>(stat_count);
+        for (size_t j = 0; j < stat_count; ++j) {
+            CopyName(dst.dds_stats[j].name, sizeof(dst.dds_stats[j].name), src.dds_statistics[j].name);
+            dst.dds_stats[j].value = src.dds_statistics[j].value;
+            dst.dds_stats[j].rate = src.dds_statistics[j].rate;
+        }
+    }
+
+    region_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+BridgeMetricsShmReader::~BridgeMetricsShmReader() {
+    Close();
+}
+
+bool BridgeMetricsShmReader::Open(const std::string& shm_name) {
+    Close();
+    const int fd = ::shm_open(shm_name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    void* addr = ::mmap(nullptr, sizeof(BridgeShmMetricsRegion), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    region_ = static_cast<const BridgeShmMetricsRegion*>(addr);
+    return true;
+}
+
+void BridgeMetricsShmReader::Close() {
+    if (region_ != nullptr) {
+        ::munmap(const_cast<BridgeShmMetricsRegion*>(region_), sizeof(BridgeShmMetricsRegion));
+        region_ = nullptr;
+    }
+}
+
+bool BridgeMetricsShmReader::Read(BridgeShmMetricsRegion& out, int max_retries) const {
+    if (region_ == nullptr || region_->magic != kBridgeMetricsShmMagic ||
+        region_->version != kBridgeMetricsShmVersion) {
+        return false;
+    }
+    for (int i = 0; i < max_retries; ++i) {
+        const uint64_t before = region_->sequence.load(std::memory_order_acquire);
+        if (before == 0 || (before & 1) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        out.magic = region_->magic;
+        out.version = region_->version;
+        out.time_ns = region_->time_ns;
+        out.pid = region_->pid;
+        out.topic_count = region_->topic_count;
+        const size_t count = out.topic_count < kBridgeMetricsShmMaxTopics ? out.topic_count : kBridgeMetricsShmMaxTopics;
+        std::memcpy(out.topics, region_->topics, count * sizeof(BridgeShmTopicMetrics));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (region_->sequence.load(std::memory_order_relaxed) == before) {
+            out.sequence.store(before, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,79 @@
+/**
+ * @file bridge_decimation.cpp
+ * @brief 订阅端抽稀实现文件
+ * @note 实现BridgeDecimator按实例的计数、时间间隔与窗口判定
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_decimation.hpp"
+
+#include <dds/ddsi/ddsi_serdata.h>
+
+#include <utility>
+
+namespace yunji {
+namespace robot {
+
+BridgeDecimator::~BridgeDecimator() {
+    for (auto& entry : instances_) {
+        if (entry.second.pending != nullptr) {
+            ddsi_serdata_unref(entry.second.pending);
+        }
+    }
+}
+
+ddsi_serdata* BridgeDecimator::Offer(ddsi_serdata* serdata, dds_sample_info_t& info) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (last_instance_ == nullptr || last_handle_ != info.instance_handle) {
+        last_instance_ = &instances_[info.instance_handle];     // 节点地址在rehash后不变
+        last_handle_ = info.instance_handle;
+    }
+    Instance& instance = *last_instance_;
+    if (options_.keep_every > 1 && instance.count++ % options_.keep_every != 0) {
+        dropped_every_.fetch_add(1, std::memory_order_relaxed);
+        ddsi_serdata_unref(serdata);
+        return nullptr;
+    }
+    if (options_.min_separation.count() > 0) {
+        if (instance.last_delivered != INT64_MIN &&
+            info.source_timestamp - instance.last_delivered < options_.min_separation.count()) {
+            dropped_separation_.fetch_add(1, std::memory_order_relaxed);
+            ddsi_serdata_unref(serdata);
+            return nullptr;
+        }
+        instance.last_delivered = info.source_timestamp;
+    }
+    if (options_.window.count() <= 0) {
+        delivered_.fetch_add(1, std::memory_order_relaxed);
+        return serdata;
+    }
+
+    const int64_t window = info.source_timestamp / options_.window.count();
+    ddsi_serdata* released = nullptr;
+    if (instance.pending != nullptr) {
+        if (instance.window == window) {
+            dropped_window_.fetch_add(1, std::memory_order_relaxed);
+            ddsi_serdata_unref(instance.pending);
+        } else {
+            released = instance.pending;        // 上一个窗口已结束，其最新样本即为该窗口的结果
+        }
+    }
+    instance.pending = serdata;
+    instance.window = window;
+    std::swap(instance.pending_info, info);
+    if (released == nullptr) {
+        return nullptr;
+    }
+    delivered_.fetch_add(1, std::memory_order_relaxed);
+    return released;
+}
+
+BridgeDecimationStats BridgeDecimator::Stats() const {
+    BridgeDecimationStats stats;
+    stats.delivered = delivered_.load(std::memory_order_relaxed);
+    stats.dropped_every = dropped_every_.load(std::memory_order_relaxed);
+    stats.dropped_separation = dropped_separation_.load(std::memory_order_relaxed);
+    stats.dropped_window = dropped_window_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,77 @@
+/**
+ * @file bridge_discovery.cpp
+ * @brief 发现参数配置实现文件
+ * @note 实现发现参数到Cyclone XML配置的转换
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_discovery.hpp"
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+std::string Milliseconds(std::chrono::milliseconds duration) {
+    return std::to_string(duration.count()) + " ms";
+}
+
+}
+
+BridgeDiscoveryOptions BridgeDiscoveryOptions::Fast(const std::vector<std::string>& peers) {
+    BridgeDiscoveryOptions options;
+    options.allow_multicast = false;
+    options.peers = peers;
+    options.spdp_interval = std::chrono::milliseconds(1000);
+    options.lease_duration = std::chrono::milliseconds(3000);
+    options.heartbeat_interval = std::chrono::milliseconds(20);
+    return options;
+}
+
+std::string BridgeDiscoveryConfigXml(const BridgeDiscoveryOptions& options) {
+    std::string general;
+    if (!options.network_interface.empty()) {
+        general += "<NetworkInterfaceAddress>" + options.network_interface + "</NetworkInterfaceAddress>";
+    }
+    if (!options.allow_multicast) {
+        general += "<AllowMulticast>false</AllowMulticast>";
+    }
+
+    std::string discovery;
+    if (!options.peers.empty()) {
+        // 静态对端需要可预测的端口：按参与者序号分配，对端逐个序号探测
+        discovery += "<ParticipantIndex>auto</ParticipantIndex>"
+                     "<MaxAutoParticipantIndex>" + std::to_string(options.max_participant_index) +
+                     "</MaxAutoParticipantIndex><Peers>";
+        for (const auto& peer : options.peers) {
+            discovery += "<Peer address=\"" + peer + "\"/>";
+        }
+        discovery += "</Peers>";
+    }
+    if (options.spdp_interval.count() > 0) {
+        discovery += "<SPDPInterval>" + Milliseconds(options.spdp_interval) + "</SPDPInterval>";
+    }
+    if (options.lease_duration.count() > 0) {
+        discovery += "<LeaseDuration>" + Milliseconds(options.lease_duration) + "</LeaseDuration>";
+    }
+
+    std::string internal;
+    if (options.heartbeat_interval.count() > 0) {
+        internal += "<HeartbeatInterval>" + Milliseconds(options.heartbeat_interval) + "</HeartbeatInterval>";
+    }
+
+    std::string config = "<CycloneDDS><Domain id=\"any\">";
+    if (!general.empty()) {
+        config += "<General>" + general + "</General>";
+    }
+    if (!discovery.empty()) {
+        config += "<Discovery>" + discovery + "</Discovery>";
+    }
+    if (!internal.empty()) {
+        config += "<Internal>" + internal + "</Internal>";
+    }
+    config += "</Domain></CycloneDDS>";
+    return config;
+}
+
+} // namespace robot
+} // namespace yunji
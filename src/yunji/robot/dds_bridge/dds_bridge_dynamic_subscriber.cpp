@@ -0,0 +1,375 @@
+/**
+ * @file bridge_dynamic_subscriber.cpp
+ * @brief 动态类型订阅者实现文件
+ * @note 实现BridgeDynamicSubscriber类的发布端发现、类型解析与序列化数据分发
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_subscriber.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_time_sync.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_trace.hpp"
+
+#include <dds/ddsi/ddsi_serdata.h>
+
+#include <iostream>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+constexpr dds_duration_t kResolveTimeout = DDS_SECS(5);     // 类型查找服务等待远端回复的时长
+constexpr size_t kPublicationBatch = 16;
+// 只读取未读过的发布端样本：样本留在内置读者中，解析失败后可按实例重新读取
+constexpr uint32_t kUnreadMask = DDS_NOT_READ_SAMPLE_STATE | DDS_ANY_VIEW_STATE | DDS_ANY_INSTANCE_STATE;
+
+}
+
+BridgeDynamicSubscriber::BridgeDynamicSubscriber(const std::string& topic)
+    : participant_(BridgeFactory::Instance()->GetParticipant()), topic_name_(topic) {
+    if (participant_) {
+        participant_entity_ = participant_->delegate()->get_ddsc_entity();
+    }
+}
+
+BridgeDynamicSubscriber::~BridgeDynamicSubscriber() {
+    running_ = false;
+    if (waitset_ > 0) {
+        dds_waitset_set_trigger(waitset_, true);       //唤醒等待线程，无需等到超时
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (reader_ > 0) {
+        dds_set_listener(reader_, nullptr);
+    }
+    if (handle_) {
+        executor_->Remove(handle_);
+    }
+    if (metrics_registered_) {
+        BridgeFactory::Instance()->UnregisterMetrics(metrics_);
+    }
+    for (dds_entity_t entity : {waitset_, reader_, subscriber_, publications_, topic_}) {
+        if (entity > 0) {
+            dds_delete(entity);
+        }
+    }
+}
+
+void BridgeDynamicSubscriber::SetExecutor(BridgeExecutorPtr executor, BridgePriority priority,
+                                          BridgeCallbackGroupPtr group) {
+    executor_ = std::move(executor);
+    priority_ = priority;
+    group_ = std::move(group);
+}
+
+bool BridgeDynamicSubscriber::InitBridge(CallbackType callback) {
+    if (participant_entity_ <= 0) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << " init failed: no participant" << std::endl;
+        return false;
+    }
+    callback_ = std::move(callback);
+    if (executor_) {
+        handle_ = executor_->Add(this, priority_, group_);
+    }
+    publications_ = dds_create_reader(participant_entity_, DDS_BUILTIN_TOPIC_DCPSPUBLICATION, nullptr, nullptr);
+    waitset_ = dds_create_waitset(participant_entity_);
+    if (publications_ < 0 || waitset_ < 0) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << " init failed: "
+                  << dds_strretcode(publications_ < 0 ? publications_ : waitset_) << std::endl;
+        return false;
+    }
+    const dds_entity_t condition = dds_create_readcondition(publications_, kUnreadMask);
+    if (condition < 0 || dds_waitset_attach(waitset_, condition, 0) < 0) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << " init failed: attach read condition failed"
+                  << std::endl;
+        return false;
+    }
+    thread_ = std::thread(&BridgeDynamicSubscriber::Run, this);
+    return true;
+}
+
+bool BridgeDynamicSubscriber::WaitForType(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(resolved_mutex_);
+    return resolved_cv_.wait_for(lock, timeout, [this]() { return IsResolved(); });
+}
+
+int32_t BridgeDynamicSubscriber::MatchedPublishers() const {
+    const dds_entity_t reader = reader_entity_.load(std::memory_order_acquire);
+    dds_subscription_matched_status_t status;
+    if (reader == 0 || dds_get_subscription_matched_status(reader, &status) < 0) {
+        return 0;
+    }
+    return static_cast<int32_t>(status.current_count);
+}
+
+void BridgeDynamicSubscriber::Run() {
+    while (running_) {
+        const dds_return_t triggered = dds_waitset_wait(waitset_, nullptr, 0, DDS_SECS(2));
+        if (triggered < 0) {
+            std::cerr << "WaitSet wait error: " << dds_strretcode(triggered) << std::endl;
+            break;
+        }
+        if (!running_) {
+            continue;
+        }
+        if (!IsResolved()) {
+            // 等待超时时重试之前解析失败的发布端
+            if ((triggered == 0 && retry_.empty()) || !PollPublications(triggered == 0)) {
+                continue;
+            }
+            if (executor_) {
+                return;     // 之后由执行器调度，发现线程退出
+            }
+            const dds_entity_t condition = dds_create_readcondition(reader_, DDS_ANY_STATE);
+            if (condition < 0 || dds_waitset_attach(waitset_, condition, 0) < 0) {
+                std::cerr << "Dynamic subscriber " << topic_name_ << ": attach read condition failed" << std::endl;
+                break;
+            }
+            continue;
+        }
+        if (triggered == 0) {
+            continue;       // 超时正常，忽略
+        }
+        try {
+            Execute(0);
+        } catch (const std::exception& e) {
+            std::cerr << "WaitSet dispatch error: " << e.what() << std::endl;
+        }
+    }
+}
+
+bool BridgeDynamicSubscriber::PollPublications(bool retry) {
+    std::array<void*, kPublicationBatch> samples{};
+    std::array<dds_sample_info_t, kPublicationBatch> infos{};
+    bool resolved = false;
+    if (retry) {
+        // 按实例重新读取之前失败的发布端，实例已不存在的不再重试
+        std::vector<dds_instance_handle_t> pending;
+        pending.swap(retry_);
+        for (size_t i = 0; i < pending.size() && !resolved; ++i) {
+            const dds_return_t count = dds_read_instance(publications_, samples.data(), infos.data(), 1, 1, pending[i]);
+            if (count > 0) {
+                resolved = TryPublication(samples[0], infos[0]);
+                dds_return_loan(publications_, samples.data(), count);
+            }
+        }
+    }
+    while (!resolved) {
+        const dds_return_t count = dds_read_mask(publications_, samples.data(), infos.data(), kPublicationBatch,
+                                                 kPublicationBatch, kUnreadMask);
+        if (count <= 0) {
+            return false;
+        }
+        for (dds_return_t i = 0; i < count && !resolved; ++i) {
+            resolved = TryPublication(samples[i], infos[i]);
+        }
+        dds_return_loan(publications_, samples.data(), count);
+    }
+
+    // 类型已确定，不再需要内置读者（连同其读条件从等待集移除）
+    dds_delete(publications_);
+    publications_ = 0;
+    {
+        std::lock_guard<std::mutex> lock(resolved_mutex_);
+        resolved_.store(true, std::memory_order_release);
+    }
+    resolved_cv_.notify_all();
+    if (executor_) {
+        executor_->Notify(handle_);     //取走挂监听器之前已到达的数据
+    }
+    return true;
+}
+
+bool BridgeDynamicSubscriber::TryPublication(void* sample, const dds_sample_info_t& info) {
+    if (!info.valid_data || info.instance_state != DDS_IST_ALIVE) {
+        return false;
+    }
+    auto* endpoint = static_cast<dds_builtintopic_endpoint_t*>(sample);
+    if (topic_name_ != endpoint->topic_name || (!type_filter_.empty() && type_filter_ != endpoint->type_name)) {
+        return false;
+    }
+    const dds_typeinfo_t* type_info = nullptr;
+    if (dds_builtintopic_get_endpoint_type_info(endpoint, &type_info) < 0 || type_info == nullptr) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << ": publisher of " << endpoint->type_name
+                  << " carries no type information" << std::endl;
+        return false;
+    }
+    if (!Resolve(type_info)) {
+        retry_.push_back(info.instance_handle);     // 如类型查找超时，等待超时后重试
+        return false;
+    }
+    if (!CreateReader()) {
+        // 释放本次创建的话题，下次重试时重新解析
+        dds_delete(topic_);
+        topic_ = 0;
+        retry_.push_back(info.instance_handle);
+        return false;
+    }
+    return true;
+}
+
+bool BridgeDynamicSubscriber::Resolve(const dds_typeinfo_t* type_info) {
+    dds_topic_descriptor_t* descriptor = nullptr;
+    const dds_return_t ret = dds_create_topic_descriptor(DDS_FIND_SCOPE_GLOBAL, participant_entity_, type_info,
+                                                         kResolveTimeout, &descriptor);
+    if (ret < 0) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << ": type lookup failed: " << dds_strretcode(ret)
+                  << std::endl;
+        return false;
+    }
+    type_name_ = descriptor->m_typename;
+    type_map_.assign(descriptor->type_mapping.data, descriptor->type_mapping.data + descriptor->type_mapping.sz);
+    BridgeDynamicTypePtr type;
+    std::string error;
+    bool ok = BridgeParseTypeMap(type_map_, type_name_, type, &error) && layout_.Build(type);
+    if (ok) {
+        topic_ = dds_create_topic(participant_entity_, descriptor, topic_name_.c_str(), nullptr, nullptr);
+        ok = topic_ > 0;
+        if (!ok) {
+            error = dds_strretcode(topic_);
+            topic_ = 0;
+        }
+    }
+    dds_delete_topic_descriptor(descriptor);
+    if (!ok) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << ": type " << type_name_ << " unusable: " << error
+                  << std::endl;
+    }
+    return ok;
+}
+
+bool BridgeDynamicSubscriber::CreateReader() {
+    dds_entity_t parent = participant_entity_;
+    if (!partitions_.empty()) {
+        const dds::sub::qos::SubscriberQos subscriber_qos =
+            BridgeSubscriberQos(partitions_, dds::sub::qos::SubscriberQos());
+        dds_qos_t* qos = subscriber_qos.delegate().ddsc_qos();
+        subscriber_ = dds_create_subscriber(participant_entity_, qos, nullptr);
+        dds_delete_qos(qos);
+        if (subscriber_ < 0) {
+            std::cerr << "Dynamic subscriber " << topic_name_ << ": create subscriber failed: "
+                      << dds_strretcode(subscriber_) << std::endl;
+            subscriber_ = 0;
+            return false;
+        }
+        parent = subscriber_;
+    }
+    const dds::sub::qos::DataReaderQos reader_qos = BridgeReaderQos(qos_preset_, dds::sub::qos::DataReaderQos());
+    dds_qos_t* qos = reader_qos.delegate().ddsc_qos();
+    dds_listener_t* listener = nullptr;
+    if (executor_ && !executor_->IsStepping()) {
+        // 执行器模式：数据到达时由监听器通知执行器；步进模式不挂监听器，由Step()轮询
+        listener = dds_create_listener(this);
+        dds_lset_data_available(listener, &BridgeDynamicSubscriber::OnDataAvailable);
+    }
+    reader_ = dds_create_reader(parent, topic_, qos, listener);
+    dds_delete_qos(qos);
+    if (listener != nullptr) {
+        dds_delete_listener(listener);
+    }
+    if (reader_ < 0) {
+        std::cerr << "Dynamic subscriber " << topic_name_ << ": create reader failed: " << dds_strretcode(reader_)
+                  << std::endl;
+        reader_ = 0;
+        if (subscriber_ > 0) {
+            dds_delete(subscriber_);
+            subscriber_ = 0;
+        }
+        return false;
+    }
+    metrics_ = std::make_shared<BridgeTopicMetrics>(BridgeEndpointKind::kSubscriber, topic_name_, type_name_);
+    metrics_->SetEntity(reader_);
+    BridgeFactory::Instance()->RegisterMetrics(metrics_);
+    metrics_registered_ = true;
+    reader_entity_.store(reader_, std::memory_order_release);
+    return true;
+}
+
+void BridgeDynamicSubscriber::OnDataAvailable(dds_entity_t, void* arg) {
+    auto* self = static_cast<BridgeDynamicSubscriber*>(arg);
+    self->executor_->Notify(self->handle_);
+}
+
+size_t BridgeDynamicSubscriber::Execute(size_t max_samples) {
+    const dds_entity_t reader = reader_entity_.load(std::memory_order_acquire);
+    if (reader == 0) {
+        return 0;       // 类型尚未解析，或监听器先于读者登记完成触发
+    }
+    std::lock_guard<std::mutex> lock(take_mutex_);
+    size_t total = 0;
+    while (max_samples == 0 || total < max_samples) {
+        const size_t limit = max_samples == 0 ? kTakeBatch : std::min(kTakeBatch, max_samples - total);
+        const dds_return_t ret = dds_takecdr(reader, serdata_.data(), static_cast<uint32_t>(limit), infos_.data(),
+                                             DDS_ANY_STATE);
+        const size_t count = ret > 0 ? static_cast<size_t>(ret) : 0;
+        Deliver(count);
+        total += count;
+        if (count < limit) {
+            break;
+        }
+    }
+    return total;
+}
+
+size_t BridgeDynamicSubscriber::Deliver(size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    size_t delivered = 0;
+    const int64_t now_ns = BridgeClock::Instance()->WallTime();
+    BridgeTimeSync* time_sync = BridgeTimeSync::Instance();
+    const BridgePublicationOffsetsPtr offsets = time_sync->PublicationOffsets();
+    for (size_t i = 0; i < count; ++i) {
+        ddsi_serdata* serdata = serdata_[i];
+        const dds_sample_info_t& info = infos_[i];
+        if (info.valid_data) {
+            // 接收到的序列化数据通常是连续的，直接引用；否则拷贝到临时缓冲
+            const uint32_t size = ddsi_serdata_size(serdata);
+            ddsrt_iovec_t ref{};
+            ddsi_serdata* held = ddsi_serdata_to_ser_ref(serdata, 0, size, &ref);
+            const uint8_t* payload = static_cast<const uint8_t*>(ref.iov_base);
+            if (held == nullptr || ref.iov_len != size) {
+                if (held != nullptr) {
+                    ddsi_serdata_to_ser_unref(held, &ref);
+                    held = nullptr;
+                }
+                scratch_.resize(size);
+                ddsi_serdata_to_ser(serdata, 0, size, scratch_.data());
+                payload = scratch_.data();
+            }
+
+            int64_t latency_ns = now_ns - info.source_timestamp;
+            int64_t offset_ns = 0;
+            if (offsets && time_sync->PublicationOffset(*offsets, reader_, info.publication_handle, now_ns, offset_ns)) {
+                latency_ns += offset_ns;        // 源时间戳换算到本地时钟
+            }
+            metrics_->latency_ns.Record(latency_ns > 0 ? static_cast<uint64_t>(latency_ns) : 0);
+            metrics_->AddMessage(size);
+
+            if (!decode_ || sample_.view.Bind(layout_, payload, size)) {
+                sample_.payload = payload;
+                sample_.size = size;
+                sample_.source_ns = info.source_timestamp;
+                sample_.receive_ns = now_ns;
+                sample_.latency_ns = latency_ns;
+                sample_.publication_handle = info.publication_handle;
+                const int64_t start = BridgeTracer::NowNs();
+                callback_(sample_);
+                metrics_->callback_ns.Record(
+                    static_cast<uint64_t>(BridgeTracer::NowNs() - start));
+                ++delivered;
+            } else {
+                decode_errors_.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (held != nullptr) {
+                ddsi_serdata_to_ser_unref(held, &ref);
+            }
+        }
+        ddsi_serdata_unref(serdata);
+    }
+    return delivered;
+}
+
+} // namespace robot
+} // namespace yunji
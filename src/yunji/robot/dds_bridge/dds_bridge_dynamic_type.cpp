@@ -0,0 +1,1072 @@
+/**
+ * @file bridge_dynamic_type.cpp
+ * @brief 动态类型实现文件
+ * @note 实现TypeMapping解析、字段展开与CDR样本解析
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_type.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+// XTypes类型标识（TypeIdentifier联合的判别值）与类型对象种类
+constexpr uint8_t kTiStringSmall = 0x70;
+constexpr uint8_t kTiStringLarge = 0x71;
+constexpr uint8_t kTiSequenceSmall = 0x80;
+constexpr uint8_t kTiSequenceLarge = 0x81;
+constexpr uint8_t kTiArraySmall = 0x90;
+constexpr uint8_t kTiArrayLarge = 0x91;
+constexpr uint8_t kEkMinimal = 0xf1;
+constexpr uint8_t kEkComplete = 0xf2;
+constexpr uint8_t kTkAlias = 0x30;
+constexpr uint8_t kTkEnum = 0x40;
+constexpr uint8_t kTkStructure = 0x51;
+constexpr size_t kEquivalenceHashSize = 14;
+constexpr uint16_t kStructAppendable = 0x0002;
+constexpr uint16_t kStructMutable = 0x0004;
+constexpr uint16_t kMemberOptional = 0x0008;
+constexpr uint16_t kMemberKey = 0x0020;
+constexpr int kMaxDepth = 32;
+
+bool HostLittleEndian() {
+    const uint16_t probe = 1;
+    uint8_t first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+/**
+ * @brief XCDR2小端的类型描述读取器，越界后ok()为false且后续读取返回0
+ */
+class BlobReader {
+public:
+    BlobReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    bool Ok() const { return ok_; }
+    size_t Pos() const { return pos_; }
+    void Seek(size_t pos) {
+        if (pos > size_) {
+            ok_ = false;
+        }
+        pos_ = std::min(pos, size_);
+    }
+    void Align(size_t n) { Seek((pos_ + n - 1) / n * n); }
+
+    uint8_t U8() { return Need(1) ? data_[pos_++] : 0; }
+    uint16_t U16() {
+        Align(2);
+        if (!Need(2)) {
+            return 0;
+        }
+        const uint16_t value = static_cast<uint16_t>(data_[pos_] | (data_[pos_ + 1] << 8));
+        pos_ += 2;
+        return value;
+    }
+    uint32_t U32() {
+        Align(4);
+        if (!Need(4)) {
+            return 0;
+        }
+        const uint32_t value = static_cast<uint32_t>(data_[pos_]) | (static_cast<uint32_t>(data_[pos_ + 1]) << 8) |
+                               (static_cast<uint32_t>(data_[pos_ + 2]) << 16) |
+                               (static_cast<uint32_t>(data_[pos_ + 3]) << 24);
+        pos_ += 4;
+        return value;
+    }
+    std::string Bytes(size_t n) {
+        if (!Need(n)) {
+            return std::string();
+        }
+        std::string value(reinterpret_cast<const char*>(data_ + pos_), n);
+        pos_ += n;
+        return value;
+    }
+    std::string String() {
+        const uint32_t length = U32();
+        std::string value = Bytes(length);
+        if (!value.empty() && value.back() == '\0') {
+            value.pop_back();
+        }
+        return value;
+    }
+    /**
+     * @brief 读取DHEADER，返回其界定内容的结束位置
+     */
+    size_t DHeader() {
+        const uint32_t length = U32();
+        return pos_ + length;
+    }
+
+private:
+    bool Need(size_t n) {
+        if (!ok_ || pos_ + n > size_) {
+            ok_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+BridgeDynamicTypePtr MakePrimitive(BridgeDynamicKind kind) {
+    auto type = std::make_shared<BridgeDynamicType>();
+    type->kind = kind;
+    return type;
+}
+
+bool PrimitiveKind(uint8_t tk, BridgeDynamicKind& kind) {
+    switch (tk) {
+    case 0x01: kind = BridgeDynamicKind::kBool; return true;
+    case 0x02: kind = BridgeDynamicKind::kUint8; return true;       // octet
+    case 0x03: kind = BridgeDynamicKind::kInt16; return true;
+    case 0x04: kind = BridgeDynamicKind::kInt32; return true;
+    case 0x05: kind = BridgeDynamicKind::kInt64; return true;
+    case 0x06: kind = BridgeDynamicKind::kUint16; return true;
+    case 0x07: kind = BridgeDynamicKind::kUint32; return true;
+    case 0x08: kind = BridgeDynamicKind::kUint64; return true;
+    case 0x09: kind = BridgeDynamicKind::kFloat32; return true;
+    case 0x0a: kind = BridgeDynamicKind::kFloat64; return true;
+    case 0x0c: kind = BridgeDynamicKind::kInt8; return true;
+    case 0x0d: kind = BridgeDynamicKind::kUint8; return true;
+    case 0x10: kind = BridgeDynamicKind::kChar; return true;
+    default: return false;
+    }
+}
+
+/**
+ * @brief TypeMapping解析：先索引所有COMPLETE类型对象，再按需递归构造类型树
+ */
+class TypeMapParser {
+public:
+    explicit TypeMapParser(const std::vector<uint8_t>& map) : map_(map) {}
+
+    bool Load() {
+        BlobReader reader(map_.data(), map_.size());
+        reader.Seek(reader.DHeader());          // identifier_object_pair_minimal
+        const size_t end = reader.DHeader();    // identifier_object_pair_complete
+        const uint32_t count = reader.U32();
+        for (uint32_t i = 0; i < count && reader.Ok(); ++i) {
+            const uint8_t kind = reader.U8();
+            const std::string hash = reader.Bytes(kEquivalenceHashSize);
+            const size_t object_end = reader.DHeader();
+            if (kind == kEkComplete) {
+                objects_[hash] = reader.Pos();
+            }
+            reader.Seek(object_end);
+        }
+        reader.Seek(end);
+        if (!reader.Ok()) {
+            error_ = "truncated type map";
+            return false;
+        }
+        return true;
+    }
+
+    BridgeDynamicTypePtr FindByName(const std::string& name) {
+        for (const auto& object : objects_) {
+            BridgeDynamicTypePtr type = Resolve(object.first, 0);
+            if (type && type->kind == BridgeDynamicKind::kStruct && type->name == name) {
+                return type;
+            }
+        }
+        if (error_.empty()) {
+            error_ = "type " + name + " not found in type map";
+        }
+        return nullptr;
+    }
+
+    const std::string& Error() const { return error_; }
+
+private:
+    BridgeDynamicTypePtr Fail(const std::string& error) {
+        if (error_.empty()) {
+            error_ = error;
+        }
+        return nullptr;
+    }
+
+    BridgeDynamicTypePtr Resolve(const std::string& hash, int depth) {
+        auto cached = cache_.find(hash);
+        if (cached != cache_.end()) {
+            return cached->second;
+        }
+        auto object = objects_.find(hash);
+        if (object == objects_.end()) {
+            return Fail("referenced type object missing");
+        }
+        if (depth > kMaxDepth) {
+            return Fail("type nesting too deep (recursive types are not supported)");
+        }
+        BlobReader reader(map_.data(), map_.size());
+        reader.Seek(object->second);
+        BridgeDynamicTypePtr type = ParseObject(reader, depth + 1);
+        if (type) {
+            cache_[hash] = type;
+        }
+        return type;
+    }
+
+    /**
+     * @brief CompleteTypeDetail：可选的内置/自定义注解（跳过）与类型名
+     */
+    std::string TypeDetail(BlobReader& reader) {
+        if (reader.U8() != 0) {
+            reader.Seek(reader.DHeader());
+        }
+        if (reader.U8() != 0) {
+            reader.Seek(reader.DHeader());
+        }
+        return reader.String();
+    }
+
+    BridgeDynamicTypePtr ParseObject(BlobReader& reader, int depth) {
+        if (reader.U8() != kEkComplete) {
+            return Fail("expected complete type object");
+        }
+        const uint8_t tk = reader.U8();
+        if (tk == kTkStructure) {
+            auto type = std::make_shared<BridgeDynamicType>();
+            type->kind = BridgeDynamicKind::kStruct;
+            const uint16_t flags = reader.U16();
+            type->extensibility = (flags & kStructMutable) ? BridgeExtensibility::kMutable
+                                : (flags & kStructAppendable) ? BridgeExtensibility::kAppendable
+                                : BridgeExtensibility::kFinal;
+            const size_t header_end = reader.DHeader();
+            if (reader.U8() != 0) {
+                reader.Seek(reader.Pos() - 1);
+                BridgeDynamicTypePtr base = ParseTypeId(reader, depth);
+                if (!base || base->kind != BridgeDynamicKind::kStruct) {
+                    return Fail("invalid base type");
+                }
+                type->members = base->members;
+            }
+            type->name = TypeDetail(reader);
+            reader.Seek(header_end);
+            const size_t members_end = reader.DHeader();
+            const uint32_t count = reader.U32();
+            for (uint32_t i = 0; i < count && reader.Ok(); ++i) {
+                const size_t member_end = reader.DHeader();
+                BridgeDynamicMember member;
+                member.id = reader.U32();
+                const uint16_t member_flags = reader.U16();
+                member.key = (member_flags & kMemberKey) != 0;
+                member.optional = (member_flags & kMemberOptional) != 0;
+                member.type = ParseTypeId(reader, depth);
+                if (!member.type) {
+                    return nullptr;
+                }
+                member.name = reader.String();
+                reader.Seek(member_end);
+                type->members.push_back(std::move(member));
+            }
+            reader.Seek(members_end);
+            return reader.Ok() ? type : Fail("truncated struct type object");
+        }
+        if (tk == kTkEnum) {
+            auto type = std::make_shared<BridgeDynamicType>();
+            type->kind = BridgeDynamicKind::kEnum;
+            reader.U16();
+            const size_t header_end = reader.DHeader();
+            type->bound = reader.U16();
+            type->name = TypeDetail(reader);
+            reader.Seek(header_end);
+            return reader.Ok() ? type : Fail("truncated enum type object");
+        }
+        if (tk == kTkAlias) {
+            reader.U16();
+            reader.Seek(reader.DHeader());
+            reader.DHeader();
+            reader.U16();
+            return ParseTypeId(reader, depth);
+        }
+        char message[64];
+        std::snprintf(message, sizeof(message), "unsupported type kind 0x%02x", tk);
+        return Fail(message);
+    }
+
+    BridgeDynamicTypePtr ParseTypeId(BlobReader& reader, int depth) {
+        const uint8_t discriminator = reader.U8();
+        BridgeDynamicKind primitive;
+        if (PrimitiveKind(discriminator, primitive)) {
+            return MakePrimitive(primitive);
+        }
+        auto type = std::make_shared<BridgeDynamicType>();
+        switch (discriminator) {
+        case kTiStringSmall:
+        case kTiStringLarge:
+            type->kind = BridgeDynamicKind::kString;
+            type->bound = discriminator == kTiStringSmall ? reader.U8() : reader.U32();
+            return type;
+        case kTiSequenceSmall:
+        case kTiSequenceLarge:
+            type->kind = BridgeDynamicKind::kSequence;
+            reader.U8();        // PlainCollectionHeader: equiv_kind, element_flags
+            reader.U16();
+            type->bound = discriminator == kTiSequenceSmall ? reader.U8() : reader.U32();
+            type->element = ParseTypeId(reader, depth);
+            return type->element ? type : nullptr;
+        case kTiArraySmall:
+        case kTiArrayLarge: {
+            type->kind = BridgeDynamicKind::kArray;
+            reader.U8();
+            reader.U16();
+            const uint32_t count = reader.U32();
+            for (uint32_t i = 0; i < count && reader.Ok(); ++i) {
+                type->dims.push_back(discriminator == kTiArraySmall ? reader.U8() : reader.U32());
+            }
+            type->element = ParseTypeId(reader, depth);
+            return type->element ? type : nullptr;
+        }
+        case kEkComplete:
+            return Resolve(reader.Bytes(kEquivalenceHashSize), depth);
+        case kEkMinimal:
+            return Fail("minimal type reference without names");
+        default: {
+            char message[64];
+            std::snprintf(message, sizeof(message), "unsupported type identifier 0x%02x", discriminator);
+            return Fail(message);
+        }
+        }
+    }
+
+    const std::vector<uint8_t>& map_;
+    std::map<std::string, size_t> objects_;        // 等价哈希 -> 类型对象内容起点（DHEADER之后）
+    std::map<std::string, BridgeDynamicTypePtr> cache_;
+    std::string error_;
+};
+
+uint32_t ElementCount(const BridgeDynamicType& type) {
+    uint32_t count = 1;
+    for (uint32_t dim : type.dims) {
+        count *= dim;
+    }
+    return count;
+}
+
+/**
+ * @brief 类型展开后的叶子字段数，可选成员缺省时据此跳过字段下标
+ */
+size_t LeafCount(const BridgeDynamicType& type) {
+    switch (type.kind) {
+    case BridgeDynamicKind::kArray:
+        return ElementCount(type) * LeafCount(*type.element);
+    case BridgeDynamicKind::kStruct: {
+        size_t count = 0;
+        for (const auto& member : type.members) {
+            count += LeafCount(*member.type);
+        }
+        return count;
+    }
+    default:
+        return 1;
+    }
+}
+
+uint32_t EncodedSize(const BridgeDynamicType& type, bool xcdr2) {
+    if (type.kind == BridgeDynamicKind::kEnum) {
+        // XCDR1的枚举固定4字节，XCDR2按bit_bound取1/2/4字节
+        return !xcdr2 || type.bound > 16 || type.bound == 0 ? 4 : type.bound > 8 ? 2 : 1;
+    }
+    return type.PrimitiveSize();
+}
+
+/**
+ * @brief 按类型遍历CDR数据
+ * @note data为nullptr时只推进位置并记录各字段偏移（用于定长类型）；只设置offsets时按样本定位字段、跳过序列内容；
+ *       text不为nullptr时把值格式化进文本（序列元素）
+ */
+class CdrWalker {
+public:
+    CdrWalker(const uint8_t* data, size_t size, bool xcdr2, bool swap)
+        : data_(data), size_(size), xcdr2_(xcdr2), swap_(swap) {}
+
+    void SetValues(std::vector<BridgeDynamicValue>* values) { values_ = values; }
+    void SetOffsets(std::vector<uint32_t>* offsets) { offsets_ = offsets; }
+    void SetText(std::string* text) { text_ = text; }
+    void Seek(size_t pos) { pos_ = pos; }
+    size_t Pos() const { return pos_; }
+
+    bool Walk(const BridgeDynamicType& type) {
+        switch (type.kind) {
+        case BridgeDynamicKind::kString:
+            return String();
+        case BridgeDynamicKind::kArray:
+            return Array(type);
+        case BridgeDynamicKind::kSequence:
+            return Sequence(type);
+        case BridgeDynamicKind::kStruct:
+            return Struct(type);
+        default:
+            return Primitive(type);
+        }
+    }
+
+private:
+    bool Align(size_t n) {
+        if (xcdr2_ && n > 4) {
+            n = 4;
+        }
+        pos_ = (pos_ + n - 1) / n * n;
+        return data_ == nullptr || pos_ <= size_;
+    }
+
+    bool Read(void* out, size_t n) {
+        if (data_ == nullptr) {
+            pos_ += n;
+            return true;
+        }
+        if (pos_ + n > size_) {
+            return false;
+        }
+        uint8_t* bytes = static_cast<uint8_t*>(out);
+        if (swap_) {
+            for (size_t i = 0; i < n; ++i) {
+                bytes[i] = data_[pos_ + n - 1 - i];
+            }
+        } else {
+            std::memcpy(bytes, data_ + pos_, n);
+        }
+        pos_ += n;
+        return true;
+    }
+
+    bool U32(uint32_t& value) {
+        value = 0;
+        return Align(4) && Read(&value, 4);
+    }
+
+    BridgeDynamicValue* NextValue() {
+        if (values_ == nullptr || text_ != nullptr) {
+            return nullptr;
+        }
+        return field_ < values_->size() ? &(*values_)[field_++] : nullptr;
+    }
+
+    void AppendText(const std::string& value) {
+        if (!text_->empty() && text_->back() != '[' && text_->back() != '{') {
+            text_->append(", ");
+        }
+        text_->append(value);
+    }
+
+    bool Primitive(const BridgeDynamicType& type) {
+        const uint32_t size = EncodedSize(type, xcdr2_);
+        if (!Align(size)) {
+            return false;
+        }
+        if (offsets_ != nullptr) {
+            offsets_->push_back(static_cast<uint32_t>(pos_));
+        }
+        uint64_t raw = 0;
+        uint8_t bytes[8] = {};
+        if (!Read(bytes, size)) {
+            return false;
+        }
+        if (data_ == nullptr || (values_ == nullptr && text_ == nullptr)) {
+            ++field_;
+            return true;
+        }
+        std::memcpy(&raw, bytes, size);
+        BridgeDynamicValue scratch;
+        BridgeDynamicValue* value = NextValue();
+        if (value == nullptr) {
+            value = &scratch;
+        }
+        switch (type.kind) {
+        case BridgeDynamicKind::kFloat32: {
+            float f;
+            std::memcpy(&f, bytes, 4);
+            value->f = f;
+            break;
+        }
+        case BridgeDynamicKind::kFloat64:
+            std::memcpy(&value->f, bytes, 8);
+            break;
+        case BridgeDynamicKind::kUint8:
+        case BridgeDynamicKind::kUint16:
+        case BridgeDynamicKind::kUint32:
+        case BridgeDynamicKind::kUint64:
+            value->u = raw;
+            break;
+        case BridgeDynamicKind::kInt8:
+        case BridgeDynamicKind::kChar:
+            value->i = static_cast<int8_t>(bytes[0]);
+            break;
+        case BridgeDynamicKind::kBool:
+            value->i = bytes[0] != 0;
+            break;
+        default: {
+            // 有符号整数与枚举：按编码宽度符号扩展
+            const int shift = 64 - static_cast<int>(size) * 8;
+            value->i = static_cast<int64_t>(raw << shift) >> shift;
+            break;
+        }
+        }
+        if (text_ != nullptr) {
+            char buffer[32];
+            if (type.kind == BridgeDynamicKind::kFloat32 || type.kind == BridgeDynamicKind::kFloat64) {
+                std::snprintf(buffer, sizeof(buffer), "%.9g", value->f);
+            } else if (type.kind >= BridgeDynamicKind::kUint8 && type.kind <= BridgeDynamicKind::kUint64 &&
+                       type.kind != BridgeDynamicKind::kInt16 && type.kind != BridgeDynamicKind::kInt32 &&
+                       type.kind != BridgeDynamicKind::kInt64) {
+                std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value->u));
+            } else {
+                std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value->i));
+            }
+            AppendText(buffer);
+        }
+        return true;
+    }
+
+    bool String() {
+        if (!Align(4)) {
+            return false;
+        }
+        if (offsets_ != nullptr) {
+            offsets_->push_back(static_cast<uint32_t>(pos_));
+        }
+        uint32_t length = 0;
+        if (!U32(length) || (data_ != nullptr && pos_ + length > size_)) {
+            return false;
+        }
+        const char* chars = data_ != nullptr ? reinterpret_cast<const char*>(data_ + pos_) : nullptr;
+        const size_t count = length > 0 ? length - 1 : 0;
+        pos_ += length;
+        if (text_ != nullptr) {
+            AppendText("\"" + std::string(chars, count) + "\"");
+        } else if (BridgeDynamicValue* out = NextValue()) {
+            out->text.assign(chars, count);
+        } else {
+            ++field_;
+        }
+        return true;
+    }
+
+    /**
+     * @brief XCDR2中非基本类型元素的数组/序列以DHEADER开头
+     */
+    bool SkipCollectionHeader(const BridgeDynamicType& element) {
+        if (!xcdr2_ || element.IsPrimitive()) {
+            return true;
+        }
+        uint32_t length = 0;
+        return U32(length);
+    }
+
+    bool Array(const BridgeDynamicType& type) {
+        if (!SkipCollectionHeader(*type.element)) {
+            return false;
+        }
+        const uint32_t count = ElementCount(type);
+        if (text_ != nullptr) {
+            AppendText("[");
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!Walk(*type.element)) {
+                return false;
+            }
+        }
+        if (text_ != nullptr) {
+            text_->append("]");
+        }
+        return true;
+    }
+
+    bool Sequence(const BridgeDynamicType& type) {
+        if (!Align(4)) {
+            return false;
+        }
+        if (offsets_ != nullptr) {
+            offsets_->push_back(static_cast<uint32_t>(pos_));
+            if (values_ == nullptr && text_ == nullptr) {
+                return SkipSequence(type);
+            }
+        }
+        uint32_t count = 0;
+        if (!SkipCollectionHeader(*type.element) || !U32(count)) {
+            return false;
+        }
+        BridgeDynamicValue* out = text_ == nullptr ? NextValue() : nullptr;
+        std::string local;
+        std::string* saved = text_;
+        if (saved == nullptr) {
+            text_ = &local;
+        }
+        AppendText("[");
+        bool ok = true;
+        for (uint32_t i = 0; i < count && ok; ++i) {
+            ok = Walk(*type.element);
+        }
+        text_->append("]");
+        text_ = saved;
+        if (out != nullptr) {
+            out->text = std::move(local);
+            out->u = count;
+        }
+        return ok;
+    }
+
+    /**
+     * @brief 只定位时跳过序列内容：XCDR2按DHEADER整体跳过，基本类型元素按总长跳过
+     */
+    bool SkipSequence(const BridgeDynamicType& type) {
+        const BridgeDynamicType& element = *type.element;
+        uint32_t count = 0;
+        if (xcdr2_ && !element.IsPrimitive()) {
+            uint32_t length = 0;
+            if (!U32(length) || pos_ + length > size_) {
+                return false;
+            }
+            pos_ += length;
+            return true;
+        }
+        if (!U32(count)) {
+            return false;
+        }
+        if (element.IsPrimitive()) {
+            const uint32_t size = EncodedSize(element, xcdr2_);
+            if (count == 0) {
+                return true;
+            }
+            if (!Align(size) || static_cast<uint64_t>(count) * size > size_ - pos_) {
+                return false;
+            }
+            pos_ += static_cast<size_t>(count) * size;
+            return true;
+        }
+        std::vector<uint32_t>* saved = offsets_;
+        offsets_ = nullptr;
+        bool ok = true;
+        for (uint32_t i = 0; i < count && ok; ++i) {
+            ok = Walk(element);
+        }
+        offsets_ = saved;
+        return ok;
+    }
+
+    bool Struct(const BridgeDynamicType& type) {
+        if (type.extensibility == BridgeExtensibility::kMutable) {
+            return false;       // 需要EMHEADER逐成员解析，暂不支持
+        }
+        size_t end = 0;
+        if (xcdr2_ && type.extensibility == BridgeExtensibility::kAppendable) {
+            uint32_t length = 0;
+            if (!U32(length)) {
+                return false;
+            }
+            end = pos_ + length;
+        }
+        if (text_ != nullptr) {
+            AppendText("{");
+        }
+        for (const auto& member : type.members) {
+            if (member.optional) {
+                uint8_t present = 0;
+                if (!xcdr2_ || !Read(&present, 1)) {
+                    return false;   // XCDR1的可选成员使用参数头，暂不支持
+                }
+                if (present == 0) {
+                    if (text_ == nullptr) {
+                        const size_t leaves = LeafCount(*member.type);
+                        field_ += leaves;
+                        if (offsets_ != nullptr) {
+                            offsets_->insert(offsets_->end(), leaves, kBridgeFieldAbsent);
+                        }
+                    }
+                    continue;
+                }
+            }
+            if (!Walk(*member.type)) {
+                return false;
+            }
+        }
+        if (text_ != nullptr) {
+            text_->append("}");
+        }
+        // 可扩展结构体：跳过新版本类型追加的成员
+        if (end != 0 && data_ != nullptr) {
+            if (end > size_) {
+                return false;
+            }
+            pos_ = end;
+        }
+        return true;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    bool xcdr2_;
+    bool swap_;
+    size_t pos_ = 0;
+    size_t field_ = 0;
+    std::vector<BridgeDynamicValue>* values_ = nullptr;
+    std::vector<uint32_t>* offsets_ = nullptr;
+    std::string* text_ = nullptr;
+};
+
+void Flatten(const BridgeDynamicTypePtr& node, const std::string& path, bool key,
+             std::vector<BridgeDynamicField>& fields, bool& fixed) {
+    const BridgeDynamicType& type = *node;
+    switch (type.kind) {
+    case BridgeDynamicKind::kArray: {
+        const uint32_t count = ElementCount(type);
+        for (uint32_t i = 0; i < count; ++i) {
+            // 多维数组按行主序展开为path[i][j]
+            std::string suffix;
+            uint32_t rest = i;
+            for (size_t d = type.dims.size(); d-- > 0;) {
+                suffix = "[" + std::to_string(rest % type.dims[d]) + "]" + suffix;
+                rest /= type.dims[d];
+            }
+            Flatten(type.element, path + suffix, key, fields, fixed);
+        }
+        return;
+    }
+    case BridgeDynamicKind::kStruct:
+        if (type.extensibility == BridgeExtensibility::kMutable) {
+            fixed = false;
+        }
+        for (const auto& member : type.members) {
+            if (member.optional) {
+                fixed = false;
+            }
+            Flatten(member.type, path.empty() ? member.name : path + "." + member.name, key || member.key, fields,
+                    fixed);
+        }
+        return;
+    case BridgeDynamicKind::kString:
+    case BridgeDynamicKind::kSequence:
+        fixed = false;
+        fields.push_back(BridgeDynamicField{path, type.kind, 0, key, node});
+        return;
+    default:
+        fields.push_back(BridgeDynamicField{path, type.kind, type.PrimitiveSize(), key, node});
+        return;
+    }
+}
+
+}
+
+uint32_t BridgeDynamicType::PrimitiveSize() const {
+    switch (kind) {
+    case BridgeDynamicKind::kBool:
+    case BridgeDynamicKind::kChar:
+    case BridgeDynamicKind::kInt8:
+    case BridgeDynamicKind::kUint8:
+        return 1;
+    case BridgeDynamicKind::kInt16:
+    case BridgeDynamicKind::kUint16:
+        return 2;
+    case BridgeDynamicKind::kInt32:
+    case BridgeDynamicKind::kUint32:
+    case BridgeDynamicKind::kFloat32:
+    case BridgeDynamicKind::kEnum:
+        return 4;
+    case BridgeDynamicKind::kInt64:
+    case BridgeDynamicKind::kUint64:
+    case BridgeDynamicKind::kFloat64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+const char* BridgeDynamicKindName(BridgeDynamicKind kind) {
+    switch (kind) {
+    case BridgeDynamicKind::kBool: return "bool";
+    case BridgeDynamicKind::kChar: return "char";
+    case BridgeDynamicKind::kInt8: return "int8";
+    case BridgeDynamicKind::kUint8: return "uint8";
+    case BridgeDynamicKind::kInt16: return "int16";
+    case BridgeDynamicKind::kUint16: return "uint16";
+    case BridgeDynamicKind::kInt32: return "int32";
+    case BridgeDynamicKind::kUint32: return "uint32";
+    case BridgeDynamicKind::kInt64: return "int64";
+    case BridgeDynamicKind::kUint64: return "uint64";
+    case BridgeDynamicKind::kFloat32: return "float32";
+    case BridgeDynamicKind::kFloat64: return "float64";
+    case BridgeDynamicKind::kEnum: return "enum";
+    case BridgeDynamicKind::kString: return "string";
+    case BridgeDynamicKind::kArray: return "array";
+    case BridgeDynamicKind::kSequence: return "sequence";
+    case BridgeDynamicKind::kStruct: return "struct";
+    }
+    return "unknown";
+}
+
+bool BridgeParseTypeMap(const std::vector<uint8_t>& type_map, const std::string& type_name,
+                        BridgeDynamicTypePtr& type, std::string* error) {
+    TypeMapParser parser(type_map);
+    type = parser.Load() ? parser.FindByName(type_name) : nullptr;
+    if (!type && error != nullptr) {
+        *error = parser.Error();
+    }
+    return type != nullptr;
+}
+
+bool BridgeCdrEncoding(const uint8_t* payload, size_t size, bool& xcdr2, bool& little_endian) {
+    if (size < 4) {
+        return false;
+    }
+    const uint16_t identifier = static_cast<uint16_t>((payload[0] << 8) | payload[1]);
+    // CDR_BE/LE=0/1，CDR2_BE/LE=6/7，D_CDR2_BE/LE=8/9；参数列表格式（2/3、10/11）不支持
+    if (identifier > 9 || identifier == 2 || identifier == 3 || identifier == 4 || identifier == 5) {
+        return false;
+    }
+    xcdr2 = identifier >= 6;
+    little_endian = (identifier & 1) != 0;
+    return true;
+}
+
+bool BridgeDynamicLayout::Build(const BridgeDynamicTypePtr& type) {
+    type_ = type;
+    fields_.clear();
+    xcdr1_offsets_.clear();
+    xcdr2_offsets_.clear();
+    if (!type || type->kind != BridgeDynamicKind::kStruct) {
+        return false;
+    }
+    fixed_ = true;
+    Flatten(type, "", false, fields_, fixed_);
+    if (fixed_) {
+        CdrWalker xcdr1(nullptr, 0, false, false);
+        xcdr1.SetOffsets(&xcdr1_offsets_);
+        CdrWalker xcdr2(nullptr, 0, true, false);
+        xcdr2.SetOffsets(&xcdr2_offsets_);
+        fixed_ = xcdr1.Walk(*type) && xcdr2.Walk(*type);
+        xcdr1_size_ = static_cast<uint32_t>(xcdr1.Pos());
+        xcdr2_size_ = static_cast<uint32_t>(xcdr2.Pos());
+    }
+    return true;
+}
+
+int BridgeDynamicLayout::FindField(const std::string& path) const {
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        if (fields_[i].path == path) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool BridgeDynamicLayout::Decode(const uint8_t* payload, size_t size, std::vector<BridgeDynamicValue>& values) const {
+    bool xcdr2 = false;
+    bool little_endian = true;
+    if (!type_ || !BridgeCdrEncoding(payload, size, xcdr2, little_endian)) {
+        return false;
+    }
+    values.resize(fields_.size());
+    CdrWalker walker(payload + 4, size - 4, xcdr2, little_endian != HostLittleEndian());
+    walker.SetValues(&values);
+    return walker.Walk(*type_);
+}
+
+bool BridgeDynamicLayout::Locate(const uint8_t* payload, size_t size, std::vector<uint32_t>& offsets) const {
+    bool xcdr2 = false;
+    bool little_endian = true;
+    offsets.clear();
+    if (!type_ || !BridgeCdrEncoding(payload, size, xcdr2, little_endian)) {
+        return false;
+    }
+    CdrWalker walker(payload + 4, size - 4, xcdr2, little_endian != HostLittleEndian());
+    walker.SetOffsets(&offsets);
+    return walker.Walk(*type_) && offsets.size() == fields_.size();
+}
+
+bool BridgeDynamicView::Bind(const BridgeDynamicLayout& layout, const uint8_t* payload, size_t size) {
+    layout_ = &layout;
+    offsets_ = nullptr;
+    bool little_endian = true;
+    if (!layout.Type() || !BridgeCdrEncoding(payload, size, xcdr2_, little_endian)) {
+        return false;
+    }
+    data_ = payload + 4;
+    size_ = size - 4;
+    swap_ = little_endian != HostLittleEndian();
+    if (layout.IsFixed()) {
+        if (size_ < layout.FixedSize(xcdr2_)) {
+            return false;
+        }
+        offsets_ = layout.FixedOffsets(xcdr2_).data();
+        return true;
+    }
+    if (!layout.Locate(payload, size, located_)) {
+        return false;
+    }
+    offsets_ = located_.data();
+    return true;
+}
+
+uint64_t BridgeDynamicView::Raw(size_t index, uint32_t& size) const {
+    const BridgeDynamicField& field = layout_->Fields()[index];
+    const uint32_t offset = offsets_[index];
+    size = field.size;
+    if (offset == kBridgeFieldAbsent || size == 0) {
+        size = 0;
+        return 0;
+    }
+    if (field.kind == BridgeDynamicKind::kEnum) {
+        size = EncodedSize(*field.type, xcdr2_);
+    }
+    uint64_t value = 0;
+    switch (size) {
+    case 1:
+        return data_[offset];
+    case 2: {
+        uint16_t narrow;
+        std::memcpy(&narrow, data_ + offset, 2);
+        return swap_ ? __builtin_bswap16(narrow) : narrow;
+    }
+    case 4: {
+        uint32_t narrow;
+        std::memcpy(&narrow, data_ + offset, 4);
+        return swap_ ? __builtin_bswap32(narrow) : narrow;
+    }
+    default:
+        std::memcpy(&value, data_ + offset, 8);
+        return swap_ ? __builtin_bswap64(value) : value;
+    }
+}
+
+int64_t BridgeDynamicView::Int(size_t index) const {
+    switch (Field(index).kind) {
+    case BridgeDynamicKind::kFloat32:
+    case BridgeDynamicKind::kFloat64:
+        return static_cast<int64_t>(Double(index));
+    case BridgeDynamicKind::kUint8:
+    case BridgeDynamicKind::kUint16:
+    case BridgeDynamicKind::kUint32:
+    case BridgeDynamicKind::kUint64:
+    case BridgeDynamicKind::kBool:
+        return static_cast<int64_t>(Uint(index));
+    default:
+        break;
+    }
+    uint32_t size = 0;
+    const uint64_t raw = Raw(index, size);
+    if (size == 0) {
+        return 0;
+    }
+    const int shift = 64 - static_cast<int>(size) * 8;
+    return static_cast<int64_t>(raw << shift) >> shift;
+}
+
+uint64_t BridgeDynamicView::Uint(size_t index) const {
+    const BridgeDynamicKind kind = Field(index).kind;
+    if (kind == BridgeDynamicKind::kFloat32 || kind == BridgeDynamicKind::kFloat64) {
+        return static_cast<uint64_t>(Double(index));
+    }
+    if (kind == BridgeDynamicKind::kBool) {
+        uint32_t size = 0;
+        return Raw(index, size) != 0;
+    }
+    if (kind == BridgeDynamicKind::kInt8 || kind == BridgeDynamicKind::kChar || kind == BridgeDynamicKind::kInt16 ||
+        kind == BridgeDynamicKind::kInt32 || kind == BridgeDynamicKind::kInt64 || kind == BridgeDynamicKind::kEnum) {
+        return static_cast<uint64_t>(Int(index));
+    }
+    uint32_t size = 0;
+    return Raw(index, size);
+}
+
+double BridgeDynamicView::Double(size_t index) const {
+    uint32_t size = 0;
+    switch (Field(index).kind) {
+    case BridgeDynamicKind::kFloat32: {
+        const uint32_t bits = static_cast<uint32_t>(Raw(index, size));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return size == 0 ? 0.0 : value;
+    }
+    case BridgeDynamicKind::kFloat64: {
+        const uint64_t bits = Raw(index, size);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return size == 0 ? 0.0 : value;
+    }
+    case BridgeDynamicKind::kUint8:
+    case BridgeDynamicKind::kUint16:
+    case BridgeDynamicKind::kUint32:
+    case BridgeDynamicKind::kUint64:
+    case BridgeDynamicKind::kBool:
+        return static_cast<double>(Uint(index));
+    default:
+        return static_cast<double>(Int(index));
+    }
+}
+
+uint32_t BridgeDynamicView::Length(size_t index) const {
+    const BridgeDynamicField& field = Field(index);
+    const uint32_t offset = offsets_[index];
+    if (offset == kBridgeFieldAbsent || field.size != 0) {
+        return 0;
+    }
+    // XCDR2中非基本类型元素的序列以DHEADER开头，元素数在其后
+    size_t pos = offset;
+    if (field.kind == BridgeDynamicKind::kSequence && xcdr2_ && !field.type->element->IsPrimitive()) {
+        pos += 4;
+    }
+    if (pos + 4 > size_) {
+        return 0;
+    }
+    uint32_t length;
+    std::memcpy(&length, data_ + pos, 4);
+    length = swap_ ? __builtin_bswap32(length) : length;
+    return field.kind == BridgeDynamicKind::kString && length > 0 ? length - 1 : length;
+}
+
+std::string BridgeDynamicView::Text(size_t index) const {
+    const BridgeDynamicField& field = Field(index);
+    const uint32_t offset = offsets_[index];
+    if (offset == kBridgeFieldAbsent) {
+        return "";
+    }
+    if (field.kind == BridgeDynamicKind::kString) {
+        return std::string(reinterpret_cast<const char*>(data_ + offset + 4), Length(index));
+    }
+    std::string text;
+    if (field.kind == BridgeDynamicKind::kSequence) {
+        CdrWalker walker(data_, size_, xcdr2_, swap_);
+        walker.Seek(offset);
+        walker.SetText(&text);
+        walker.Walk(*field.type);
+        return text;
+    }
+    char buffer[32];
+    if (field.kind == BridgeDynamicKind::kFloat32 || field.kind == BridgeDynamicKind::kFloat64) {
+        std::snprintf(buffer, sizeof(buffer), "%.9g", Double(index));
+    } else if (field.kind == BridgeDynamicKind::kUint8 || field.kind == BridgeDynamicKind::kUint16 ||
+               field.kind == BridgeDynamicKind::kUint32 || field.kind == BridgeDynamicKind::kUint64) {
+        std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(Uint(index)));
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(Int(index)));
+    }
+    return buffer;
+}
+
+std::string BridgeDynamicView::ToString() const {
+    std::string text;
+    for (size_t i = 0; i < FieldCount(); ++i) {
+        if (!Has(i)) {
+            continue;
+        }
+        text += Field(i).path;
+        text += ": ";
+        text += Text(i);
+        text += "\n";
+    }
+    return text;
+}
+
+} // namespace robot
+} // namespace yunji
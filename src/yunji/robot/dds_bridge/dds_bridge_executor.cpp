@@ -0,0 +1,454 @@
+/**
+ * @file bridge_executor.cpp
+ * @brief 优先级回调执行器实现文件
+ * @note 实现BridgeExecutor类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_executor.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_alloc.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+namespace {
+
+constexpr int kSimulatedPollMs = 1;     // 非步进执行器在仿真时间下轮询仿真时钟的间隔
+
+bool IsExclusive(const BridgeCallbackGroupPtr& group) {
+    return group->Type() == BridgeCallbackGroupType::kMutuallyExclusive;
+}
+
+}
+
+BridgeExecutor::BridgeExecutor(const BridgeExecutorOptions& options)
+    : options_(options) {
+    if (options_.num_threads == 0) {
+        options_.num_threads = 1;
+    }
+    if (options_.max_batch == 0) {
+        options_.max_batch = 1;
+    }
+}
+
+BridgeExecutor::~BridgeExecutor() {
+    Stop();
+}
+
+void BridgeExecutor::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_ || IsStepping()) {
+        return;
+    }
+    running_ = true;
+    for (size_t i = 0; i < options_.num_threads; ++i) {
+        workers_.emplace_back(&BridgeExecutor::WorkerLoop, this);
+    }
+
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (timer_fd_ < 0 || wake_fd_ < 0) {
+        std::cerr << "Executor timer init failed, timers are disabled" << std::endl;
+        return;
+    }
+    timer_thread_ = std::thread(&BridgeExecutor::TimerLoop, this);
+    if (options_.timer_thread_priority > 0) {
+        sched_param param{};
+        param.sched_priority = options_.timer_thread_priority;
+        if (pthread_setschedparam(timer_thread_.native_handle(), SCHED_FIFO, &param) != 0) {
+            std::cerr << "Executor timer thread: failed to set SCHED_FIFO priority" << std::endl;
+        }
+    }
+}
+
+void BridgeExecutor::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    WakeTimerThread();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+    if (timer_thread_.joinable()) {
+        timer_thread_.join();
+    }
+    if (timer_fd_ >= 0) {
+        close(timer_fd_);
+        timer_fd_ = -1;
+    }
+    if (wake_fd_ >= 0) {
+        close(wake_fd_);
+        wake_fd_ = -1;
+    }
+}
+
+BridgeExecutor::Handle BridgeExecutor::Add(BridgeExecutable* executable,
+                                           BridgePriority priority,
+                                           BridgeCallbackGroupPtr group) {
+    auto handle = std::make_shared<Entry>();
+    handle->executable = executable;
+    handle->priority = priority;
+    // 未指定回调组时独占一个互斥组，保证同一订阅的回调不会并发
+    handle->group = group ? std::move(group) : std::make_shared<BridgeCallbackGroup>();
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_back(handle);
+    // 每个实体最多在队列中出现一次，按实体总数预留后Enqueue()不会再分配
+    for (auto& queue : queues_) {
+        queue.reserve(entries_.size());
+    }
+    return handle;
+}
+
+void BridgeExecutor::Remove(const Handle& handle) {
+    if (!handle) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    handle->removed = true;
+    entries_.erase(std::remove(entries_.begin(), entries_.end(), handle), entries_.end());
+    auto& queue = queues_[static_cast<size_t>(handle->priority)];
+    queue.erase(std::remove(queue.begin(), queue.end(), handle), queue.end());
+    idle_cv_.wait(lock, [&handle]() { return handle->running == 0; });
+}
+
+void BridgeExecutor::Notify(const Handle& handle) {
+    // 步进模式由Step()轮询，到达通知的先后不影响执行顺序
+    if (IsStepping()) {
+        return;
+    }
+    // 已在队列中的实体不重复入队，执行时会一并取走新到达的数据
+    if (handle->scheduled.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (handle->removed) {
+            handle->scheduled.store(false, std::memory_order_release);
+            return;
+        }
+        Enqueue(handle);
+    }
+    cv_.notify_one();
+}
+
+std::shared_ptr<BridgeTimer> BridgeExecutor::CreateTimer(std::chrono::nanoseconds period,
+                                                         std::function<void()> callback) {
+    return CreateTimer(period, std::move(callback), BridgeTimerOptions());
+}
+
+std::shared_ptr<BridgeTimer> BridgeExecutor::CreateTimer(std::chrono::nanoseconds period,
+                                                         std::function<void()> callback,
+                                                         const BridgeTimerOptions& options) {
+    auto timer = std::make_shared<BridgeTimer>(period, std::move(callback), options,
+                                               BridgeClock::Instance()->Now() + period.count());
+    // 非内联定时器作为普通实体挂到工作线程上，按其优先级与订阅一起调度
+    if (!IsStepping() && !options.inline_callback) {
+        timer->handle_ = Add(timer.get(), options.priority);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        timers_.push_back(timer);
+    }
+    WakeTimerThread();
+    return timer;
+}
+
+void BridgeExecutor::WakeTimerThread() {
+    if (wake_fd_ >= 0) {
+        const uint64_t one = 1;
+        ssize_t ret = write(wake_fd_, &one, sizeof(one));
+        (void)ret;
+    }
+}
+
+void BridgeExecutor::TimerLoop() {
+    if (options_.realtime_threads) {
+        BridgeAllocTracker::MarkRealtimeThread();
+    }
+    BridgeClock* clock = BridgeClock::Instance();
+    std::vector<std::shared_ptr<BridgeTimer>> snapshot;
+    std::vector<std::shared_ptr<BridgeTimer>> cancelled;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!running_) {
+                break;
+            }
+            // stable_partition会申请临时缓冲，只在确有定时器被取消时才整理
+            const bool any_cancelled = std::any_of(timers_.begin(), timers_.end(),
+                [](const std::shared_ptr<BridgeTimer>& timer) { return timer->IsCancelled(); });
+            if (any_cancelled) {
+                auto it = std::stable_partition(timers_.begin(), timers_.end(),
+                    [](const std::shared_ptr<BridgeTimer>& timer) { return !timer->IsCancelled(); });
+                cancelled.assign(it, timers_.end());
+                timers_.erase(it, timers_.end());
+            }
+            snapshot = timers_;
+        }
+        for (const auto& timer : cancelled) {
+            Remove(timer->handle_);
+        }
+        cancelled.clear();
+
+        BridgeTimer* next = nullptr;
+        for (const auto& timer : snapshot) {
+            if (!next || timer->next_deadline_ns_ < next->next_deadline_ns_) {
+                next = timer.get();
+            }
+        }
+
+        struct pollfd fds[2] = {{wake_fd_, POLLIN, 0}, {timer_fd_, POLLIN, 0}};
+        if (!next) {
+            poll(fds, 1, -1);
+        } else if (clock->IsSimulated()) {
+            // 仿真时间（如回放）下timerfd的CLOCK_MONOTONIC与截止时刻不在同一时间轴，
+            // 仿真时钟又没有可等待的通知，这里按固定间隔轮询仿真时间，到期即触发
+            const int64_t now = clock->Now();
+            if (now < next->next_deadline_ns_) {
+                if (poll(fds, 1, kSimulatedPollMs) > 0) {
+                    uint64_t value = 0;
+                    ssize_t ret = read(wake_fd_, &value, sizeof(value));
+                    (void)ret;
+                }
+                continue;
+            }
+            if (!next->IsCancelled() && next->Fire(now, next->options_.inline_callback)) {
+                Notify(next->handle_);
+            }
+            continue;
+        } else {
+            const int64_t deadline = next->next_deadline_ns_;
+            const int64_t wake_at = deadline - next->options_.busy_wait_tail.count();
+            if (wake_at > clock->Now()) {
+                // 按绝对时刻睡眠，提前busy_wait_tail醒来
+                itimerspec spec{};
+                spec.it_value.tv_sec = wake_at / 1000000000LL;
+                spec.it_value.tv_nsec = wake_at % 1000000000LL;
+                timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr);
+                poll(fds, 2, -1);
+                uint64_t expirations = 0;
+                if (fds[1].revents & POLLIN) {
+                    ssize_t ret = read(timer_fd_, &expirations, sizeof(expirations));
+                    (void)ret;
+                }
+                if (fds[0].revents & POLLIN) {
+                    // 定时器集合变化或停止，重新计算最早截止时刻
+                    uint64_t value = 0;
+                    ssize_t ret = read(wake_fd_, &value, sizeof(value));
+                    (void)ret;
+                    continue;
+                }
+            }
+            int64_t now = clock->Now();
+            while (now < deadline && running_.load(std::memory_order_relaxed)) {
+                if (clock->IsSimulated()) {
+                    break;      // 忙等期间切换到了仿真时间，回到循环开头按仿真时间等待
+                }
+                now = clock->Now();     // 忙等剩余的尾部时间
+            }
+            if (now < deadline) {
+                continue;
+            }
+            if (!next->IsCancelled() && next->Fire(now, next->options_.inline_callback)) {
+                Notify(next->handle_);
+            }
+            continue;
+        }
+        uint64_t value = 0;
+        ssize_t ret = read(wake_fd_, &value, sizeof(value));
+        (void)ret;
+    }
+}
+
+size_t BridgeExecutor::FireDueTimers(int64_t now_ns) {
+    BridgeClock* clock = BridgeClock::Instance();
+    size_t fired = 0;
+    std::vector<std::shared_ptr<BridgeTimer>> snapshot;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            timers_.erase(std::remove_if(timers_.begin(), timers_.end(),
+                [](const std::shared_ptr<BridgeTimer>& timer) { return timer->IsCancelled(); }),
+                timers_.end());
+            snapshot = timers_;
+        }
+        // 取截止时刻最早的定时器，相同时刻按创建顺序
+        BridgeTimer* next = nullptr;
+        for (const auto& timer : snapshot) {
+            if (timer->next_deadline_ns_ <= now_ns &&
+                (!next || timer->next_deadline_ns_ < next->next_deadline_ns_)) {
+                next = timer.get();
+            }
+        }
+        if (!next) {
+            break;
+        }
+        // 仿真时间下把时钟拨到截止时刻再触发，回调看到的时间与真实运行一致
+        clock->Set(next->next_deadline_ns_);
+        next->Fire(clock->IsSimulated() ? next->next_deadline_ns_ : clock->Now(), true);
+        ++fired;
+    }
+    return fired;
+}
+
+size_t BridgeExecutor::Step(std::chrono::nanoseconds delta) {
+    if (!IsStepping()) {
+        return 0;
+    }
+    BridgeClock* clock = BridgeClock::Instance();
+    const int64_t target = clock->Now() + (clock->IsSimulated() ? delta.count() : 0);
+    size_t total = FireDueTimers(target);
+    clock->Set(target);
+
+    std::vector<Handle> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        snapshot = entries_;
+    }
+    // 稳定排序：先按优先级，同优先级保持注册顺序
+    std::stable_sort(snapshot.begin(), snapshot.end(), [](const Handle& a, const Handle& b) {
+        return a->priority < b->priority;
+    });
+
+    for (const auto& handle : snapshot) {
+        size_t handled = 0;
+        size_t count = 0;
+        do {
+            count = handle->executable->Execute(options_.max_batch);
+            handled += count;
+        } while (count >= options_.max_batch);
+
+        if (handled > 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& stats = stats_[static_cast<size_t>(handle->priority)];
+            ++stats.dispatched;
+            stats.samples += handled;
+        }
+        total += handled;
+    }
+    return total;
+}
+
+size_t BridgeExecutor::SpinUntilIdle(size_t max_rounds) {
+    size_t total = 0;
+    for (size_t round = 0; round < max_rounds; ++round) {
+        const size_t count = Step();
+        if (count == 0) {
+            break;
+        }
+        total += count;
+    }
+    return total;
+}
+
+BridgeExecutorStats BridgeExecutor::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    BridgeExecutorStats stats = stats_;
+    for (size_t i = 0; i < kBridgePriorityCount; ++i) {
+        stats[i].queue_depth = queues_[i].size();
+    }
+    return stats;
+}
+
+void BridgeExecutor::Enqueue(const Handle& handle) {
+    const size_t index = static_cast<size_t>(handle->priority);
+    handle->enqueue_time = std::chrono::steady_clock::now();
+    queues_[index].push_back(handle);
+    stats_[index].max_queue_depth = std::max(stats_[index].max_queue_depth, queues_[index].size());
+}
+
+BridgeExecutor::Handle BridgeExecutor::PickRunnable() {
+    // 从高到低遍历优先级，跳过所属互斥组正忙的实体
+    for (auto& queue : queues_) {
+        for (auto it = queue.begin(); it != queue.end(); ++it) {
+            const Handle& candidate = *it;
+            if (IsExclusive(candidate->group) && candidate->group->busy_) {
+                continue;
+            }
+            Handle handle = candidate;
+            queue.erase(it);
+            if (IsExclusive(handle->group)) {
+                handle->group->busy_ = true;
+            }
+            ++handle->running;
+            return handle;
+        }
+    }
+    return nullptr;
+}
+
+void BridgeExecutor::WorkerLoop() {
+    if (options_.realtime_threads) {
+        BridgeAllocTracker::MarkRealtimeThread();
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        Handle handle;
+        cv_.wait(lock, [this, &handle]() {
+            return !running_ || (handle = PickRunnable()) != nullptr;
+        });
+        if (!handle) {
+            break;
+        }
+
+        auto& stats = stats_[static_cast<size_t>(handle->priority)];
+        const uint64_t wait_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - handle->enqueue_time).count());
+        ++stats.dispatched;
+        stats.total_wait_ns += wait_ns;
+        stats.max_wait_ns = std::max(stats.max_wait_ns, wait_ns);
+        if (wait_ns > static_cast<uint64_t>(options_.starvation_threshold.count())) {
+            ++stats.starved;
+        }
+        lock.unlock();
+
+        // 先清除入队标记再执行，执行期间到达的数据会重新触发入队
+        handle->scheduled.store(false, std::memory_order_release);
+        size_t count = 0;
+        try {
+            count = handle->executable->Execute(options_.max_batch);
+        } catch (const std::exception& e) {
+            std::cerr << "Executor callback error: " << e.what() << std::endl;
+        }
+
+        lock.lock();
+        stats.samples += count;
+        --handle->running;
+        if (IsExclusive(handle->group)) {
+            handle->group->busy_ = false;
+        }
+        // 达到批量上限说明可能还有数据，让出线程后重新排队，避免突发流量独占工作线程
+        bool requeued = false;
+        if (count >= options_.max_batch && !handle->removed &&
+            !handle->scheduled.exchange(true, std::memory_order_acq_rel)) {
+            Enqueue(handle);
+            requeued = true;
+        }
+        // 互斥组释放后，之前因组忙被跳过的实体可能已可运行
+        if (requeued || IsExclusive(handle->group)) {
+            cv_.notify_all();
+        }
+        if (handle->removed) {
+            idle_cv_.notify_all();
+        }
+    }
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,625 @@
+/**
+ * @file bridge_export.cpp
+ * @brief 录制导出实现文件
+ * @note 实现BridgeExporter类的两遍并行导出与BridgeColumnFile类
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_export.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+constexpr size_t kTimestampColumns = 2;        // source_ns、receive_ns
+
+uint64_t AlignColumn(uint64_t size) {
+    return (size + kBridgeColumnAlignment - 1) / kBridgeColumnAlignment * kBridgeColumnAlignment;
+}
+
+/**
+ * @brief 话题名转为文件名，'/'等字符替换为'_'
+ */
+std::string FileName(const std::string& topic) {
+    std::string name = topic;
+    for (char& c : name) {
+        const bool plain = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                           c == '_' || c == '-' || c == '.';
+        if (!plain) {
+            c = '_';
+        }
+    }
+    return name;
+}
+
+bool HostLittleEndian() {
+    const uint16_t probe = 1;
+    uint8_t first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+/**
+ * @brief 把解析出的字段值按列的元素类型写入
+ */
+void StoreValue(uint8_t* out, const BridgeDynamicField& field, const BridgeDynamicValue& value) {
+    switch (field.kind) {
+    case BridgeDynamicKind::kFloat32: {
+        const float f = static_cast<float>(value.f);
+        std::memcpy(out, &f, sizeof(f));
+        return;
+    }
+    case BridgeDynamicKind::kFloat64:
+        std::memcpy(out, &value.f, sizeof(value.f));
+        return;
+    case BridgeDynamicKind::kUint8:
+    case BridgeDynamicKind::kUint16:
+    case BridgeDynamicKind::kUint32:
+    case BridgeDynamicKind::kUint64:
+        std::memcpy(out, &value.u, field.size);        // 小端主机上取低位字节
+        return;
+    default:
+        std::memcpy(out, &value.i, field.size);
+        return;
+    }
+}
+
+void AppendCsvText(std::string& line, const std::string& text) {
+    line.push_back('"');
+    for (char c : text) {
+        if (c == '"') {
+            line.push_back('"');
+        }
+        line.push_back(c);
+    }
+    line.push_back('"');
+}
+
+void AppendCsvValue(std::string& line, BridgeDynamicKind kind, const BridgeDynamicValue& value) {
+    char buffer[32];
+    switch (kind) {
+    case BridgeDynamicKind::kFloat32:
+        std::snprintf(buffer, sizeof(buffer), "%.9g", value.f);
+        break;
+    case BridgeDynamicKind::kFloat64:
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value.f);
+        break;
+    case BridgeDynamicKind::kUint8:
+    case BridgeDynamicKind::kUint16:
+    case BridgeDynamicKind::kUint32:
+    case BridgeDynamicKind::kUint64:
+        std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value.u));
+        break;
+    case BridgeDynamicKind::kString:
+    case BridgeDynamicKind::kSequence:
+        AppendCsvText(line, value.text);
+        return;
+    default:
+        std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value.i));
+        break;
+    }
+    line.append(buffer);
+}
+
+}
+
+/**
+ * @brief 一个输入分段及其在各话题输出中的行号区间，按分段内的话题id下标
+ */
+struct BridgeExporter::Segment {
+    std::string path;
+    uint32_t lane = 0;
+    uint32_t sequence = 0;
+    int64_t start_ns = 0;
+    bool valid = false;
+    std::vector<BridgeRecordedTopic> recorded;
+    std::vector<uint64_t> counts;
+    std::vector<Topic*> topics;             // 不导出的话题为nullptr
+    std::vector<uint64_t> first_rows;
+};
+
+struct BridgeExporter::Topic {
+    std::string name;
+    BridgeTypeDescriptor type;
+    BridgeDynamicLayout layout;
+    bool valid = false;
+    uint64_t rows = 0;
+    std::vector<int> fields;                // 时间戳之后各列对应的字段下标
+    bool fast = false;                      // 定长且不含枚举，可按固定偏移拷贝
+
+    std::string path;                       // 输出文件，写完后由path.tmp改名
+    int fd = -1;
+    uint8_t* base = nullptr;
+    size_t size = 0;
+    std::vector<uint8_t*> columns;          // 各列数据起点（含时间戳列）
+    std::vector<uint8_t> element_sizes;
+    FILE* csv = nullptr;
+};
+
+BridgeExporter::BridgeExporter(const BridgeExportOptions& options) : options_(options) {}
+
+BridgeExporter::~BridgeExporter() {
+    Finish(false);
+}
+
+bool BridgeExporter::Run(const std::vector<std::string>& segments) {
+    stats_ = BridgeExportStats();
+    errors_.store(0, std::memory_order_relaxed);
+    if (::mkdir(options_.directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Export failed: mkdir " << options_.directory << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    // 第一遍：各分段的话题表与每个话题的样本数
+    std::vector<Segment> inputs(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        inputs[i].path = segments[i];
+    }
+    RunParallel(inputs.size(), [&](size_t i) { Scan(inputs[i]); });
+    if (!Plan(inputs)) {
+        return Finish(false);
+    }
+
+    bool ok = true;
+    for (auto& topic : topics_) {
+        if (topic->valid) {
+            ok = (options_.format == BridgeExportFormat::kCsv ? CreateCsvFile(*topic) : CreateColumnFile(*topic)) &&
+                 ok;
+        }
+    }
+    if (!ok) {
+        return Finish(false);
+    }
+
+    // 第二遍：列式输出各分段写入互不重叠的行区间；CSV各分段先格式化到缓冲，再按分段顺序依次追加
+    if (options_.format == BridgeExportFormat::kColumnar) {
+        RunParallel(inputs.size(), [&](size_t i) { ExportColumns(inputs[i]); });
+    } else {
+        std::mutex mutex;
+        std::condition_variable turn_changed;
+        size_t turn = 0;
+        RunParallel(inputs.size(), [&](size_t i) {
+            std::vector<std::string> buffers;
+            ExportCsv(inputs[i], buffers);
+            std::unique_lock<std::mutex> lock(mutex);
+            turn_changed.wait(lock, [&]() { return turn == i; });
+            for (size_t id = 0; id < buffers.size(); ++id) {
+                if (!buffers[id].empty()) {
+                    std::fwrite(buffers[id].data(), 1, buffers[id].size(), inputs[i].topics[id]->csv);
+                }
+            }
+            ++turn;
+            turn_changed.notify_all();
+        });
+    }
+
+    for (const auto& input : inputs) {
+        stats_.segments += input.valid ? 1 : 0;
+    }
+    for (const auto& topic : topics_) {
+        if (topic->valid) {
+            ++stats_.topics;
+            stats_.rows += topic->rows;
+        }
+    }
+    stats_.errors = errors_.load(std::memory_order_relaxed);
+    if (options_.format == BridgeExportFormat::kCsv) {
+        stats_.rows -= std::min(stats_.rows, stats_.errors);
+    }
+    return Finish(true);
+}
+
+void BridgeExporter::RunParallel(size_t count, const std::function<void(size_t)>& work) const {
+    size_t threads = options_.threads != 0 ? options_.threads : std::thread::hardware_concurrency();
+    threads = std::max<size_t>(1, std::min(threads, count));
+    // 按下标递增领取任务：CSV的顺序提交依赖编号小的任务总是先被领取
+    std::atomic<size_t> next{0};
+    auto loop = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            work(i);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i) {
+        workers.emplace_back(loop);
+    }
+    loop();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void BridgeExporter::Scan(Segment& segment) {
+    BridgeSegmentReader reader;
+    if (!reader.Open(segment.path)) {
+        std::cerr << "Export skip " << segment.path << ": not a segment file" << std::endl;
+        return;
+    }
+    segment.lane = reader.Header().lane;
+    segment.sequence = reader.Header().sequence;
+    segment.start_ns = reader.Header().start_ns;
+    BridgeRecordedSample sample;
+    while (reader.Next(sample)) {
+        if (sample.topic_id >= segment.counts.size()) {
+            segment.counts.resize(sample.topic_id + 1u, 0);
+        }
+        ++segment.counts[sample.topic_id];
+    }
+    segment.recorded = reader.Topics();
+    segment.valid = true;
+}
+
+bool BridgeExporter::Plan(std::vector<Segment>& segments) {
+    segments.erase(std::remove_if(segments.begin(), segments.end(), [](const Segment& s) { return !s.valid; }),
+                   segments.end());
+    if (segments.empty()) {
+        std::cerr << "Export failed: no readable segments" << std::endl;
+        return false;
+    }
+    std::sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) {
+        if (a.start_ns != b.start_ns) {
+            return a.start_ns < b.start_ns;
+        }
+        return a.lane != b.lane ? a.lane < b.lane : a.sequence < b.sequence;
+    });
+
+    for (auto& segment : segments) {
+        size_t id_count = segment.counts.size();
+        for (const auto& recorded : segment.recorded) {
+            id_count = std::max<size_t>(id_count, recorded.id + 1u);
+        }
+        segment.counts.resize(id_count, 0);
+        segment.topics.assign(id_count, nullptr);
+        segment.first_rows.assign(id_count, 0);
+        for (const auto& recorded : segment.recorded) {
+            if (!options_.topics.empty() &&
+                std::find(options_.topics.begin(), options_.topics.end(), recorded.name) == options_.topics.end()) {
+                continue;
+            }
+            Topic* topic = AddTopic(recorded);
+            if (topic == nullptr || !topic->valid) {
+                continue;
+            }
+            if (topic->type.type_hash != recorded.type.type_hash) {
+                std::cerr << "Export skip topic " << recorded.name << " in " << segment.path << ": recorded as "
+                          << recorded.type.type_name << ", type differs from " << topic->type.type_name << std::endl;
+                continue;
+            }
+            segment.topics[recorded.id] = topic;
+            segment.first_rows[recorded.id] = topic->rows;
+            topic->rows += segment.counts[recorded.id];
+        }
+    }
+    for (const auto& topic : topics_) {
+        if (topic->valid) {
+            return true;
+        }
+    }
+    std::cerr << "Export failed: no topics to export" << std::endl;
+    return false;
+}
+
+BridgeExporter::Topic* BridgeExporter::AddTopic(const BridgeRecordedTopic& recorded) {
+    for (const auto& topic : topics_) {
+        if (topic->name == recorded.name) {
+            return topic.get();
+        }
+    }
+    auto topic = std::make_unique<Topic>();
+    topic->name = recorded.name;
+    topic->type = recorded.type;
+
+    BridgeDynamicTypePtr type;
+    std::string error;
+    if (recorded.type.type_map.empty()) {
+        error = "no type map recorded";
+    } else if (BridgeParseTypeMap(recorded.type.type_map, recorded.type.type_name, type, &error)) {
+        topic->valid = topic->layout.Build(type);
+    }
+    if (!topic->valid) {
+        std::cerr << "Export skip topic " << recorded.name << " (" << recorded.type.type_name << "): " << error
+                  << std::endl;
+    }
+
+    bool has_enum = false;
+    const auto& fields = topic->layout.Fields();
+    for (size_t i = 0; i < fields.size(); ++i) {
+        // 列式输出只含数值字段，字符串和序列只在CSV中导出
+        if (options_.format == BridgeExportFormat::kCsv || fields[i].size != 0) {
+            topic->fields.push_back(static_cast<int>(i));
+        }
+        has_enum = has_enum || fields[i].kind == BridgeDynamicKind::kEnum;
+    }
+    // XCDR2中枚举按bit_bound编码，宽度可能与列宽不同，走逐字段解析
+    topic->fast = topic->layout.IsFixed() && !has_enum && HostLittleEndian();
+    topics_.push_back(std::move(topic));
+    return topics_.back().get();
+}
+
+bool BridgeExporter::CreateColumnFile(Topic& topic) {
+    const auto& fields = topic.layout.Fields();
+    const size_t column_count = kTimestampColumns + topic.fields.size();
+    std::vector<std::string> names = {"source_ns", "receive_ns"};
+    topic.element_sizes = {8, 8};
+    std::vector<BridgeColumnDescriptor> descriptors(column_count);
+    descriptors[0].kind = descriptors[1].kind = static_cast<uint8_t>(BridgeDynamicKind::kInt64);
+    for (size_t c = kTimestampColumns; c < column_count; ++c) {
+        const BridgeDynamicField& field = fields[topic.fields[c - kTimestampColumns]];
+        names.push_back(field.path);
+        topic.element_sizes.push_back(static_cast<uint8_t>(field.size));
+        descriptors[c].kind = static_cast<uint8_t>(field.kind);
+        descriptors[c].key = field.key ? 1 : 0;
+    }
+
+    std::string table = topic.name + topic.type.type_name;
+    for (size_t c = 0; c < column_count; ++c) {
+        descriptors[c].name_offset = static_cast<uint32_t>(table.size());
+        descriptors[c].name_size = static_cast<uint16_t>(names[c].size());
+        descriptors[c].element_size = topic.element_sizes[c];
+        table += names[c];
+    }
+    uint64_t offset = AlignColumn(sizeof(BridgeColumnHeader) + column_count * sizeof(BridgeColumnDescriptor) +
+                                  table.size());
+    for (size_t c = 0; c < column_count; ++c) {
+        descriptors[c].data_offset = offset;
+        offset += AlignColumn(topic.rows * topic.element_sizes[c]);
+    }
+
+    topic.path = options_.directory + "/" + FileName(topic.name) + ".yjcol";
+    const std::string temp = topic.path + ".tmp";
+    const int fd = ::open(temp.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "Export open " << temp << " failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    // 预分配整个文件：空间不足时在这里失败而不是写入时SIGBUS
+    const int err = ::posix_fallocate(fd, 0, static_cast<off_t>(offset));
+    void* base = err == 0 ? ::mmap(nullptr, offset, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    if (base == MAP_FAILED) {
+        std::cerr << "Export file " << temp << " failed: " << std::strerror(err != 0 ? err : errno) << std::endl;
+        ::close(fd);
+        ::unlink(temp.c_str());
+        return false;
+    }
+    topic.fd = fd;
+    topic.base = static_cast<uint8_t*>(base);
+    topic.size = offset;
+
+    BridgeColumnHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = kBridgeColumnMagic;
+    header.version = kBridgeColumnVersion;
+    header.rows = topic.rows;
+    header.type_hash = topic.type.type_hash;
+    header.column_count = static_cast<uint32_t>(column_count);
+    header.names_size = static_cast<uint32_t>(table.size());
+    header.topic_name_size = static_cast<uint16_t>(topic.name.size());
+    header.type_name_size = static_cast<uint16_t>(topic.type.type_name.size());
+    std::memcpy(topic.base, &header, sizeof(header));
+    std::memcpy(topic.base + sizeof(header), descriptors.data(), column_count * sizeof(BridgeColumnDescriptor));
+    std::memcpy(topic.base + sizeof(header) + column_count * sizeof(BridgeColumnDescriptor), table.data(),
+                table.size());
+    for (const auto& descriptor : descriptors) {
+        topic.columns.push_back(topic.base + descriptor.data_offset);
+    }
+    return true;
+}
+
+bool BridgeExporter::CreateCsvFile(Topic& topic) {
+    topic.path = options_.directory + "/" + FileName(topic.name) + ".csv";
+    const std::string temp = topic.path + ".tmp";
+    topic.csv = std::fopen(temp.c_str(), "w");
+    if (topic.csv == nullptr) {
+        std::cerr << "Export open " << temp << " failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    std::string line = "source_ns,receive_ns";
+    for (int field : topic.fields) {
+        line += "," + topic.layout.Fields()[field].path;
+    }
+    line += "\n";
+    std::fwrite(line.data(), 1, line.size(), topic.csv);
+    return true;
+}
+
+void BridgeExporter::ExportColumns(const Segment& segment) {
+    BridgeSegmentReader reader;
+    if (!reader.Open(segment.path)) {
+        return;
+    }
+    std::vector<uint64_t> rows = segment.first_rows;
+    std::vector<BridgeDynamicValue> values;
+    BridgeRecordedSample sample;
+    while (reader.Next(sample)) {
+        Topic* topic = sample.topic_id < segment.topics.size() ? segment.topics[sample.topic_id] : nullptr;
+        if (topic == nullptr) {
+            continue;
+        }
+        const uint64_t row = rows[sample.topic_id]++;
+        std::memcpy(topic->columns[0] + row * 8, &sample.source_ns, 8);
+        std::memcpy(topic->columns[1] + row * 8, &sample.receive_ns, 8);
+
+        bool xcdr2 = false;
+        bool little_endian = true;
+        if (!BridgeCdrEncoding(sample.payload, sample.size, xcdr2, little_endian)) {
+            errors_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (topic->fast && sample.size - 4 >= topic->layout.FixedSize(xcdr2)) {
+            // 定长类型：各列按固定偏移直接拷贝，大端数据逐字节反转
+            const uint8_t* data = sample.payload + 4;
+            const std::vector<uint32_t>& offsets = topic->layout.FixedOffsets(xcdr2);
+            for (size_t c = kTimestampColumns; c < topic->columns.size(); ++c) {
+                const size_t size = topic->element_sizes[c];
+                const uint8_t* src = data + offsets[topic->fields[c - kTimestampColumns]];
+                uint8_t* dst = topic->columns[c] + row * size;
+                if (little_endian) {
+                    std::memcpy(dst, src, size);
+                } else {
+                    for (size_t b = 0; b < size; ++b) {
+                        dst[b] = src[size - 1 - b];
+                    }
+                }
+            }
+            continue;
+        }
+        if (!topic->layout.Decode(sample.payload, sample.size, values)) {
+            errors_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        const auto& fields = topic->layout.Fields();
+        for (size_t c = kTimestampColumns; c < topic->columns.size(); ++c) {
+            const int field = topic->fields[c - kTimestampColumns];
+            StoreValue(topic->columns[c] + row * topic->element_sizes[c], fields[field], values[field]);
+        }
+    }
+}
+
+void BridgeExporter::ExportCsv(const Segment& segment, std::vector<std::string>& buffers) {
+    buffers.assign(segment.topics.size(), std::string());
+    BridgeSegmentReader reader;
+    if (!reader.Open(segment.path)) {
+        return;
+    }
+    std::vector<BridgeDynamicValue> values;
+    BridgeRecordedSample sample;
+    char buffer[48];
+    while (reader.Next(sample)) {
+        Topic* topic = sample.topic_id < segment.topics.size() ? segment.topics[sample.topic_id] : nullptr;
+        if (topic == nullptr) {
+            continue;
+        }
+        if (!topic->layout.Decode(sample.payload, sample.size, values)) {
+            errors_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        std::string& line = buffers[sample.topic_id];
+        std::snprintf(buffer, sizeof(buffer), "%lld,%lld", static_cast<long long>(sample.source_ns),
+                      static_cast<long long>(sample.receive_ns));
+        line.append(buffer);
+        const auto& fields = topic->layout.Fields();
+        for (int field : topic->fields) {
+            line.push_back(',');
+            AppendCsvValue(line, fields[field].kind, values[field]);
+        }
+        line.push_back('\n');
+    }
+}
+
+bool BridgeExporter::Finish(bool ok) {
+    for (auto& topic : topics_) {
+        bool written = ok;
+        const std::string temp = topic->path + ".tmp";
+        if (topic->base != nullptr) {
+            written = ::msync(topic->base, topic->size, MS_SYNC) == 0 && written;
+            ::munmap(topic->base, topic->size);
+            ::close(topic->fd);
+            topic->base = nullptr;
+            topic->fd = -1;
+        } else if (topic->csv != nullptr) {
+            written = std::fclose(topic->csv) == 0 && written;
+            topic->csv = nullptr;
+        } else {
+            continue;
+        }
+        if (!written || ::rename(temp.c_str(), topic->path.c_str()) != 0) {
+            if (ok) {
+                std::cerr << "Export write " << topic->path << " failed: " << std::strerror(errno) << std::endl;
+            }
+            ::unlink(temp.c_str());
+            ok = false;
+        }
+    }
+    topics_.clear();
+    return ok;
+}
+
+BridgeColumnFile::~BridgeColumnFile() {
+    Close();
+}
+
+bool BridgeColumnFile::Open(const std::string& path) {
+    Close();
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(BridgeColumnHeader)) {
+        ::close(fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    base_ = static_cast<const uint8_t*>(base);
+    size_ = static_cast<size_t>(st.st_size);
+    header_ = reinterpret_cast<const BridgeColumnHeader*>(base_);
+    const size_t names_offset = sizeof(BridgeColumnHeader) + header_->column_count * sizeof(BridgeColumnDescriptor);
+    bool valid = header_->magic == kBridgeColumnMagic && header_->version == kBridgeColumnVersion &&
+                 names_offset + header_->names_size <= size_;
+    if (valid) {
+        columns_ = reinterpret_cast<const BridgeColumnDescriptor*>(base_ + sizeof(BridgeColumnHeader));
+        names_ = reinterpret_cast<const char*>(base_ + names_offset);
+        for (size_t c = 0; c < header_->column_count && valid; ++c) {
+            valid = columns_[c].name_offset + columns_[c].name_size <= header_->names_size &&
+                    columns_[c].data_offset + header_->rows * columns_[c].element_size <= size_;
+        }
+    }
+    if (!valid) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void BridgeColumnFile::Close() {
+    if (base_ != nullptr) {
+        ::munmap(const_cast<uint8_t*>(base_), size_);
+    }
+    base_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    columns_ = nullptr;
+    names_ = nullptr;
+}
+
+std::string BridgeColumnFile::TopicName() const {
+    return std::string(names_, header_->topic_name_size);
+}
+
+std::string BridgeColumnFile::TypeName() const {
+    return std::string(names_ + header_->topic_name_size, header_->type_name_size);
+}
+
+std::string BridgeColumnFile::ColumnName(size_t index) const {
+    return std::string(names_ + columns_[index].name_offset, columns_[index].name_size);
+}
+
+int BridgeColumnFile::FindColumn(const std::string& name) const {
+    for (size_t c = 0; c < header_->column_count; ++c) {
+        if (ColumnName(c) == name) {
+            return static_cast<int>(c);
+        }
+    }
+    return -1;
+}
+
+} // namespace robot
+} // namespace yunji
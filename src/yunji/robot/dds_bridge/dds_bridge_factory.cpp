@@ -4,6 +4,9 @@
  * @note 实现BridgeFactory类的具体功能
  */
 #include "yunji/robot/dds_bridge/dds_bridge_factory.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+
+#include <algorithm>
 
 namespace yunji {
 namespace robot {
@@ -62,6 +65,131 @@ void BridgeFactory::Init(const std::string& config_path) {
     }
 }
 
+/**
+ * @brief 初始化DDS通信层（通过发现参数）
+ * @param domain_id DDS域ID
+ * @param options 发现参数
+ * @throw std::runtime_error 初始化失败时抛出异常
+ */
+void BridgeFactory::Init(int domain_id, const BridgeDiscoveryOptions& options) {
+
+    try {
+        const std::string config_xml = BridgeDiscoveryConfigXml(options);
+        ::setenv("CYCLONEDDS_URI", config_xml.c_str(), 1);
+
+        // 先释放旧参与者：同一域的配置只在域首次创建时读取
+        participant_.reset();
+        participant_ = std::make_shared<dds::domain::DomainParticipant>(domain_id);
+
+    } catch (const dds::core::Exception& e) {
+        throw std::runtime_error("DDS discovery initialization failed: " + std::string(e.what()));
+    }
+}
+
+void BridgeFactory::RegisterMetrics(const BridgeTopicMetricsPtr& metrics) {
+    if (!metrics) {
+        return;
+    }
+    MetricsEntry entry;
+    entry.metrics = metrics;
+    entry.last_messages = metrics->Messages();
+    entry.last_bytes = metrics->Bytes();
+    entry.last_time_ns = BridgeClock::Instance()->Now();
+
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    metrics_.push_back(std::move(entry));
+}
+
+void BridgeFactory::UnregisterMetrics(const BridgeTopicMetricsPtr& metrics) {
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    auto it = std::find_if(metrics_.begin(), metrics_.end(),
+                           [&metrics](const MetricsEntry& entry) { return entry.metrics == metrics; });
+    if (it != metrics_.end()) {
+        metrics_.erase(it);     // 统计对象随条目释放
+    }
+}
+
+/**
+ * @brief 刷新一个端点的Cyclone统计并计算速率
+ * @note 统计对象在首次调用时创建，之后只刷新数值，不再分配内存；端点重建（如切换分区）后重新创建
+ */
+template <typename StatisticsPtr>
+static void CollectDdsStatistics(StatisticsPtr& stats, std::vector<uint64_t>& last_values,
+                                 dds_entity_t entity, double seconds,
+                                 std::vector<BridgeDdsStatistic>& out) {
+    if (entity <= 0) {
+        return;
+    }
+    if (stats && stats->entity != entity) {
+        stats.reset();
+    }
+    bool first = false;
+    if (!stats) {
+        stats.reset(dds_create_statistics(entity));
+        if (!stats) {
+            return;
+        }
+        first = true;
+    } else if (dds_refresh_statistics(stats.get()) != DDS_RETCODE_OK) {
+        return;
+    }
+
+    last_values.resize(stats->count, 0);
+    out.reserve(stats->count);
+    for (size_t i = 0; i < stats->count; ++i) {
+        const dds_stat_keyvalue& kv = stats->kv[i];
+        BridgeDdsStatistic stat;
+        stat.name = kv.name;
+        switch (kv.kind) {
+            case DDS_STAT_KIND_UINT32: stat.value = kv.u.u32; break;
+            case DDS_STAT_KIND_UINT64: stat.value = kv.u.u64; break;
+            case DDS_STAT_KIND_LENGTHTIME: stat.value = kv.u.lengthtime; break;
+        }
+        if (!first && seconds > 0.0 && stat.value >= last_values[i]) {
+            stat.rate = (stat.value - last_values[i]) / seconds;
+        }
+        last_values[i] = stat.value;
+        out.push_back(std::move(stat));
+    }
+}
+
+BridgeMetricsSnapshot BridgeFactory::Metrics() {
+    BridgeMetricsSnapshot snapshot;
+    snapshot.time_ns = BridgeClock::Instance()->Now();
+
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    snapshot.topics.reserve(metrics_.size());
+    for (auto& entry : metrics_) {
+        const BridgeTopicMetrics& metrics = *entry.metrics;
+        BridgeTopicMetricsSnapshot topic;
+        topic.kind = metrics.Kind();
+        topic.topic = metrics.Topic();
+        topic.type = metrics.Type();
+        topic.messages = metrics.Messages();
+        topic.bytes = metrics.Bytes();
+        topic.allocations = metrics.Allocations();
+
+        const double seconds = (snapshot.time_ns - entry.last_time_ns) / 1e9;
+        if (seconds > 0.0) {
+            topic.message_rate = (topic.messages - entry.last_messages) / seconds;
+            topic.byte_rate = (topic.bytes - entry.last_bytes) / seconds;
+        }
+        CollectDdsStatistics(entry.dds_stats, entry.last_dds_values, metrics.Entity(), seconds,
+                             topic.dds_statistics);
+        entry.last_messages = topic.messages;
+        entry.last_bytes = topic.bytes;
+        entry.last_time_ns = snapshot.time_ns;
+
+        if (topic.kind == BridgeEndpointKind::kPublisher) {
+            topic.publish_ns = metrics.publish_ns.Snapshot();
+        } else {
+            topic.latency_ns = metrics.latency_ns.Snapshot();
+            topic.callback_ns = metrics.callback_ns.Snapshot();
+        }
+        snapshot.topics.push_back(std::move(topic));
+    }
+    return snapshot;
+}
 
 } // namespace robot
 } // namespace yunji
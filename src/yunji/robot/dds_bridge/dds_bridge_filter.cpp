@@ -0,0 +1,269 @@
+/**
+ * @file bridge_filter.cpp
+ * @brief 订阅内容过滤实现文件
+ * @note 实现BridgeContentFilter的条件编译与求值，以及BridgeReaderFilter的两级过滤
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+bool IsNumeric(BridgeDynamicKind kind) {
+    return kind <= BridgeDynamicKind::kEnum;
+}
+
+bool IsFloat(BridgeDynamicKind kind) {
+    return kind == BridgeDynamicKind::kFloat32 || kind == BridgeDynamicKind::kFloat64;
+}
+
+template <typename V>
+bool Compare(V lhs, BridgeFilterOp op, V rhs) {
+    switch (op) {
+    case BridgeFilterOp::kEq:
+        return lhs == rhs;
+    case BridgeFilterOp::kNe:
+        return lhs != rhs;
+    case BridgeFilterOp::kLt:
+        return lhs < rhs;
+    case BridgeFilterOp::kLe:
+        return lhs <= rhs;
+    case BridgeFilterOp::kGt:
+        return lhs > rhs;
+    case BridgeFilterOp::kGe:
+        return lhs >= rhs;
+    }
+    return false;
+}
+
+const char* OpName(BridgeFilterOp op) {
+    static const char* names[] = {"==", "!=", "<", "<=", ">", ">="};
+    return names[static_cast<size_t>(op)];
+}
+
+uint64_t InstanceSlot(uint64_t instance) {
+    return (instance * 0x9e3779b97f4a7c15ULL) >> 32;
+}
+
+}
+
+BridgeContentFilter& BridgeContentFilter::KeyIn(std::vector<int64_t> ids) {
+    std::sort(ids.begin(), ids.end());
+    key_sets_.push_back(std::move(ids));
+    return *this;
+}
+
+BridgeContentFilter& BridgeContentFilter::KeyRange(int64_t min, int64_t max) {
+    key_ranges_.emplace_back(min, max);
+    return *this;
+}
+
+BridgeContentFilter& BridgeContentFilter::Where(const std::string& path, BridgeFilterOp op, double value) {
+    Predicate predicate;
+    predicate.path = path;
+    predicate.op = op;
+    predicate.value = value;
+    predicates_.push_back(std::move(predicate));
+    return *this;
+}
+
+bool BridgeContentFilter::Compile(const BridgeDynamicLayout& layout, std::string* error) {
+    const std::vector<BridgeDynamicField>& fields = layout.Fields();
+    key_index_ = -1;
+    for (size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i].key && IsNumeric(fields[i].kind) && !IsFloat(fields[i].kind)) {
+            key_index_ = static_cast<int>(i);
+            break;
+        }
+    }
+    if (HasKeyCondition() && key_index_ < 0) {
+        if (error != nullptr) {
+            *error = "type has no integer key member";
+        }
+        return false;
+    }
+    for (auto& predicate : predicates_) {
+        predicate.index = layout.FindField(predicate.path);
+        if (predicate.index < 0 || !IsNumeric(fields[predicate.index].kind)) {
+            if (error != nullptr) {
+                *error = predicate.index < 0 ? "no field " + predicate.path : predicate.path + " is not numeric";
+            }
+            return false;
+        }
+        // 整数字段与整数常量按整数比较，避免64位时间戳等大整数转成浮点数后丢失精度
+        predicate.integer = !IsFloat(fields[predicate.index].kind) && predicate.value == std::floor(predicate.value) &&
+                            std::fabs(predicate.value) < 9.2e18;
+    }
+    return true;
+}
+
+bool BridgeContentFilter::MatchesKey(const BridgeDynamicView& view) const {
+    if (!HasKeyCondition()) {
+        return true;
+    }
+    const int64_t key = view.Int(key_index_);
+    for (const auto& ids : key_sets_) {
+        if (!std::binary_search(ids.begin(), ids.end(), key)) {
+            return false;
+        }
+    }
+    for (const auto& range : key_ranges_) {
+        if (key < range.first || key > range.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BridgeContentFilter::MatchesFields(const BridgeDynamicView& view) const {
+    for (const auto& predicate : predicates_) {
+        if (!view.Has(predicate.index)) {
+            return false;
+        }
+        const bool match = predicate.integer
+            ? Compare(view.Int(predicate.index), predicate.op, static_cast<int64_t>(predicate.value))
+            : Compare(view.Double(predicate.index), predicate.op, predicate.value);
+        if (!match) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string BridgeContentFilter::ToString() const {
+    std::string text;
+    auto append = [&text](const std::string& term) {
+        text += text.empty() ? term : " && " + term;
+    };
+    for (const auto& ids : key_sets_) {
+        std::string term = "key in {";
+        for (size_t i = 0; i < ids.size(); ++i) {
+            term += (i == 0 ? "" : ", ") + std::to_string(ids[i]);
+        }
+        append(term + "}");
+    }
+    for (const auto& range : key_ranges_) {
+        append("key in [" + std::to_string(range.first) + ", " + std::to_string(range.second) + "]");
+    }
+    char value[32];
+    for (const auto& predicate : predicates_) {
+        std::snprintf(value, sizeof(value), "%g", predicate.value);
+        append(predicate.path + " " + OpName(predicate.op) + " " + value);
+    }
+    return text.empty() ? "true" : text;
+}
+
+bool BridgeReaderFilter::Build(const std::vector<uint8_t>& type_map, const std::string& type_name) {
+    BridgeDynamicTypePtr type;
+    std::string error;
+    if (!BridgeParseTypeMap(type_map, type_name, type, &error) || !layout_.Build(type) ||
+        !filter_.Compile(layout_, &error)) {
+        std::cerr << "Content filter on " << type_name << " invalid: "
+                  << (error.empty() ? "type information unavailable" : error) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool BridgeReaderFilter::Install(dds_entity_t topic) {
+    if (!filter_.HasKeyCondition()) {
+        return true;        // 只有字段条件时每个样本都要看数据，不提前丢弃
+    }
+    dds_topic_filter filter{};
+    filter.mode = DDS_TOPIC_FILTER_SAMPLEINFO_ARG;
+    filter.f.sampleinfo_arg = &BridgeReaderFilter::OnStore;
+    filter.arg = this;
+    const dds_return_t ret = dds_set_topic_filter_extended(topic, &filter);
+    if (ret != DDS_RETCODE_OK) {
+        std::cerr << "Content filter install failed: " << dds_strretcode(ret) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void BridgeReaderFilter::Uninstall(dds_entity_t topic) {
+    if (!filter_.HasKeyCondition()) {
+        return;
+    }
+    dds_topic_filter filter{};
+    filter.mode = DDS_TOPIC_FILTER_NONE;
+    dds_set_topic_filter_extended(topic, &filter);
+}
+
+bool BridgeReaderFilter::Accept(BridgeDynamicView& view, const uint8_t* payload, size_t size,
+                                dds_instance_handle_t instance) {
+    if (!view.Bind(layout_, payload, size)) {
+        errors_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (!filter_.MatchesKey(view)) {
+        RejectInstance(instance);
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (!filter_.MatchesFields(view)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    passed_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+BridgeFilterStats BridgeReaderFilter::Stats() const {
+    BridgeFilterStats stats;
+    stats.passed = passed_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    stats.dropped_in_reader = dropped_.load(std::memory_order_relaxed);
+    stats.errors = errors_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool BridgeReaderFilter::OnStore(const dds_sample_info_t* info, void* arg) {
+    auto* self = static_cast<BridgeReaderFilter*>(arg);
+    if (!self->IsRejected(info->instance_handle)) {
+        return true;
+    }
+    self->dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void BridgeReaderFilter::RejectInstance(dds_instance_handle_t instance) {
+    if (instance == 0) {
+        return;
+    }
+    const uint64_t start = InstanceSlot(instance);
+    for (size_t probe = 0; probe < kProbeLimit; ++probe) {
+        std::atomic<uint64_t>& slot = rejected_instances_[(start + probe) & (kInstanceSlots - 1)];
+        uint64_t expected = 0;
+        if (slot.compare_exchange_strong(expected, instance, std::memory_order_release, std::memory_order_relaxed) ||
+            expected == instance) {
+            return;
+        }
+    }
+}
+
+bool BridgeReaderFilter::IsRejected(dds_instance_handle_t instance) const {
+    if (instance == 0) {
+        return false;
+    }
+    const uint64_t start = InstanceSlot(instance);
+    for (size_t probe = 0; probe < kProbeLimit; ++probe) {
+        const uint64_t value = rejected_instances_[(start + probe) & (kInstanceSlots - 1)].load(std::memory_order_acquire);
+        if (value == instance) {
+            return true;
+        }
+        if (value == 0) {
+            return false;
+        }
+    }
+    return false;
+}
+
+} // namespace robot
+} // namespace yunji
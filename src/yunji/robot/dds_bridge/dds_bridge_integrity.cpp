@@ -0,0 +1,108 @@
+/**
+ * @file bridge_integrity.cpp
+ * @brief 完整性检测实现文件
+ * @note 实现BridgeSequenceTracker类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_integrity.hpp"
+
+#include <iostream>
+
+namespace yunji {
+namespace robot {
+
+BridgeSequenceTracker::BridgeSequenceTracker(const BridgeIntegrityOptions& options)
+    : options_(options) {}
+
+bool BridgeSequenceTracker::Observe(int64_t key, uint64_t sequence, uint64_t timestamp_ns, int64_t now_ns) {
+    received_.fetch_add(1, std::memory_order_relaxed);
+
+    bool deliver = true;
+    if (timestamp_ns != 0) {
+        const int64_t age = now_ns - static_cast<int64_t>(timestamp_ns);
+        age_ns_.Record(age > 0 ? static_cast<uint64_t>(age) : 0);
+        if (options_.max_age.count() > 0 && age > options_.max_age.count()) {
+            stale_.fetch_add(1, std::memory_order_relaxed);
+            deliver = !options_.drop_stale;
+        }
+    }
+
+    if (sequence == 0) {
+        return deliver;
+    }
+
+    BridgeLossEvent loss;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = keys_.find(key);
+        if (it == keys_.end()) {
+            // 首次出现的key以当前序号为基线，不追溯之前的缺口，基线之前的序号视为已收到
+            KeyState& state = keys_[key];
+            state.highest = sequence;
+            state.window = kAllSeen;
+            return deliver;
+        }
+
+        KeyState& state = it->second;
+        if (sequence > state.highest) {
+            const uint64_t shift = sequence - state.highest;
+            if (shift > 1) {
+                loss.key = key;
+                loss.expected = state.highest + 1;
+                loss.received = sequence;
+                loss.lost = shift - 1;
+                lost_.fetch_add(static_cast<int64_t>(loss.lost), std::memory_order_relaxed);
+            }
+            state.window = shift >= kWindow ? 0 : state.window << shift;
+            state.window |= 1;
+            state.highest = sequence;
+        } else {
+            const uint64_t distance = state.highest - sequence;
+            if (distance >= kWindow || (sequence == kFirstSequence && distance > 0)) {
+                // 落后超过窗口或回到首个序号：发布端重启或序号回绕，重新建立基线
+                resets_.fetch_add(1, std::memory_order_relaxed);
+                state.highest = sequence;
+                state.window = kAllSeen;
+                return deliver;
+            }
+            const uint64_t bit = uint64_t(1) << distance;
+            if (state.window & bit) {
+                duplicates_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                // 未置位的位只来自上面已计入丢失的缺口，迟到样本从丢失中扣除
+                state.window |= bit;
+                reordered_.fetch_add(1, std::memory_order_relaxed);
+                lost_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 回调在锁外执行，允许其中查询Stats()
+    if (loss.lost > 0 && options_.on_loss) {
+        try {
+            options_.on_loss(loss);
+        } catch (const std::exception& e) {
+            std::cerr << "Loss callback error: " << e.what() << std::endl;
+        }
+    }
+    return deliver;
+}
+
+BridgeIntegrityStats BridgeSequenceTracker::Stats() const {
+    BridgeIntegrityStats stats;
+    stats.received = received_.load(std::memory_order_relaxed);
+    const int64_t lost = lost_.load(std::memory_order_relaxed);
+    stats.lost = lost > 0 ? static_cast<uint64_t>(lost) : 0;
+    stats.reordered = reordered_.load(std::memory_order_relaxed);
+    stats.duplicates = duplicates_.load(std::memory_order_relaxed);
+    stats.resets = resets_.load(std::memory_order_relaxed);
+    stats.stale = stale_.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.keys = keys_.size();
+    }
+    stats.age_ns = age_ns_.Snapshot();
+    return stats;
+}
+
+} // namespace robot
+} // namespace yunji
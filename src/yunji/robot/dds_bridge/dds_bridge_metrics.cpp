@@ -0,0 +1,130 @@
+/**
+ * @file bridge_metrics.cpp
+ * @brief 桥接层统计实现文件
+ * @note 实现BridgeHistogram及统计快照的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_metrics.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+namespace yunji {
+namespace robot {
+
+uint64_t BridgeHistogram::BucketLowerBound(size_t index) {
+    if (index < kLinearBuckets) {
+        return index;
+    }
+    const size_t offset = index - kLinearBuckets;
+    const int msb = static_cast<int>(offset >> kSubBucketBits) + kSubBucketBits + 1;
+    const uint64_t sub = offset & ((size_t(1) << kSubBucketBits) - 1);
+    return ((uint64_t(1) << kSubBucketBits) + sub) << (msb - kSubBucketBits);
+}
+
+uint64_t BridgeHistogram::BucketWidth(size_t index) {
+    if (index < kLinearBuckets) {
+        return 1;
+    }
+    const size_t offset = index - kLinearBuckets;
+    const int msb = static_cast<int>(offset >> kSubBucketBits) + kSubBucketBits + 1;
+    return uint64_t(1) << (msb - kSubBucketBits);
+}
+
+BridgeHistogramSnapshot BridgeHistogram::Snapshot() const {
+    BridgeHistogramSnapshot snapshot;
+    snapshot.buckets.resize(kBucketCount);
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    snapshot.count = count_.load(std::memory_order_relaxed);
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    const uint64_t min = min_.load(std::memory_order_relaxed);
+    snapshot.min = (min == UINT64_MAX) ? 0 : min;
+    return snapshot;
+}
+
+void BridgeHistogram::Reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(UINT64_MAX, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t BridgeHistogramSnapshot::Percentile(double quantile) const {
+    // 桶计数与总数分别读取，并发记录时可能略有出入，以桶计数之和为准
+    uint64_t total = 0;
+    for (uint64_t bucket : buckets) {
+        total += bucket;
+    }
+    if (total == 0) {
+        return 0;
+    }
+    if (quantile <= 0.0) {
+        return min;
+    }
+    if (quantile >= 1.0) {
+        return max;
+    }
+    const uint64_t rank = static_cast<uint64_t>(std::ceil(quantile * total));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            const uint64_t value = BridgeHistogram::BucketLowerBound(i) + BridgeHistogram::BucketWidth(i) / 2;
+            return value > max ? max : (value < min ? min : value);
+        }
+    }
+    return max;
+}
+
+std::string BridgeMetricsSnapshot::ToString() const {
+    std::string out;
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-4s %-28s %10s %10s %12s %10s %10s %10s %10s\n",
+                  "role", "topic", "msgs", "msg/s", "bytes/s", "p50(us)", "p99(us)", "p99.9(us)", "max(us)");
+    out += line;
+    for (const auto& topic : topics) {
+        const bool is_pub = topic.kind == BridgeEndpointKind::kPublisher;
+        const BridgeHistogramSnapshot& hist = is_pub ? topic.publish_ns : topic.latency_ns;
+        std::snprintf(line, sizeof(line), "%-4s %-28s %10llu %10.1f %12.0f %10.1f %10.1f %10.1f %10.1f\n",
+                      is_pub ? "pub" : "sub", topic.topic.c_str(),
+                      static_cast<unsigned long long>(topic.messages),
+                      topic.message_rate, topic.byte_rate,
+                      hist.Percentile(0.5) / 1e3, hist.Percentile(0.99) / 1e3,
+                      hist.Percentile(0.999) / 1e3, hist.max / 1e3);
+        out += line;
+        if (!is_pub && topic.callback_ns.count > 0) {
+            std::snprintf(line, sizeof(line), "%-4s %-28s %10s %10s %12s %10.1f %10.1f %10.1f %10.1f\n",
+                          "", "  callback", "", "", "",
+                          topic.callback_ns.Percentile(0.5) / 1e3, topic.callback_ns.Percentile(0.99) / 1e3,
+                          topic.callback_ns.Percentile(0.999) / 1e3, topic.callback_ns.max / 1e3);
+            out += line;
+        }
+        if (topic.allocations > 0 && topic.messages > 0) {
+            std::snprintf(line, sizeof(line), "       allocs/msg=%.2f\n",
+                          static_cast<double>(topic.allocations) / topic.messages);
+            out += line;
+        }
+        // 只打印非零的底层统计，重传、限流、丢弃等异常一目了然
+        std::string dds_line;
+        for (const auto& stat : topic.dds_statistics) {
+            if (stat.value == 0) {
+                continue;
+            }
+            std::snprintf(line, sizeof(line), " %s=%llu(%.0f/s)", stat.name.c_str(),
+                          static_cast<unsigned long long>(stat.value), stat.rate);
+            dds_line += line;
+        }
+        if (!dds_line.empty()) {
+            out += "       dds:" + dds_line + "\n";
+        }
+    }
+    return out;
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,95 @@
+/**
+ * @file bridge_qos.cpp
+ * @brief QoS预设实现文件
+ * @note 实现各QoS预设到DDS策略的映射
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_qos.hpp"
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+struct PresetPolicies {
+    bool reliable;
+    int32_t depth;
+    bool transient_local;
+};
+
+PresetPolicies Policies(BridgeQosPreset preset) {
+    switch (preset) {
+        case BridgeQosPreset::kControl: return {false, 1, false};
+        case BridgeQosPreset::kReliable: return {true, 16, false};
+        case BridgeQosPreset::kTelemetry: return {false, 16, false};
+        case BridgeQosPreset::kLatched: return {true, 1, true};
+        default: return {false, 0, false};
+    }
+}
+
+template <typename Qos>
+Qos Apply(BridgeQosPreset preset, Qos qos) {
+    if (preset == BridgeQosPreset::kDefault) {
+        return qos;
+    }
+    const PresetPolicies policies = Policies(preset);
+    qos << (policies.reliable ? dds::core::policy::Reliability::Reliable()
+                              : dds::core::policy::Reliability::BestEffort())
+        << dds::core::policy::History::KeepLast(policies.depth)
+        << (policies.transient_local ? dds::core::policy::Durability::TransientLocal()
+                                     : dds::core::policy::Durability::Volatile());
+    return qos;
+}
+
+template <typename Qos>
+Qos ApplyPartitions(const std::vector<std::string>& partitions, Qos qos) {
+    if (!partitions.empty()) {
+        qos << dds::core::policy::Partition(dds::core::StringSeq(partitions.begin(), partitions.end()));
+    }
+    return qos;
+}
+
+}
+
+const char* BridgeQosPresetName(BridgeQosPreset preset) {
+    switch (preset) {
+        case BridgeQosPreset::kDefault: return "default";
+        case BridgeQosPreset::kControl: return "control";
+        case BridgeQosPreset::kReliable: return "reliable";
+        case BridgeQosPreset::kTelemetry: return "telemetry";
+        case BridgeQosPreset::kLatched: return "latched";
+    }
+    return "unknown";
+}
+
+bool BridgeQosPresetFromName(const std::string& name, BridgeQosPreset& preset) {
+    for (auto candidate : {BridgeQosPreset::kDefault, BridgeQosPreset::kControl, BridgeQosPreset::kReliable,
+                           BridgeQosPreset::kTelemetry, BridgeQosPreset::kLatched}) {
+        if (name == BridgeQosPresetName(candidate)) {
+            preset = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+dds::pub::qos::DataWriterQos BridgeWriterQos(BridgeQosPreset preset, dds::pub::qos::DataWriterQos qos) {
+    return Apply(preset, std::move(qos));
+}
+
+dds::sub::qos::DataReaderQos BridgeReaderQos(BridgeQosPreset preset, dds::sub::qos::DataReaderQos qos) {
+    return Apply(preset, std::move(qos));
+}
+
+dds::pub::qos::PublisherQos BridgePublisherQos(const std::vector<std::string>& partitions,
+                                               dds::pub::qos::PublisherQos qos) {
+    return ApplyPartitions(partitions, std::move(qos));
+}
+
+dds::sub::qos::SubscriberQos BridgeSubscriberQos(const std::vector<std::string>& partitions,
+                                                 dds::sub::qos::SubscriberQos qos) {
+    return ApplyPartitions(partitions, std::move(qos));
+}
+
+} // namespace robot
+} // namespace yunji
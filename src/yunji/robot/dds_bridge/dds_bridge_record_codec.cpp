@@ -0,0 +1,314 @@
+/**
+ * @file bridge_record_codec.cpp
+ * @brief 录制样本编码实现文件
+ * @note 实现BridgeDeltaCodec类的字段定位、残差计算与变长整数编码
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_record_codec.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+constexpr uint32_t kMaxDeltaRun = 1024;         // 没有索引时也至少每这么多条样本一个关键帧
+constexpr double kMaxQuantized = 9007199254740992.0;    // 2^53，量化值超出时改用关键帧
+
+uint64_t Mask(uint8_t size) {
+    return size >= 8 ? ~0ULL : (1ULL << (size * 8)) - 1;
+}
+
+int64_t SignExtend(uint64_t value, uint8_t size) {
+    if (size >= 8) {
+        return static_cast<int64_t>(value);
+    }
+    const int shift = 64 - size * 8;
+    return static_cast<int64_t>(value << shift) >> shift;
+}
+
+uint64_t ZigZag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+uint64_t Load(const uint8_t* data, uint8_t size, bool swap) {
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < size; ++i) {
+        value |= static_cast<uint64_t>(data[swap ? size - 1 - i : i]) << (8 * i);
+    }
+    return value;
+}
+
+void Store(uint8_t* data, uint8_t size, bool swap, uint64_t value) {
+    for (uint8_t i = 0; i < size; ++i) {
+        data[swap ? size - 1 - i : i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+double ToDouble(uint64_t bits, uint8_t size) {
+    if (size == 4) {
+        const uint32_t narrow = static_cast<uint32_t>(bits);
+        float value;
+        std::memcpy(&value, &narrow, sizeof(value));
+        return value;
+    }
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint64_t FromDouble(double value, uint8_t size) {
+    if (size == 4) {
+        const float narrow = static_cast<float>(value);
+        uint32_t bits;
+        std::memcpy(&bits, &narrow, sizeof(bits));
+        return bits;
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/**
+ * @brief 量化，非有限值或超出2^53时返回false；只用IEEE除法和llround，各平台结果一致
+ */
+bool Quantize(double value, double step, int64_t& quantized) {
+    const double scaled = value / step;
+    if (!std::isfinite(scaled) || std::fabs(scaled) >= kMaxQuantized) {
+        return false;
+    }
+    quantized = std::llround(scaled);
+    return true;
+}
+
+bool HostLittleEndian() {
+    const uint16_t probe = 1;
+    uint8_t first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+}
+
+bool BridgeDeltaCodec::Init(const std::vector<uint8_t>& type_map, const std::string& type_name,
+                            double quantization) {
+    fields_.clear();
+    has_base_ = false;
+    BridgeDynamicTypePtr type;
+    BridgeDynamicLayout layout;
+    if (!BridgeParseTypeMap(type_map, type_name, type) || !layout.Build(type) || !layout.IsFixed()) {
+        return false;
+    }
+    quantization_ = quantization > 0.0 ? quantization : 0.0;
+    const auto& fields = layout.Fields();
+    for (size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i].kind == BridgeDynamicKind::kEnum) {
+            fields_.clear();
+            return false;       // XCDR2中枚举宽度随bit_bound变化，暂不支持
+        }
+        Field field;
+        field.offsets[0] = layout.FixedOffsets(false)[i];
+        field.offsets[1] = layout.FixedOffsets(true)[i];
+        field.size = static_cast<uint8_t>(fields[i].size);
+        const bool floating = fields[i].kind == BridgeDynamicKind::kFloat32 ||
+                              fields[i].kind == BridgeDynamicKind::kFloat64;
+        field.mode = !floating ? Mode::kInteger : quantization_ > 0.0 ? Mode::kQuantized : Mode::kXor;
+        fields_.push_back(field);
+    }
+    for (int encoding = 0; encoding < 2; ++encoding) {
+        fixed_size_[encoding] = layout.FixedSize(encoding == 1);
+        std::vector<std::pair<uint32_t, uint32_t>> covered;
+        for (const auto& field : fields_) {
+            covered.emplace_back(field.offsets[encoding], field.offsets[encoding] + field.size);
+        }
+        std::sort(covered.begin(), covered.end());
+        gaps_[encoding].clear();
+        uint32_t cursor = 0;
+        for (const auto& range : covered) {
+            if (range.first > cursor) {
+                gaps_[encoding].emplace_back(cursor, range.first);
+            }
+            cursor = std::max(cursor, range.second);
+        }
+        if (fixed_size_[encoding] > cursor) {
+            gaps_[encoding].emplace_back(cursor, fixed_size_[encoding]);
+        }
+    }
+    states_.assign(fields_.size(), State());
+    values_.assign(fields_.size(), 0);
+    return !fields_.empty();
+}
+
+void BridgeDeltaCodec::SetBase(const uint8_t* payload, size_t size) {
+    Rebase(payload, size);
+}
+
+void BridgeDeltaCodec::Rebase(const uint8_t* payload, size_t size) {
+    bool little_endian = true;
+    has_base_ = BridgeCdrEncoding(payload, size, xcdr2_, little_endian) &&
+                size - 4 >= fixed_size_[xcdr2_ ? 1 : 0] && !fields_.empty();
+    if (!has_base_) {
+        return;
+    }
+    swap_ = little_endian != HostLittleEndian();
+    base_.assign(payload, payload + size);
+    run_ = 0;
+    const uint8_t* data = payload + 4;
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        const Field& field = fields_[i];
+        const uint64_t bits = Load(data + field.offsets[xcdr2_ ? 1 : 0], field.size, swap_);
+        State& state = states_[i];
+        state.delta = 0;
+        if (field.mode == Mode::kQuantized) {
+            int64_t quantized = 0;
+            Quantize(ToDouble(bits, field.size), quantization_, quantized);
+            state.value = static_cast<uint64_t>(quantized);     // 无法量化时为0，两端一致
+        } else {
+            state.value = bits;
+        }
+    }
+}
+
+size_t BridgeDeltaCodec::Encode(const uint8_t* payload, size_t size, bool keyframe, uint8_t* out) {
+    const int encoding = xcdr2_ ? 1 : 0;
+    bool delta = has_base_ && !keyframe && run_ < kMaxDeltaRun && size == base_.size() &&
+                 std::memcmp(payload, base_.data(), 4) == 0;
+    // 填充、DHEADER和末尾字节必须与基准相同，解码时直接沿用基准中的这些字节
+    for (size_t g = 0; delta && g < gaps_[encoding].size(); ++g) {
+        const auto& gap = gaps_[encoding][g];
+        delta = std::memcmp(payload + 4 + gap.first, base_.data() + 4 + gap.first, gap.second - gap.first) == 0;
+    }
+    const size_t tail = 4 + fixed_size_[encoding];
+    delta = delta && std::memcmp(payload + tail, base_.data() + tail, size - tail) == 0;
+    if (!delta || !Residuals(payload + 4, values_)) {
+        Rebase(payload, size);
+        return 0;
+    }
+
+    // 位图标出残差非0的字段，随后依次是这些残差的变长整数
+    const size_t bitmap = (fields_.size() + 7) / 8;
+    std::memset(out, 0, bitmap);
+    size_t written = bitmap;
+    const uint8_t* data = payload + 4;
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        const Field& field = fields_[i];
+        const State& state = states_[i];
+        uint64_t residual = 0;
+        switch (field.mode) {
+        case Mode::kXor:
+            residual = Load(data + field.offsets[encoding], field.size, swap_) ^ state.value;
+            break;
+        case Mode::kInteger:
+            residual = ZigZag(SignExtend((values_[i] - state.value - static_cast<uint64_t>(state.delta)) &
+                                         Mask(field.size), field.size));
+            break;
+        case Mode::kQuantized:
+            residual = ZigZag(static_cast<int64_t>(values_[i]) - static_cast<int64_t>(state.value) - state.delta);
+            break;
+        }
+        if (residual == 0) {
+            continue;
+        }
+        out[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+        while (residual >= 0x80) {
+            out[written++] = static_cast<uint8_t>(residual | 0x80);
+            residual >>= 7;
+        }
+        out[written++] = static_cast<uint8_t>(residual);
+    }
+    if (written >= size) {
+        Rebase(payload, size);
+        return 0;
+    }
+    Apply(values_);
+    return written;
+}
+
+bool BridgeDeltaCodec::Residuals(const uint8_t* data, std::vector<uint64_t>& values) const {
+    const int encoding = xcdr2_ ? 1 : 0;
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        const Field& field = fields_[i];
+        const uint64_t bits = Load(data + field.offsets[encoding], field.size, swap_);
+        if (field.mode == Mode::kQuantized) {
+            int64_t quantized = 0;
+            if (!Quantize(ToDouble(bits, field.size), quantization_, quantized)) {
+                return false;
+            }
+            values[i] = static_cast<uint64_t>(quantized);
+        } else {
+            values[i] = bits;
+        }
+    }
+    return true;
+}
+
+bool BridgeDeltaCodec::Decode(const uint8_t* data, size_t size) {
+    const size_t bitmap = (fields_.size() + 7) / 8;
+    if (!has_base_ || size < bitmap) {
+        return false;
+    }
+    size_t cursor = bitmap;
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        uint64_t residual = 0;
+        if ((data[i / 8] >> (i % 8)) & 1) {
+            for (int shift = 0;; shift += 7) {
+                if (cursor >= size || shift > 63) {
+                    return false;
+                }
+                const uint8_t byte = data[cursor++];
+                residual |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0) {
+                    break;
+                }
+            }
+        }
+        const Field& field = fields_[i];
+        const State& state = states_[i];
+        switch (field.mode) {
+        case Mode::kXor:
+            values_[i] = state.value ^ residual;
+            break;
+        case Mode::kInteger:
+            values_[i] = (state.value + static_cast<uint64_t>(state.delta) + static_cast<uint64_t>(UnZigZag(residual))) &
+                         Mask(field.size);
+            break;
+        case Mode::kQuantized:
+            values_[i] = static_cast<uint64_t>(static_cast<int64_t>(state.value) + state.delta + UnZigZag(residual));
+            break;
+        }
+    }
+    if (cursor != size) {
+        return false;
+    }
+    Apply(values_);
+    return true;
+}
+
+void BridgeDeltaCodec::Apply(const std::vector<uint64_t>& values) {
+    uint8_t* data = base_.data() + 4;
+    const int encoding = xcdr2_ ? 1 : 0;
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        const Field& field = fields_[i];
+        State& state = states_[i];
+        uint64_t bits = values[i];
+        if (field.mode == Mode::kInteger) {
+            state.delta = SignExtend((values[i] - state.value) & Mask(field.size), field.size);
+        } else if (field.mode == Mode::kQuantized) {
+            state.delta = static_cast<int64_t>(values[i]) - static_cast<int64_t>(state.value);
+            bits = FromDouble(static_cast<double>(static_cast<int64_t>(values[i])) * quantization_, field.size);
+        }
+        state.value = values[i];
+        Store(data + field.offsets[encoding], field.size, swap_, bits);
+    }
+    ++run_;
+}
+
+} // namespace robot
+} // namespace yunji
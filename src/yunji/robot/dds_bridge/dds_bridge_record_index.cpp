@@ -0,0 +1,290 @@
+/**
+ * @file bridge_record_index.cpp
+ * @brief 录制索引实现文件
+ * @note 实现BridgeIndexBuilder与BridgeSegmentIndex类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_record_index.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+bool WriteAll(int fd, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        const ssize_t written = ::write(fd, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+size_t KeySlotIndex(uint16_t topic_id, uint64_t key, size_t mask) {
+    const uint64_t hash = (key ^ topic_id) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32)) & mask;
+}
+
+}
+
+std::string BridgeIndexPath(const std::string& segment_path) {
+    const size_t dot = segment_path.rfind('.');
+    const size_t slash = segment_path.rfind('/');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return segment_path + ".yjidx";
+    }
+    return segment_path.substr(0, dot) + ".yjidx";
+}
+
+void BridgeIndexBuilder::Reset(int64_t interval_ns, size_t topic_count, int64_t duration_ns) {
+    interval_ns_ = interval_ns;
+    topic_last_ns_.assign(topic_count, INT64_MIN);
+    time_entries_.clear();
+    key_entries_.clear();
+    if (interval_ns > 0 && duration_ns > 0) {
+        // 每个话题（键）在一个分段内至多duration/interval+1项，键数按上一分段估计
+        const size_t periods = static_cast<size_t>(duration_ns / interval_ns) + 2;
+        time_entries_.reserve(topic_count * periods);
+        key_entries_.reserve(key_count_ * periods);
+    }
+    std::fill(key_slots_.begin(), key_slots_.end(), KeySlot());
+    key_count_ = 0;
+}
+
+BridgeIndexBuilder::KeySlot& BridgeIndexBuilder::FindKey(uint16_t topic_id, uint64_t key) {
+    if (key_slots_.empty()) {
+        GrowKeys();
+    }
+    for (;;) {
+        const size_t mask = key_slots_.size() - 1;
+        size_t index = KeySlotIndex(topic_id, key, mask);
+        while (key_slots_[index].used && (key_slots_[index].key != key || key_slots_[index].topic_id != topic_id)) {
+            index = (index + 1) & mask;
+        }
+        if (key_slots_[index].used || (key_count_ + 1) * 2 <= key_slots_.size()) {
+            return key_slots_[index];
+        }
+        GrowKeys();
+    }
+}
+
+void BridgeIndexBuilder::GrowKeys() {
+    constexpr size_t kMinKeySlots = 256;
+    std::vector<KeySlot> slots(std::max(kMinKeySlots, key_slots_.size() * 2));
+    slots.swap(key_slots_);
+    const size_t mask = key_slots_.size() - 1;
+    for (const KeySlot& slot : slots) {
+        if (!slot.used) {
+            continue;
+        }
+        size_t index = KeySlotIndex(slot.topic_id, slot.key, mask);
+        while (key_slots_[index].used) {
+            index = (index + 1) & mask;
+        }
+        key_slots_[index] = slot;
+    }
+}
+
+bool BridgeIndexBuilder::Add(uint16_t topic_id, bool keyed, uint64_t key, int64_t receive_ns, uint64_t offset) {
+    if (topic_id >= topic_last_ns_.size()) {
+        topic_last_ns_.resize(topic_id + 1u, INT64_MIN);
+    }
+    bool added = false;
+    // 同一批样本共用receive_ns，间隔判断保证每个索引项指向该话题在该时刻的第一条记录
+    int64_t& topic_last = topic_last_ns_[topic_id];
+    if (topic_last == INT64_MIN || receive_ns - topic_last >= interval_ns_) {
+        topic_last = receive_ns;
+        time_entries_.push_back(BridgeTimeIndexEntry{topic_id, 0, 0, receive_ns, offset});
+        added = true;
+    }
+    if (!keyed) {
+        return added;
+    }
+    KeySlot& slot = FindKey(topic_id, key);
+    if (!slot.used) {
+        slot.key = key;
+        slot.topic_id = topic_id;
+        slot.used = true;
+        ++key_count_;
+    } else if (receive_ns - slot.last_ns < interval_ns_) {
+        return added;
+    }
+    slot.last_ns = receive_ns;
+    key_entries_.push_back(BridgeKeyIndexEntry{key, topic_id, 0, 0, receive_ns, offset});
+    return true;
+}
+
+bool BridgeIndexBuilder::Write(const std::string& path, const BridgeSegmentHeader& segment,
+                               uint64_t segment_bytes) {
+    // 各项按追加顺序（即时间顺序）已有序，稳定排序只需按话题/键分组
+    std::stable_sort(time_entries_.begin(), time_entries_.end(),
+                     [](const BridgeTimeIndexEntry& a, const BridgeTimeIndexEntry& b) { return a.topic_id < b.topic_id; });
+    std::stable_sort(key_entries_.begin(), key_entries_.end(),
+                     [](const BridgeKeyIndexEntry& a, const BridgeKeyIndexEntry& b) {
+                         return a.topic_id != b.topic_id ? a.topic_id < b.topic_id : a.key < b.key;
+                     });
+
+    BridgeIndexHeader header{};
+    header.magic = kBridgeIndexMagic;
+    header.version = kBridgeIndexVersion;
+    header.lane = segment.lane;
+    header.sequence = segment.sequence;
+    header.segment_bytes = segment_bytes;
+    header.interval_ns = interval_ns_;
+    header.time_entries = time_entries_.size();
+    header.key_entries = key_entries_.size();
+
+    const std::string temp = path + ".tmp";
+    const int fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "Index open " << temp << " failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    const bool ok = WriteAll(fd, &header, sizeof(header)) &&
+                    WriteAll(fd, time_entries_.data(), time_entries_.size() * sizeof(BridgeTimeIndexEntry)) &&
+                    WriteAll(fd, key_entries_.data(), key_entries_.size() * sizeof(BridgeKeyIndexEntry));
+    ::close(fd);
+    if (!ok || ::rename(temp.c_str(), path.c_str()) != 0) {
+        std::cerr << "Index write " << path << " failed: " << std::strerror(errno) << std::endl;
+        ::unlink(temp.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool BridgeIndexBuilder::Rebuild(const std::string& segment_path, int64_t interval_ns) {
+    BridgeSegmentReader reader;
+    if (!reader.Open(segment_path)) {
+        return false;
+    }
+    std::vector<bool> keyed;
+    for (const auto& topic : reader.Topics()) {
+        if (topic.id >= keyed.size()) {
+            keyed.resize(topic.id + 1u, false);
+        }
+        keyed[topic.id] = topic.type.keyed;
+    }
+    Reset(interval_ns, keyed.size());
+    // 崩溃留下的分段used_bytes可能落后于实际内容，扫描到零填充处为止，索引仍按分段头的used_bytes标记；
+    // 增量记录不能作为跳转起点，索引项只落在关键帧上
+    BridgeRecordedSample sample;
+    while (reader.Next(sample)) {
+        if (sample.delta) {
+            continue;
+        }
+        Add(sample.topic_id, sample.topic_id < keyed.size() && keyed[sample.topic_id], sample.key, sample.receive_ns,
+            sample.offset);
+    }
+    return Write(BridgeIndexPath(segment_path), reader.Header(), reader.Header().used_bytes);
+}
+
+BridgeSegmentIndex::~BridgeSegmentIndex() {
+    Close();
+}
+
+bool BridgeSegmentIndex::Open(const std::string& path, const BridgeSegmentHeader* segment) {
+    Close();
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(BridgeIndexHeader)) {
+        ::close(fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    base_ = static_cast<const uint8_t*>(base);
+    size_ = static_cast<size_t>(st.st_size);
+    header_ = reinterpret_cast<const BridgeIndexHeader*>(base_);
+    const bool valid = header_->magic == kBridgeIndexMagic && header_->version == kBridgeIndexVersion &&
+                       sizeof(BridgeIndexHeader) + header_->time_entries * sizeof(BridgeTimeIndexEntry) +
+                           header_->key_entries * sizeof(BridgeKeyIndexEntry) <= size_ &&
+                       (segment == nullptr || (segment->lane == header_->lane &&
+                                               segment->sequence == header_->sequence &&
+                                               segment->used_bytes == header_->segment_bytes));
+    if (!valid) {
+        Close();
+        return false;
+    }
+    time_entries_ = reinterpret_cast<const BridgeTimeIndexEntry*>(base_ + sizeof(BridgeIndexHeader));
+    key_entries_ = reinterpret_cast<const BridgeKeyIndexEntry*>(time_entries_ + header_->time_entries);
+    return true;
+}
+
+void BridgeSegmentIndex::Close() {
+    if (base_ != nullptr) {
+        ::munmap(const_cast<uint8_t*>(base_), size_);
+    }
+    base_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    time_entries_ = nullptr;
+    key_entries_ = nullptr;
+}
+
+bool BridgeSegmentIndex::SeekTime(uint16_t topic_id, int64_t time_ns, uint64_t& offset) const {
+    if (header_ == nullptr) {
+        return false;
+    }
+    const BridgeTimeIndexEntry* begin = time_entries_;
+    const BridgeTimeIndexEntry* end = time_entries_ + header_->time_entries;
+    const BridgeTimeIndexEntry* first = std::lower_bound(begin, end, topic_id,
+        [](const BridgeTimeIndexEntry& entry, uint16_t id) { return entry.topic_id < id; });
+    if (first == end || first->topic_id != topic_id) {
+        return false;
+    }
+    // 该话题内第一个晚于time_ns的项的前一项
+    const BridgeTimeIndexEntry* next = std::upper_bound(first, end, time_ns,
+        [topic_id](int64_t time, const BridgeTimeIndexEntry& entry) {
+            return entry.topic_id != topic_id || time < entry.receive_ns;
+        });
+    offset = (next == first ? first : next - 1)->offset;
+    return true;
+}
+
+bool BridgeSegmentIndex::SeekKey(uint16_t topic_id, uint64_t key, int64_t time_ns, uint64_t& offset) const {
+    if (header_ == nullptr) {
+        return false;
+    }
+    const BridgeKeyIndexEntry* begin = key_entries_;
+    const BridgeKeyIndexEntry* end = key_entries_ + header_->key_entries;
+    const BridgeKeyIndexEntry* first = std::lower_bound(begin, end, std::make_pair(topic_id, key),
+        [](const BridgeKeyIndexEntry& entry, const std::pair<uint16_t, uint64_t>& target) {
+            return entry.topic_id != target.first ? entry.topic_id < target.first : entry.key < target.second;
+        });
+    if (first == end || first->topic_id != topic_id || first->key != key) {
+        return false;
+    }
+    const BridgeKeyIndexEntry* next = std::upper_bound(first, end, time_ns,
+        [topic_id, key](int64_t time, const BridgeKeyIndexEntry& entry) {
+            return entry.topic_id != topic_id || entry.key != key || time < entry.receive_ns;
+        });
+    offset = (next == first ? first : next - 1)->offset;
+    return true;
+}
+
+} // namespace robot
+} // namespace yunji
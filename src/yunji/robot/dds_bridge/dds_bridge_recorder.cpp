@@ -0,0 +1,658 @@
+/**
+ * @file bridge_recorder.cpp
+ * @brief 话题录制实现文件
+ * @note 实现BridgeRecorder与BridgeSegmentReader类的具体功能，录制时同步建立稀疏索引
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_record_index.hpp"
+
+#include <dds/ddsi/ddsi_serdata.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+namespace
+{
+
+constexpr uint32_t kTakeBatch = 64;
+
+size_t AlignRecord(size_t size) {
+    return (size + kBridgeRecordAlignment - 1) & ~(kBridgeRecordAlignment - 1);
+}
+
+size_t TopicRecordSize(const std::string& name, const BridgeTypeDescriptor& type, bool delta) {
+    return sizeof(BridgeTopicRecordHeader) + name.size() + type.type_name.size() + type.type_map.size() +
+           type.type_info.size() + (delta ? sizeof(double) : 0);
+}
+
+}
+
+struct BridgeRecorder::Topic {
+    uint16_t id = 0;
+    std::string name;
+    BridgeTypeDescriptor type;
+    dds_entity_t topic_entity = 0;
+    std::shared_ptr<void> keepalive;        // ddscxx话题对象，持有期间话题实体有效
+    dds_entity_t reader = 0;
+    std::unique_ptr<BridgeDeltaCodec> codec;    // 增量编码状态，只由所属通道线程访问；原样录制时为nullptr
+};
+
+/**
+ * @brief 写入通道：一个线程、一组话题和当前分段，分段状态只由本通道线程访问
+ */
+struct BridgeRecorder::Lane {
+    uint32_t index = 0;
+    std::vector<Topic*> topics;
+    dds_entity_t waitset = 0;
+    std::thread thread;
+
+    std::array<ddsi_serdata*, kTakeBatch> serdata{};
+    std::array<dds_sample_info_t, kTakeBatch> infos{};
+
+    int fd = -1;
+    std::string path;
+    uint8_t* base = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+    size_t flushed = 0;             // 已下发回写的位置
+    uint32_t sequence = 0;
+    int64_t opened_ns = 0;
+    int64_t last_receive_ns = 0;
+    uint64_t records = 0;
+    int64_t retry_ns = 0;           // 创建分段失败后，到该时刻前不再重试，期间的样本计入errors
+    BridgeIndexBuilder indexer;     // 当前分段的索引，分段关闭时写出
+    std::vector<uint8_t> scratch;   // 增量编码前的原始样本
+};
+
+BridgeRecorder::BridgeRecorder(const BridgeRecorderOptions& options) : options_(options) {
+    if (options_.lanes == 0) {
+        options_.lanes = 1;
+    }
+}
+
+BridgeRecorder::~BridgeRecorder() {
+    Stop();
+    for (auto& topic : topics_) {
+        if (topic->reader > 0) {
+            dds_delete(topic->reader);
+        }
+    }
+    if (subscriber_ > 0) {
+        dds_delete(subscriber_);
+    }
+}
+
+bool BridgeRecorder::AddTopicEntity(const std::string& topic, BridgeTypeDescriptor type, dds_entity_t topic_entity,
+                                    std::shared_ptr<void> keepalive) {
+    if (running_.load(std::memory_order_acquire) || topics_.size() >= UINT16_MAX) {
+        return false;
+    }
+    for (const auto& existing : topics_) {
+        if (existing->name == topic) {
+            return false;
+        }
+    }
+    auto entry = std::make_unique<Topic>();
+    entry->id = static_cast<uint16_t>(topics_.size());
+    entry->name = topic;
+    entry->type = std::move(type);
+    entry->topic_entity = topic_entity;
+    entry->keepalive = std::move(keepalive);
+    if (options_.codec == BridgeRecordCodec::kDelta) {
+        entry->codec = std::make_unique<BridgeDeltaCodec>();
+        if (!entry->codec->Init(entry->type.type_map, entry->type.type_name, options_.quantization)) {
+            std::cerr << "Recorder topic " << topic << ": " << entry->type.type_name
+                      << " is not a fixed-size type, recorded without delta coding" << std::endl;
+            entry->codec.reset();
+        }
+    }
+    topics_.push_back(std::move(entry));
+    return true;
+}
+
+bool BridgeRecorder::Start() {
+    if (running_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    auto participant = BridgeFactory::Instance()->GetParticipant();
+    if (!participant || topics_.empty()) {
+        std::cerr << "Recorder start failed: no participant or no topics" << std::endl;
+        return false;
+    }
+    if (::mkdir(options_.directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Recorder start failed: mkdir " << options_.directory << ": " << std::strerror(errno)
+                  << std::endl;
+        return false;
+    }
+
+    dds_qos_t* qos = dds_create_qos();
+    if (options_.reliable) {
+        dds_qset_reliability(qos, DDS_RELIABILITY_RELIABLE, DDS_SECS(1));
+    } else {
+        dds_qset_reliability(qos, DDS_RELIABILITY_BEST_EFFORT, 0);
+    }
+    dds_qset_history(qos, DDS_HISTORY_KEEP_LAST, static_cast<int32_t>(options_.reader_depth));
+
+    const dds_entity_t participant_entity = participant->delegate()->get_ddsc_entity();
+    if (!options_.partitions.empty() && subscriber_ <= 0) {
+        std::vector<const char*> names;
+        for (const auto& partition : options_.partitions) {
+            names.push_back(partition.c_str());
+        }
+        dds_qos_t* subscriber_qos = dds_create_qos();
+        dds_qset_partition(subscriber_qos, static_cast<uint32_t>(names.size()), names.data());
+        subscriber_ = dds_create_subscriber(participant_entity, subscriber_qos, nullptr);
+        dds_delete_qos(subscriber_qos);
+    }
+    const dds_entity_t reader_parent = subscriber_ > 0 ? subscriber_ : participant_entity;
+    // 文件名带会话开始时间，重新Start()时分段序号从0开始也不会覆盖上一次录制的文件
+    session_ns_ = BridgeClock::Instance()->WallTime();
+    const time_t session_sec = static_cast<time_t>(session_ns_ / 1000000000LL);
+    struct tm session_tm{};
+    char session[32];
+    ::localtime_r(&session_sec, &session_tm);
+    std::strftime(session, sizeof(session), "%Y%m%d-%H%M%S", &session_tm);
+    session_ = session;
+
+    lanes_.clear();
+    const size_t lane_count = std::min(options_.lanes, topics_.size());
+    for (size_t i = 0; i < lane_count; ++i) {
+        lanes_.push_back(std::make_unique<Lane>());
+        lanes_.back()->index = static_cast<uint32_t>(i);
+    }
+    bool ok = true;
+    for (size_t i = 0; i < topics_.size() && ok; ++i) {
+        Topic& topic = *topics_[i];
+        Lane& lane = *lanes_[i % lane_count];
+        if (topic.reader <= 0) {
+            topic.reader = dds_create_reader(reader_parent, topic.topic_entity, qos, nullptr);
+        }
+        ok = topic.reader > 0;
+        lane.topics.push_back(&topic);
+    }
+    dds_delete_qos(qos);
+
+    for (auto& lane : lanes_) {
+        if (!ok) {
+            break;
+        }
+        lane->waitset = dds_create_waitset(participant_entity);
+        ok = lane->waitset > 0;
+        for (Topic* topic : lane->topics) {
+            ok = ok && dds_set_status_mask(topic->reader, DDS_DATA_AVAILABLE_STATUS) == 0 &&
+                 dds_waitset_attach(lane->waitset, topic->reader, topic->reader) == 0;
+        }
+    }
+    if (!ok) {
+        std::cerr << "Recorder start failed: reader or waitset creation failed" << std::endl;
+        for (auto& lane : lanes_) {
+            if (lane->waitset > 0) {
+                dds_delete(lane->waitset);
+            }
+        }
+        lanes_.clear();
+        return false;
+    }
+
+    running_.store(true, std::memory_order_release);
+    for (auto& lane : lanes_) {
+        Lane* raw = lane.get();
+        lane->thread = std::thread([this, raw]() { Run(*raw); });
+    }
+    return true;
+}
+
+void BridgeRecorder::Stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    for (auto& lane : lanes_) {
+        dds_waitset_set_trigger(lane->waitset, true);
+    }
+    for (auto& lane : lanes_) {
+        if (lane->thread.joinable()) {
+            lane->thread.join();
+        }
+        CloseSegment(*lane);
+        dds_delete(lane->waitset);
+    }
+    lanes_.clear();
+}
+
+BridgeRecorderStats BridgeRecorder::Stats() const {
+    BridgeRecorderStats stats;
+    stats.records = records_.load(std::memory_order_relaxed);
+    stats.bytes = bytes_.load(std::memory_order_relaxed);
+    stats.raw_bytes = raw_bytes_.load(std::memory_order_relaxed);
+    stats.segments = segments_.load(std::memory_order_relaxed);
+    stats.errors = errors_.load(std::memory_order_relaxed);
+    for (const auto& topic : topics_) {
+        dds_sample_lost_status_t lost;
+        if (topic->reader > 0 && dds_get_sample_lost_status(topic->reader, &lost) == 0) {
+            stats.lost += static_cast<uint64_t>(lost.total_count);
+        }
+    }
+    return stats;
+}
+
+void BridgeRecorder::Run(Lane& lane) {
+    const int64_t duration_ns = static_cast<int64_t>(options_.segment_duration.count()) * 1000000000LL;
+    while (running_.load(std::memory_order_acquire)) {
+        const dds_return_t triggered = dds_waitset_wait(lane.waitset, nullptr, 0, DDS_MSECS(100));
+        if (triggered < 0) {
+            std::cerr << "Recorder wait error: " << dds_strretcode(triggered) << std::endl;
+            break;
+        }
+        for (Topic* topic : lane.topics) {
+            while (Drain(lane, *topic) == kTakeBatch) {
+            }
+        }
+        if (lane.base != nullptr) {
+            BridgeSegmentHeader* header = reinterpret_cast<BridgeSegmentHeader*>(lane.base);
+            header->used_bytes = lane.used;
+            header->records = lane.records;
+            header->end_ns = lane.last_receive_ns;
+        }
+        // 按时间切分：到期后关闭当前分段，下一条样本到达时再创建新分段
+        if (lane.base != nullptr && duration_ns > 0 &&
+            BridgeClock::Instance()->WallTime() - lane.opened_ns >= duration_ns) {
+            CloseSegment(lane);
+        }
+    }
+    for (Topic* topic : lane.topics) {
+        while (Drain(lane, *topic) == kTakeBatch) {
+        }
+    }
+}
+
+size_t BridgeRecorder::Drain(Lane& lane, Topic& topic) {
+    const dds_return_t count = dds_takecdr(topic.reader, lane.serdata.data(), kTakeBatch, lane.infos.data(),
+                                           DDS_ANY_STATE);
+    if (count <= 0) {
+        return 0;
+    }
+    const int64_t receive_ns = BridgeClock::Instance()->WallTime();
+    for (dds_return_t i = 0; i < count; ++i) {
+        ddsi_serdata* serdata = lane.serdata[i];
+        if (lane.infos[i].valid_data) {
+            const uint32_t size = ddsi_serdata_size(serdata);
+            // 增量编码按最大编码长度预留，分段切换发生在编码之前，新分段的第一条样本总是关键帧
+            uint8_t* payload = Reserve(lane, topic.codec ? std::max<size_t>(size, topic.codec->MaxEncodedSize()) : size);
+            if (payload != nullptr) {
+                ddsi_keyhash_t keyhash;
+                ddsi_serdata_get_keyhash(serdata, &keyhash, false);
+                BridgeRecordHeader* header = reinterpret_cast<BridgeRecordHeader*>(payload - sizeof(BridgeRecordHeader));
+                header->size = size;
+                header->kind = static_cast<uint16_t>(BridgeRecordKind::kSample);
+                header->topic_id = topic.id;
+                header->source_ns = lane.infos[i].source_timestamp;
+                header->receive_ns = receive_ns;
+                header->key = BridgeRecordKey(keyhash);
+                // 新增索引项的记录必须能独立解码，作为关键帧
+                const bool indexed = options_.index_interval.count() > 0 &&
+                    lane.indexer.Add(topic.id, topic.type.keyed, header->key, receive_ns, lane.used);
+                if (topic.codec) {
+                    if (lane.scratch.size() < size) {
+                        lane.scratch.resize(size);
+                    }
+                    ddsi_serdata_to_ser(serdata, 0, size, lane.scratch.data());
+                    const size_t encoded = topic.codec->Encode(lane.scratch.data(), size, indexed, payload);
+                    if (encoded > 0) {
+                        header->size = static_cast<uint32_t>(encoded);
+                        header->kind = static_cast<uint16_t>(BridgeRecordKind::kDelta);
+                    } else {
+                        std::memcpy(payload, lane.scratch.data(), size);
+                    }
+                } else {
+                    ddsi_serdata_to_ser(serdata, 0, size, payload);
+                }
+                Commit(lane, header->size, size);
+                ++lane.records;
+                records_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                errors_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        ddsi_serdata_unref(serdata);
+    }
+    lane.last_receive_ns = receive_ns;
+    return static_cast<size_t>(count);
+}
+
+uint8_t* BridgeRecorder::Reserve(Lane& lane, size_t payload_size) {
+    const size_t total = AlignRecord(sizeof(BridgeRecordHeader) + payload_size);
+    if (lane.base == nullptr || lane.used + total > lane.capacity) {
+        CloseSegment(lane);
+        if (BridgeClock::Instance()->WallTime() < lane.retry_ns || !OpenSegment(lane, total)) {
+            return nullptr;
+        }
+    }
+    return lane.base + lane.used + sizeof(BridgeRecordHeader);
+}
+
+void BridgeRecorder::Commit(Lane& lane, size_t payload_size, size_t raw_size) {
+    const size_t total = AlignRecord(sizeof(BridgeRecordHeader) + payload_size);
+    lane.used += total;
+    bytes_.fetch_add(total, std::memory_order_relaxed);
+    raw_bytes_.fetch_add(AlignRecord(sizeof(BridgeRecordHeader) + raw_size), std::memory_order_relaxed);
+    if (options_.writeback_bytes > 0 && lane.used - lane.flushed >= options_.writeback_bytes) {
+        // 提前异步回写已写满的部分，避免脏页堆积后在munmap/内核回写时集中写卡
+        ::sync_file_range(lane.fd, static_cast<off64_t>(lane.flushed), static_cast<off64_t>(lane.used - lane.flushed),
+                          SYNC_FILE_RANGE_WRITE);
+        lane.flushed = lane.used;
+    }
+}
+
+bool BridgeRecorder::OpenSegment(Lane& lane, size_t min_bytes) {
+    size_t needed = sizeof(BridgeSegmentHeader) + min_bytes;
+    for (const Topic* topic : lane.topics) {
+        needed += AlignRecord(sizeof(BridgeRecordHeader) + TopicRecordSize(topic->name, topic->type, topic->codec != nullptr));
+    }
+    const size_t capacity = std::max(options_.segment_bytes, needed);
+
+    // 从不截断已有文件：同一秒内再次Start()时文件名相同，跳过已存在的序号
+    std::string path;
+    int fd = -1;
+    for (uint32_t attempt = 0; attempt < 1024; ++attempt) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "_%u_%06u.yjrec", lane.index, lane.sequence);
+        path = options_.directory + "/" + options_.prefix + "_" + session_ + name;
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd >= 0 || errno != EEXIST) {
+            break;
+        }
+        ++lane.sequence;
+    }
+    if (fd < 0) {
+        std::cerr << "Recorder open " << path << " failed: " << std::strerror(errno) << std::endl;
+        lane.retry_ns = BridgeClock::Instance()->WallTime() + 1000000000LL;
+        return false;
+    }
+    // 预分配整个分段：写满前不再触发块分配，空间不足时在这里失败而不是写入时SIGBUS
+    const int err = ::posix_fallocate(fd, 0, static_cast<off_t>(capacity));
+    void* base = err == 0 ? ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    if (base == MAP_FAILED) {
+        std::cerr << "Recorder segment " << path << " failed: " << std::strerror(err != 0 ? err : errno)
+                  << std::endl;
+        ::close(fd);
+        ::unlink(path.c_str());
+        lane.retry_ns = BridgeClock::Instance()->WallTime() + 1000000000LL;
+        return false;
+    }
+    ::madvise(base, capacity, MADV_SEQUENTIAL);
+
+    lane.fd = fd;
+    lane.path = path;
+    lane.base = static_cast<uint8_t*>(base);
+    lane.capacity = capacity;
+    lane.used = sizeof(BridgeSegmentHeader);
+    lane.flushed = 0;
+    lane.records = 0;
+    lane.opened_ns = BridgeClock::Instance()->WallTime();
+    lane.last_receive_ns = lane.opened_ns;
+    lane.indexer.Reset(static_cast<int64_t>(options_.index_interval.count()) * 1000000LL, topics_.size(),
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(options_.segment_duration).count());
+
+    BridgeSegmentHeader* header = reinterpret_cast<BridgeSegmentHeader*>(lane.base);
+    header->magic = kBridgeRecordMagic;
+    header->version = kBridgeRecordVersion;
+    header->lane = lane.index;
+    header->sequence = lane.sequence++;
+    header->start_ns = lane.opened_ns;
+    header->end_ns = lane.opened_ns;
+    header->session_ns = session_ns_;
+    for (Topic* topic : lane.topics) {
+        WriteTopicRecord(lane, *topic);
+        if (topic->codec) {
+            topic->codec->Reset();
+        }
+    }
+    header->used_bytes = lane.used;
+    segments_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void BridgeRecorder::WriteTopicRecord(Lane& lane, const Topic& topic) {
+    const size_t size = TopicRecordSize(topic.name, topic.type, topic.codec != nullptr);
+    uint8_t* cursor = lane.base + lane.used;
+    BridgeRecordHeader* header = reinterpret_cast<BridgeRecordHeader*>(cursor);
+    header->size = static_cast<uint32_t>(size);
+    header->kind = static_cast<uint16_t>(BridgeRecordKind::kTopic);
+    header->topic_id = topic.id;
+    header->source_ns = 0;
+    header->receive_ns = lane.opened_ns;
+    header->key = 0;
+    cursor += sizeof(BridgeRecordHeader);
+
+    BridgeTopicRecordHeader* info = reinterpret_cast<BridgeTopicRecordHeader*>(cursor);
+    info->type_hash = topic.type.type_hash;
+    info->name_size = static_cast<uint16_t>(topic.name.size());
+    info->type_name_size = static_cast<uint16_t>(topic.type.type_name.size());
+    info->type_map_size = static_cast<uint32_t>(topic.type.type_map.size());
+    info->type_info_size = static_cast<uint32_t>(topic.type.type_info.size());
+    info->flags = (topic.type.keyed ? kBridgeTopicKeyed : 0) | (topic.codec ? kBridgeTopicDelta : 0);
+    cursor += sizeof(BridgeTopicRecordHeader);
+    std::memcpy(cursor, topic.name.data(), topic.name.size());
+    cursor += topic.name.size();
+    std::memcpy(cursor, topic.type.type_name.data(), topic.type.type_name.size());
+    cursor += topic.type.type_name.size();
+    std::memcpy(cursor, topic.type.type_map.data(), topic.type.type_map.size());
+    cursor += topic.type.type_map.size();
+    std::memcpy(cursor, topic.type.type_info.data(), topic.type.type_info.size());
+    cursor += topic.type.type_info.size();
+    if (topic.codec) {
+        const double quantization = topic.codec->Quantization();
+        std::memcpy(cursor, &quantization, sizeof(quantization));
+    }
+    Commit(lane, size, size);
+}
+
+void BridgeRecorder::CloseSegment(Lane& lane) {
+    if (lane.base == nullptr) {
+        return;
+    }
+    BridgeSegmentHeader* header = reinterpret_cast<BridgeSegmentHeader*>(lane.base);
+    header->used_bytes = lane.used;
+    header->records = lane.records;
+    header->end_ns = lane.last_receive_ns;
+    const BridgeSegmentHeader closed = *header;
+    ::msync(lane.base, lane.used, MS_ASYNC);
+    ::munmap(lane.base, lane.capacity);
+    // 截掉未使用的预分配空间，读取端按used_bytes或文件长度都能得到同样的结果
+    if (::ftruncate(lane.fd, static_cast<off_t>(lane.used)) != 0) {
+        std::cerr << "Recorder truncate failed: " << std::strerror(errno) << std::endl;
+    }
+    ::close(lane.fd);
+    lane.fd = -1;
+    lane.base = nullptr;
+    lane.capacity = 0;
+    // 索引只有稀疏项，写出量与分段大小相比可忽略
+    if (options_.index_interval.count() > 0) {
+        lane.indexer.Write(BridgeIndexPath(lane.path), closed, closed.used_bytes);
+    }
+}
+
+BridgeSegmentReader::~BridgeSegmentReader() {
+    Close();
+}
+
+bool BridgeSegmentReader::Open(const std::string& path) {
+    Close();
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(BridgeSegmentHeader)) {
+        ::close(fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    base_ = static_cast<const uint8_t*>(base);
+    size_ = static_cast<size_t>(st.st_size);
+    header_ = reinterpret_cast<const BridgeSegmentHeader*>(base_);
+    if (header_->magic != kBridgeRecordMagic || header_->version < kBridgeRecordMinVersion ||
+        header_->version > kBridgeRecordVersion) {
+        Close();
+        return false;
+    }
+    ::madvise(base, size_, MADV_SEQUENTIAL);
+    // 话题记录都在分段开头，先登记下来，按索引Seek()后也能通过FindTopic()解析样本
+    const BridgeRecordHeader* record = nullptr;
+    uint64_t offset = sizeof(BridgeSegmentHeader);
+    while (ParseRecord(offset, record) && record->kind == static_cast<uint16_t>(BridgeRecordKind::kTopic)) {
+        AddTopicRecord(*record, base_ + offset + sizeof(BridgeRecordHeader));
+        offset += AlignRecord(sizeof(BridgeRecordHeader) + record->size);
+    }
+    Rewind();
+    return true;
+}
+
+void BridgeSegmentReader::Close() {
+    if (base_ != nullptr) {
+        ::munmap(const_cast<uint8_t*>(base_), size_);
+    }
+    base_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    cursor_ = 0;
+    topics_.clear();
+    codecs_.clear();
+}
+
+void BridgeSegmentReader::Seek(uint64_t offset) {
+    cursor_ = offset;
+    for (auto& codec : codecs_) {
+        if (codec) {
+            codec->Reset();
+        }
+    }
+}
+
+bool BridgeSegmentReader::ParseRecord(uint64_t offset, const BridgeRecordHeader*& header) const {
+    if (base_ == nullptr || offset + sizeof(BridgeRecordHeader) > size_) {
+        return false;
+    }
+    header = reinterpret_cast<const BridgeRecordHeader*>(base_ + offset);
+    return header->kind != static_cast<uint16_t>(BridgeRecordKind::kEnd) &&
+           offset + sizeof(BridgeRecordHeader) + header->size <= size_;
+}
+
+bool BridgeSegmentReader::Next(BridgeRecordedSample& sample) {
+    const BridgeRecordHeader* header = nullptr;
+    while (ParseRecord(cursor_, header)) {
+        const uint64_t offset = cursor_;
+        cursor_ += AlignRecord(sizeof(BridgeRecordHeader) + header->size);
+        BridgeDeltaCodec* codec = header->topic_id < codecs_.size() ? codecs_[header->topic_id].get() : nullptr;
+        if (header->kind == static_cast<uint16_t>(BridgeRecordKind::kSample)) {
+            FillSample(offset, *header, sample);
+            if (codec != nullptr) {
+                codec->SetBase(sample.payload, sample.size);
+            }
+            return true;
+        }
+        if (header->kind == static_cast<uint16_t>(BridgeRecordKind::kDelta)) {
+            if (codec == nullptr || !codec->Decode(base_ + offset + sizeof(BridgeRecordHeader), header->size)) {
+                continue;
+            }
+            FillSample(offset, *header, sample);
+            sample.payload = codec->Base().data();
+            sample.size = static_cast<uint32_t>(codec->Base().size());
+            sample.delta = true;
+            return true;
+        }
+        if (header->kind == static_cast<uint16_t>(BridgeRecordKind::kTopic)) {
+            AddTopicRecord(*header, base_ + offset + sizeof(BridgeRecordHeader));
+        }
+    }
+    return false;
+}
+
+bool BridgeSegmentReader::ReadAt(uint64_t offset, BridgeRecordedSample& sample) const {
+    const BridgeRecordHeader* header = nullptr;
+    if (!ParseRecord(offset, header) || header->kind != static_cast<uint16_t>(BridgeRecordKind::kSample)) {
+        return false;
+    }
+    FillSample(offset, *header, sample);
+    return true;
+}
+
+void BridgeSegmentReader::FillSample(uint64_t offset, const BridgeRecordHeader& header,
+                                     BridgeRecordedSample& sample) const {
+    sample.topic_id = header.topic_id;
+    sample.source_ns = header.source_ns;
+    sample.receive_ns = header.receive_ns;
+    sample.key = header.key;
+    sample.payload = base_ + offset + sizeof(BridgeRecordHeader);
+    sample.size = header.size;
+    sample.stored_size = header.size;
+    sample.delta = false;
+    sample.offset = offset;
+}
+
+void BridgeSegmentReader::AddTopicRecord(const BridgeRecordHeader& header, const uint8_t* payload) {
+    if (header.size < sizeof(BridgeTopicRecordHeader) || FindTopic(header.topic_id) != nullptr) {
+        return;
+    }
+    const BridgeTopicRecordHeader* info = reinterpret_cast<const BridgeTopicRecordHeader*>(payload);
+    const bool delta = (info->flags & kBridgeTopicDelta) != 0;
+    if (sizeof(BridgeTopicRecordHeader) + info->name_size + info->type_name_size + info->type_map_size +
+            info->type_info_size + (delta ? sizeof(double) : 0) > header.size) {
+        return;
+    }
+    const uint8_t* cursor = payload + sizeof(BridgeTopicRecordHeader);
+    BridgeRecordedTopic topic;
+    topic.id = header.topic_id;
+    topic.name.assign(reinterpret_cast<const char*>(cursor), info->name_size);
+    cursor += info->name_size;
+    topic.type.type_name.assign(reinterpret_cast<const char*>(cursor), info->type_name_size);
+    cursor += info->type_name_size;
+    topic.type.type_map.assign(cursor, cursor + info->type_map_size);
+    cursor += info->type_map_size;
+    topic.type.type_info.assign(cursor, cursor + info->type_info_size);
+    cursor += info->type_info_size;
+    topic.type.type_hash = info->type_hash;
+    topic.type.keyed = (info->flags & kBridgeTopicKeyed) != 0;
+    if (delta) {
+        topic.codec = BridgeRecordCodec::kDelta;
+        std::memcpy(&topic.quantization, cursor, sizeof(topic.quantization));
+        // 解码器无法建立时（type_map缺失）该话题的增量记录被跳过，关键帧仍可读出
+        if (topic.id >= codecs_.size()) {
+            codecs_.resize(topic.id + 1u);
+        }
+        codecs_[topic.id] = std::make_unique<BridgeDeltaCodec>();
+        if (!codecs_[topic.id]->Init(topic.type.type_map, topic.type.type_name, topic.quantization)) {
+            codecs_[topic.id].reset();
+        }
+    }
+    topics_.push_back(std::move(topic));
+}
+
+const BridgeRecordedTopic* BridgeSegmentReader::FindTopic(uint16_t id) const {
+    for (const auto& topic : topics_) {
+        if (topic.id == id) {
+            return &topic;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,279 @@
+/**
+ * @file bridge_replay.cpp
+ * @brief 录制回放实现文件
+ * @note 实现BridgeReplayer类的分段归并、节奏控制与步进回放
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_replay.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_record_index.hpp"
+
+#include <dds/ddsi/ddsi_serdata.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <tuple>
+
+namespace yunji {
+namespace robot {
+
+struct BridgeReplayer::Writer {
+    std::string recorded_topic;
+    BridgeTypeDescriptor type;
+    dds_entity_t writer = 0;
+    ddsi_sertype* sertype = nullptr;        // 由话题持有，keepalive期间有效
+    std::shared_ptr<void> keepalive;
+};
+
+/**
+ * @brief 一个录制通道的分段序列及其读取位置
+ */
+struct BridgeReplayer::Lane {
+    uint32_t index = 0;
+    std::vector<std::string> paths;         // 按分段序号排序
+    size_t next_path = 0;
+    BridgeSegmentReader reader;
+    std::vector<Writer*> writers;           // 当前分段的话题id到写者，未添加的话题为nullptr
+    BridgeRecordedSample sample;
+    bool valid = false;                     // sample为待发布的样本
+};
+
+BridgeReplayer::BridgeReplayer(const BridgeReplayOptions& options) : options_(options) {}
+
+BridgeReplayer::~BridgeReplayer() {
+    Stop();
+}
+
+bool BridgeReplayer::AddWriter(const std::string& recorded_topic, BridgeTypeDescriptor type, dds_entity_t writer,
+                               ddsi_sertype* sertype, std::shared_ptr<void> keepalive) {
+    for (const auto& existing : writers_) {
+        if (existing->recorded_topic == recorded_topic) {
+            return false;
+        }
+    }
+    auto entry = std::make_unique<Writer>();
+    entry->recorded_topic = recorded_topic;
+    entry->type = std::move(type);
+    entry->writer = writer;
+    entry->sertype = sertype;
+    entry->keepalive = std::move(keepalive);
+    writers_.push_back(std::move(entry));
+    return true;
+}
+
+BridgeReplayStats BridgeReplayer::Stats() const {
+    BridgeReplayStats stats;
+    stats.samples = samples_.load(std::memory_order_relaxed);
+    stats.bytes = bytes_.load(std::memory_order_relaxed);
+    stats.skipped = skipped_.load(std::memory_order_relaxed);
+    stats.errors = errors_.load(std::memory_order_relaxed);
+    stats.recording_ns = recording_ns_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool BridgeReplayer::Run(const std::vector<std::string>& segments) {
+    stop_.store(false, std::memory_order_release);
+
+    // 按通道分组，通道内按会话、分段创建时刻、分段序号排序：多次录制的同号分段依次回放而不是互相覆盖
+    using SegmentKey = std::tuple<int64_t, int64_t, uint32_t>;
+    std::map<uint32_t, std::map<SegmentKey, std::string>> grouped;
+    for (const auto& path : segments) {
+        BridgeSegmentReader probe;
+        if (!probe.Open(path)) {
+            std::cerr << "Replay skip " << path << ": not a segment file" << std::endl;
+            continue;
+        }
+        const BridgeSegmentHeader& header = probe.Header();
+        const SegmentKey key(header.session_ns, header.start_ns, header.sequence);
+        auto inserted = grouped[header.lane].emplace(key, path);
+        if (!inserted.second) {
+            std::cerr << "Replay skip " << path << ": same segment as " << inserted.first->second << std::endl;
+            errors_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    std::vector<std::unique_ptr<Lane>> lanes;
+    for (const auto& group : grouped) {
+        auto lane = std::make_unique<Lane>();
+        lane->index = group.first;
+        for (const auto& segment : group.second) {
+            lane->paths.push_back(segment.second);
+        }
+        if (Advance(*lane)) {
+            lanes.push_back(std::move(lane));
+        }
+    }
+    if (lanes.empty()) {
+        std::cerr << "Replay failed: no samples to replay" << std::endl;
+        return false;
+    }
+
+    first_ns_ = INT64_MAX;
+    for (const auto& lane : lanes) {
+        first_ns_ = std::min(first_ns_, lane->sample.receive_ns);
+    }
+    wall_start_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    BridgeExecutor* executor = options_.executor && options_.executor->IsStepping() ? options_.executor.get() : nullptr;
+    BridgeClock* clock = BridgeClock::Instance();
+    if (executor != nullptr) {
+        // 仿真时间线即录制时的接收时刻，录制开始前的空白直接跳过
+        if (!clock->IsSimulated()) {
+            clock->UseSimulatedTime(first_ns_);
+        } else if (clock->Now() < first_ns_) {
+            clock->Set(first_ns_);
+        }
+    }
+
+    int64_t batch_ns = INT64_MIN;
+    while (!stop_.load(std::memory_order_acquire)) {
+        // 归并：接收时刻最早者优先，相同时按通道号（lanes按通道号有序，取第一个最小值）
+        Lane* next = nullptr;
+        for (const auto& lane : lanes) {
+            if (lane->valid && (next == nullptr || lane->sample.receive_ns < next->sample.receive_ns)) {
+                next = lane.get();
+            }
+        }
+        if (next == nullptr || (options_.end_ns > 0 && next->sample.receive_ns >= options_.end_ns)) {
+            break;
+        }
+        const int64_t receive_ns = next->sample.receive_ns;
+        if (receive_ns != batch_ns) {
+            if (executor != nullptr) {
+                // 上一批样本交给被测回调处理完，再把时钟推进到这一批（期间到期的定时器按截止时刻触发）
+                executor->SpinUntilIdle();
+                const int64_t now = clock->Now();
+                if (receive_ns > now) {
+                    executor->Step(std::chrono::nanoseconds(receive_ns - now));
+                }
+            } else if (options_.rate > 0.0) {
+                WaitUntil(receive_ns);
+            }
+            batch_ns = receive_ns;
+            recording_ns_.store(receive_ns - first_ns_, std::memory_order_relaxed);
+        }
+        Publish(*next);
+        Advance(*next);
+    }
+    if (executor != nullptr) {
+        executor->SpinUntilIdle();
+    }
+    return true;
+}
+
+bool BridgeReplayer::OpenNext(Lane& lane) {
+    while (lane.next_path < lane.paths.size()) {
+        const std::string& path = lane.paths[lane.next_path++];
+        if (!lane.reader.Open(path)) {
+            std::cerr << "Replay skip " << path << ": open failed" << std::endl;
+            continue;
+        }
+        const BridgeSegmentHeader& header = lane.reader.Header();
+        if (options_.start_ns > 0 && header.end_ns < options_.start_ns) {
+            continue;       // 整个分段都在起始时刻之前
+        }
+
+        lane.writers.clear();
+        for (const auto& topic : lane.reader.Topics()) {
+            Writer* writer = nullptr;
+            for (const auto& candidate : writers_) {
+                if (candidate->recorded_topic == topic.name) {
+                    writer = candidate.get();
+                    break;
+                }
+            }
+            if (writer != nullptr && (writer->type.type_name != topic.type.type_name ||
+                                      writer->type.type_hash != topic.type.type_hash)) {
+                std::cerr << "Replay skip topic " << topic.name << " in " << path << ": recorded as "
+                          << topic.type.type_name << ", type differs from " << writer->type.type_name << std::endl;
+                writer = nullptr;
+            }
+            if (topic.id >= lane.writers.size()) {
+                lane.writers.resize(topic.id + 1u, nullptr);
+            }
+            lane.writers[topic.id] = writer;
+        }
+
+        if (options_.start_ns > 0 && header.start_ns < options_.start_ns) {
+            // 有索引时跳到各话题在起始时刻之前最近的索引项中最早的一个，之后最多顺序跳过一个索引间隔
+            BridgeSegmentIndex index;
+            if (index.Open(BridgeIndexPath(path), &header)) {
+                uint64_t earliest = UINT64_MAX;
+                for (const auto& topic : lane.reader.Topics()) {
+                    uint64_t offset = 0;
+                    if (index.SeekTime(topic.id, options_.start_ns, offset)) {
+                        earliest = std::min(earliest, offset);
+                    }
+                }
+                if (earliest != UINT64_MAX) {
+                    lane.reader.Seek(earliest);
+                }
+            }
+        }
+        return true;
+    }
+    lane.reader.Close();
+    return false;
+}
+
+bool BridgeReplayer::Advance(Lane& lane) {
+    for (;;) {
+        if (lane.reader.Next(lane.sample)) {
+            if (options_.start_ns > 0 && lane.sample.receive_ns < options_.start_ns) {
+                continue;
+            }
+            lane.valid = true;
+            return true;
+        }
+        if (!OpenNext(lane)) {
+            lane.valid = false;
+            return false;
+        }
+    }
+}
+
+void BridgeReplayer::Publish(Lane& lane) {
+    const BridgeRecordedSample& sample = lane.sample;
+    Writer* writer = sample.topic_id < lane.writers.size() ? lane.writers[sample.topic_id] : nullptr;
+    if (writer == nullptr) {
+        skipped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ddsrt_iovec_t iov;
+    iov.iov_base = const_cast<uint8_t*>(sample.payload);
+    iov.iov_len = static_cast<ddsrt_iov_len_t>(sample.size);
+    ddsi_serdata* serdata = ddsi_serdata_from_ser_iov(writer->sertype, SDK_DATA, 1, &iov, sample.size);
+    if (serdata == nullptr) {
+        errors_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    serdata->statusinfo = 0;
+    serdata->timestamp.v = options_.timestamps == BridgeReplayTimestamps::kRewrite
+        ? BridgeClock::Instance()->WallTime() : sample.source_ns;
+    // dds_forwardcdr按原样使用serdata中的时间戳，并接管serdata的引用
+    const dds_return_t ret = dds_forwardcdr(writer->writer, serdata);
+    if (ret < 0) {
+        errors_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    samples_.fetch_add(1, std::memory_order_relaxed);
+    bytes_.fetch_add(sample.size, std::memory_order_relaxed);
+}
+
+void BridgeReplayer::WaitUntil(int64_t recording_ns) {
+    const int64_t due = wall_start_ns_ +
+        static_cast<int64_t>(static_cast<double>(recording_ns - first_ns_) / options_.rate);
+    for (;;) {
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (now >= due || stop_.load(std::memory_order_acquire)) {
+            return;
+        }
+        // 分段睡眠，长间隔期间也能及时响应Stop()
+        std::this_thread::sleep_for(std::chrono::nanoseconds(std::min<int64_t>(due - now, 100000000LL)));
+    }
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,287 @@
+/**
+ * @file bridge_time_sync.cpp
+ * @brief 时钟同步服务实现文件
+ * @note 实现BridgeTimeSync类的请求/应答交换、最小RTT滤波与漂移拟合
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_time_sync.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_publisher.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_subscriber.hpp"
+#include "yunji/idl/TimeSync.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+namespace yunji {
+namespace robot {
+
+/**
+ * @brief 请求/应答端点，读者声明在写者之后，析构时先停止回调再销毁写者
+ */
+struct BridgeTimeSync::Endpoints {
+    explicit Endpoints(const BridgeTimeSyncOptions& options)
+        : request_writer(options.request_topic), reply_writer(options.reply_topic),
+          request_reader(options.request_topic), reply_reader(options.reply_topic) {}
+
+    BridgePublisher<TimeSync::Ping> request_writer;
+    BridgePublisher<TimeSync::Ping> reply_writer;
+    std::mutex reply_mutex;
+    BridgeSubscriber<TimeSync::Ping> request_reader;
+    BridgeSubscriber<TimeSync::Ping> reply_reader;
+};
+
+BridgeTimeSync::BridgeTimeSync() = default;
+
+BridgeTimeSync::~BridgeTimeSync() {
+    Stop();
+}
+
+bool BridgeTimeSync::Start(const BridgeTimeSyncOptions& options) {
+    std::lock_guard<std::mutex> lock(thread_mutex_);
+    if (running_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    auto participant = BridgeFactory::Instance()->GetParticipant();
+    if (!participant) {
+        std::cerr << "TimeSync start failed: BridgeFactory not initialized" << std::endl;
+        return false;
+    }
+    dds_guid_t guid;
+    if (dds_get_guid(participant->delegate()->get_ddsc_entity(), &guid) < 0) {
+        std::cerr << "TimeSync start failed: participant guid unavailable" << std::endl;
+        return false;
+    }
+
+    options_ = options;
+    options_.window = std::max<size_t>(options_.window, 1);
+    options_.drift_history = std::max<size_t>(options_.drift_history, 2);
+    std::memcpy(local_guid_.data(), guid.v, local_guid_.size());
+    node_id_ = static_cast<int32_t>(std::random_device()() & 0x7fffffff);
+    {
+        std::lock_guard<std::mutex> peers_lock(mutex_);
+        peers_.clear();
+    }
+    publications_.clear();
+    PendingPublication stale;
+    while (pending_.TryPop(stale)) {
+    }
+    std::atomic_store(&offsets_, std::make_shared<const BridgePublicationOffsets>());
+
+    // 尽力而为且只保留最新值：过期的时间戳没有意义，丢失的交换由下一周期补上
+    auto endpoints = std::make_unique<Endpoints>(options_);
+    endpoints->request_writer.SetQosPreset(BridgeQosPreset::kControl);
+    endpoints->reply_writer.SetQosPreset(BridgeQosPreset::kControl);
+    endpoints->request_reader.SetQosPreset(BridgeQosPreset::kControl);
+    endpoints->reply_reader.SetQosPreset(BridgeQosPreset::kControl);
+    Endpoints* raw = endpoints.get();
+    if (!endpoints->request_writer.InitBridge() || !endpoints->reply_writer.InitBridge() ||
+        !endpoints->request_reader.InitBridge([this, raw](const TimeSync::Ping& msg) { OnRequest(*raw, msg); }) ||
+        !endpoints->reply_reader.InitBridge([this](const TimeSync::Ping& msg) { OnReply(msg); })) {
+        return false;
+    }
+    endpoints_ = std::move(endpoints);
+
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&BridgeTimeSync::Run, this);
+    return true;
+}
+
+void BridgeTimeSync::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(thread_mutex_);
+        running_.store(false, std::memory_order_release);
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    std::atomic_store(&offsets_, BridgePublicationOffsetsPtr());
+    endpoints_.reset();
+}
+
+void BridgeTimeSync::Run() {
+    TimeSync::Ping request;
+    request.id(node_id_);
+    uint64_t sequence = 0;
+    std::unique_lock<std::mutex> lock(thread_mutex_);
+    auto deadline = std::chrono::steady_clock::now();
+    while (running_.load(std::memory_order_acquire)) {
+        request.sequence_frame(++sequence);
+        request.timestamp(static_cast<uint64_t>(BridgeClock::Instance()->WallTime()));
+        endpoints_->request_writer.Write(request);
+        PublishOffsets();
+        deadline += options_.interval;
+        if (cv_.wait_until(lock, deadline, [this]() { return !running_.load(std::memory_order_acquire); })) {
+            break;
+        }
+    }
+}
+
+void BridgeTimeSync::OnRequest(Endpoints& endpoints, const TimeSync::Ping& request) {
+    if (request.id() == node_id_) {
+        return;     // 本进程的请求
+    }
+    TimeSync::Ping reply(request);
+    reply.receive_time(static_cast<uint64_t>(BridgeClock::Instance()->WallTime()));
+    reply.responder(local_guid_);
+    std::lock_guard<std::mutex> lock(endpoints.reply_mutex);      // 等待线程与执行器线程可能并发应答
+    reply.transmit_time(static_cast<uint64_t>(BridgeClock::Instance()->WallTime()));
+    endpoints.reply_writer.Write(reply);
+}
+
+void BridgeTimeSync::OnReply(const TimeSync::Ping& reply) {
+    const int64_t t4 = BridgeClock::Instance()->WallTime();
+    if (reply.id() != node_id_ || reply.responder() == local_guid_) {
+        return;
+    }
+    const int64_t t1 = static_cast<int64_t>(reply.timestamp());
+    const int64_t t2 = static_cast<int64_t>(reply.receive_time());
+    const int64_t t3 = static_cast<int64_t>(reply.transmit_time());
+    Exchange exchange;
+    exchange.rtt_ns = (t4 - t1) - (t3 - t2);
+    if (exchange.rtt_ns < 0 || t3 < t2) {
+        return;     // 任一端时钟在交换期间被调整
+    }
+    exchange.offset_ns = ((t2 - t1) + (t3 - t4)) / 2;
+    exchange.local_ns = t1 + (t4 - t1) / 2;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Peer& peer = peers_[reply.responder()];
+    peer.last_reply_ns = t4;
+    UpdatePeer(peer, exchange);
+}
+
+void BridgeTimeSync::UpdatePeer(Peer& peer, const Exchange& exchange) const {
+    if (peer.window.size() < options_.window) {
+        peer.window.push_back(exchange);
+    } else {
+        peer.window[peer.next] = exchange;
+        peer.next = (peer.next + 1) % options_.window;
+    }
+    const Exchange& best = *std::min_element(peer.window.begin(), peer.window.end(),
+                                             [](const Exchange& a, const Exchange& b) { return a.rtt_ns < b.rtt_ns; });
+
+    BridgeClockEstimate& estimate = peer.estimate;
+    ++estimate.exchanges;
+    if (!peer.history.empty() && peer.history.back().local_ns == best.local_ns) {
+        return;     // 最小RTT样本未变，估计不变
+    }
+    if (peer.history.size() == options_.drift_history) {
+        peer.history.erase(peer.history.begin());
+    }
+    peer.history.push_back(best);
+
+    estimate.valid = true;
+    estimate.offset_ns = best.offset_ns;
+    estimate.rtt_ns = best.rtt_ns;
+    estimate.reference_ns = best.local_ns;
+
+    // 以首个点为原点做最小二乘，避免纳秒级纪元时间平方后丢失精度
+    const int64_t span = peer.history.back().local_ns - peer.history.front().local_ns;
+    if (peer.history.size() < 4 || span < options_.min_drift_span.count() * 1000000LL) {
+        return;
+    }
+    const Exchange& origin = peer.history.front();
+    const double n = static_cast<double>(peer.history.size());
+    double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+    for (const auto& point : peer.history) {
+        const double x = static_cast<double>(point.local_ns - origin.local_ns);
+        const double y = static_cast<double>(point.offset_ns - origin.offset_ns);
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+    const double denominator = n * sum_xx - sum_x * sum_x;
+    if (denominator > 0.0) {
+        estimate.drift_ppm = (n * sum_xy - sum_x * sum_y) / denominator * 1e6;
+    }
+}
+
+bool BridgeTimeSync::IsFresh(const Peer& peer, int64_t now_ns) const {
+    return peer.estimate.valid && now_ns - peer.last_reply_ns <= options_.peer_timeout.count() * 1000000LL;
+}
+
+std::vector<BridgeClockEstimate> BridgeTimeSync::Estimates() const {
+    const int64_t now = BridgeClock::Instance()->WallTime();
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<BridgeClockEstimate> estimates;
+    estimates.reserve(peers_.size());
+    for (const auto& entry : peers_) {
+        BridgeClockEstimate estimate = entry.second.estimate;
+        estimate.peer = entry.first;
+        estimate.valid = IsFresh(entry.second, now);
+        estimates.push_back(estimate);
+    }
+    return estimates;
+}
+
+bool BridgeTimeSync::Estimate(const BridgeParticipantGuid& peer, BridgeClockEstimate& estimate) const {
+    const int64_t now = BridgeClock::Instance()->WallTime();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = peers_.find(peer);
+    if (it == peers_.end() || !IsFresh(it->second, now)) {
+        return false;
+    }
+    estimate = it->second.estimate;
+    estimate.peer = peer;
+    return true;
+}
+
+bool BridgeTimeSync::PublicationOffset(const BridgePublicationOffsets& offsets, dds_entity_t reader,
+                                       dds_instance_handle_t publication, int64_t local_ns, int64_t& offset_ns) {
+    if (offsets.Offset(publication, local_ns, offset_ns)) {
+        return true;
+    }
+    if (!offsets.Contains(publication)) {
+        PendingPublication pending;
+        pending.reader = reader;
+        pending.publication = publication;
+        pending_.TryPush(pending);      // 队列满时丢弃，该发布端的后续样本会再次登记
+    }
+    return false;
+}
+
+void BridgeTimeSync::PublishOffsets() {
+    // 解析订阅端登记的发布端，同一发布端可能被登记多次
+    PendingPublication pending;
+    while (pending_.TryPop(pending)) {
+        if (publications_.count(pending.publication) != 0) {
+            continue;
+        }
+        dds_builtintopic_endpoint_t* endpoint = dds_get_matched_publication_data(pending.reader, pending.publication);
+        if (endpoint == nullptr) {
+            continue;
+        }
+        BridgeParticipantGuid guid;
+        std::memcpy(guid.data(), endpoint->participant_key.v, guid.size());
+        dds_builtintopic_free_endpoint(endpoint);
+        publications_.emplace(pending.publication, guid);
+    }
+
+    auto offsets = std::make_shared<BridgePublicationOffsets>();
+    offsets->entries_.reserve(publications_.size());
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& publication : publications_) {
+            BridgePublicationOffsets::Entry entry;
+            entry.publication = publication.first;
+            auto peer = peers_.find(publication.second);
+            if (publication.second != local_guid_ && peer != peers_.end()) {
+                entry.estimate = peer->second.estimate;
+                entry.expires_ns = peer->second.last_reply_ns + options_.peer_timeout.count() * 1000000LL;
+            }
+            entry.estimate.peer = publication.second;
+            offsets->entries_.push_back(entry);
+        }
+    }
+    std::sort(offsets->entries_.begin(), offsets->entries_.end(),
+              [](const BridgePublicationOffsets::Entry& a, const BridgePublicationOffsets::Entry& b) {
+                  return a.publication < b.publication;
+              });
+    std::atomic_store(&offsets_, BridgePublicationOffsetsPtr(std::move(offsets)));
+}
+
+} // namespace robot
+} // namespace yunji
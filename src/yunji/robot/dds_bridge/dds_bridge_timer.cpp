@@ -0,0 +1,100 @@
+/**
+ * @file bridge_timer.cpp
+ * @brief 周期定时器实现文件
+ * @note 实现BridgeTimer类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_timer.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_clock.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_trace.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace yunji {
+namespace robot {
+
+BridgeTimer::BridgeTimer(std::chrono::nanoseconds period, Callback callback,
+                         const BridgeTimerOptions& options, int64_t first_deadline_ns)
+    : period_ns_(std::max<int64_t>(1, period.count())),
+      callback_(std::move(callback)),
+      options_(options),
+      next_deadline_ns_(first_deadline_ns) {}
+
+BridgeTimerStats BridgeTimer::Stats() const {
+    BridgeTimerStats stats;
+    stats.fired = fired_.load(std::memory_order_relaxed);
+    stats.overruns = overruns_.load(std::memory_order_relaxed);
+    stats.min_jitter_ns = min_jitter_ns_.load(std::memory_order_relaxed);
+    stats.max_jitter_ns = max_jitter_ns_.load(std::memory_order_relaxed);
+    if (stats.fired > 0) {
+        stats.mean_abs_jitter_ns =
+            static_cast<double>(sum_abs_jitter_ns_.load(std::memory_order_relaxed)) / stats.fired;
+    }
+    stats.max_callback_ns = max_callback_ns_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t BridgeTimer::Execute(size_t) {
+    const uint32_t pending = pending_.exchange(0, std::memory_order_acq_rel);
+    if (pending == 0 || IsCancelled()) {
+        return 0;
+    }
+    // 工作线程来不及执行时合并为一次回调，多出的触发计为超限
+    if (pending > 1) {
+        overruns_.fetch_add(pending - 1, std::memory_order_relaxed);
+        BridgeTracer::Instance()->DeadlineMiss("timer", pending - 1);
+    }
+    RunCallback();
+    return 1;
+}
+
+bool BridgeTimer::Fire(int64_t now_ns, bool run_inline) {
+    const int64_t deadline = next_deadline_ns_;
+    const int64_t jitter = now_ns - deadline;
+    const uint64_t fired = fired_.fetch_add(1, std::memory_order_relaxed);
+    if (fired == 0 || jitter < min_jitter_ns_.load(std::memory_order_relaxed)) {
+        min_jitter_ns_.store(jitter, std::memory_order_relaxed);
+    }
+    if (fired == 0 || jitter > max_jitter_ns_.load(std::memory_order_relaxed)) {
+        max_jitter_ns_.store(jitter, std::memory_order_relaxed);
+    }
+    sum_abs_jitter_ns_.fetch_add(static_cast<uint64_t>(std::llabs(jitter)), std::memory_order_relaxed);
+
+    bool notify = false;
+    if (run_inline) {
+        RunCallback();
+    } else {
+        pending_.fetch_add(1, std::memory_order_acq_rel);
+        notify = true;
+    }
+
+    // 按绝对时刻推进，不累积漂移；已错过的周期直接跳过并计为超限
+    int64_t next = deadline + period_ns_;
+    const int64_t after = run_inline ? BridgeClock::Instance()->Now() : now_ns;
+    if (after >= next) {
+        const int64_t missed = (after - deadline) / period_ns_;
+        overruns_.fetch_add(static_cast<uint64_t>(missed), std::memory_order_relaxed);
+        BridgeTracer::Instance()->DeadlineMiss("timer", static_cast<uint64_t>(missed));
+        next = deadline + (missed + 1) * period_ns_;
+    }
+    next_deadline_ns_ = next;
+    return notify;
+}
+
+void BridgeTimer::RunCallback() {
+    BridgeTraceScope scope("timer", "timer");
+    const int64_t begin = BridgeClock::Instance()->Now();
+    try {
+        callback_();
+    } catch (const std::exception& e) {
+        std::cerr << "Timer callback error: " << e.what() << std::endl;
+    }
+    const int64_t elapsed = BridgeClock::Instance()->Now() - begin;
+    if (elapsed > 0 && static_cast<uint64_t>(elapsed) > max_callback_ns_.load(std::memory_order_relaxed)) {
+        max_callback_ns_.store(static_cast<uint64_t>(elapsed), std::memory_order_relaxed);
+    }
+}
+
+} // namespace robot
+} // namespace yunji
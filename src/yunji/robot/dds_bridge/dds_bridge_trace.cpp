@@ -0,0 +1,222 @@
+/**
+ * @file bridge_trace.cpp
+ * @brief 追踪环形缓冲实现文件
+ * @note 实现BridgeTraceRing与BridgeTracer类的具体功能
+ */
+#include "yunji/robot/dds_bridge/dds_bridge_trace.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_lockfree.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace yunji {
+namespace robot {
+
+BridgeTraceRing::BridgeTraceRing(size_t capacity, uint64_t thread_id, const std::string& thread_name)
+    : slots_(new Slot[BridgeRoundUpPow2(capacity)]),
+      mask_(BridgeRoundUpPow2(capacity) - 1),
+      thread_id_(thread_id),
+      thread_name_(thread_name) {}
+
+void BridgeTraceRing::Snapshot(std::vector<BridgeTraceEvent>& out) const {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t capacity = mask_ + 1;
+    const uint64_t begin = head > capacity ? head - capacity : 0;
+    for (uint64_t index = begin; index < head; ++index) {
+        const Slot& slot = slots_[index & mask_];
+        const uint64_t expected = 2 * index + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expected) {
+            continue;       // 已被覆盖或正在写入
+        }
+        BridgeTraceEvent event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == expected) {
+            out.push_back(event);
+        }
+    }
+}
+
+BridgeTracer::~BridgeTracer() {
+    if (dump_thread_.joinable()) {
+        dump_thread_.join();
+    }
+}
+
+void BridgeTracer::Enable(size_t ring_capacity) {
+    ring_capacity_.store(std::max<size_t>(ring_capacity, 2), std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+BridgeTraceRing* BridgeTracer::ThreadRing() {
+    thread_local BridgeTraceRing* ring = nullptr;
+    if (ring == nullptr) {
+        char name[16] = {0};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        auto created = std::make_shared<BridgeTraceRing>(ring_capacity_.load(std::memory_order_relaxed),
+                                                         static_cast<uint64_t>(::syscall(SYS_gettid)), name);
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(created);
+        ring = created.get();
+    }
+    return ring;
+}
+
+void BridgeTracer::Complete(const char* name, const char* category, int64_t start_ns,
+                            int64_t duration_ns, uint64_t arg) {
+    if (!IsEnabled()) {
+        return;
+    }
+    BridgeTraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.start_ns = start_ns;
+    event.duration_ns = duration_ns < 0 ? 0 : duration_ns;
+    event.arg = arg;
+    ThreadRing()->Push(event);
+}
+
+void BridgeTracer::Instant(const char* name, const char* category, uint64_t arg) {
+    if (!IsEnabled()) {
+        return;
+    }
+    BridgeTraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.start_ns = NowNs();
+    event.arg = arg;
+    ThreadRing()->Push(event);
+}
+
+const char* BridgeTracer::Intern(const std::string& text) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return interned_.insert(text).first->c_str();
+}
+
+/**
+ * @brief JSON字符串转义（名称来自话题名和字面量，只需处理引号、反斜杠和控制字符）
+ */
+static void AppendJsonString(std::string& out, const char* text) {
+    out += '"';
+    for (const char* p = text ? text : ""; *p; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += *p;
+        } else if (c < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += *p;
+        }
+    }
+    out += '"';
+}
+
+std::string BridgeTracer::ChromeTraceJson() const {
+    std::vector<std::shared_ptr<BridgeTraceRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings = rings_;
+    }
+
+    const int pid = static_cast<int>(::getpid());
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    char buffer[160];
+    std::vector<BridgeTraceEvent> events;
+    for (const auto& ring : rings) {
+        std::snprintf(buffer, sizeof(buffer),
+                      "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%d,\"tid\":%llu,\"args\":{\"name\":",
+                      first ? "" : ",", pid, static_cast<unsigned long long>(ring->ThreadId()));
+        out += buffer;
+        AppendJsonString(out, ring->ThreadName().c_str());
+        out += "}}";
+        first = false;
+
+        events.clear();
+        ring->Snapshot(events);
+        for (const auto& event : events) {
+            out += ",{\"name\":";
+            AppendJsonString(out, event.name);
+            out += ",\"cat\":";
+            AppendJsonString(out, event.category);
+            // Chrome trace时间单位为微秒，保留小数以显示纳秒精度
+            if (event.duration_ns >= 0) {
+                std::snprintf(buffer, sizeof(buffer),
+                              ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%llu,\"args\":{\"arg\":%llu}}",
+                              event.start_ns / 1e3, event.duration_ns / 1e3, pid,
+                              static_cast<unsigned long long>(ring->ThreadId()),
+                              static_cast<unsigned long long>(event.arg));
+            } else {
+                std::snprintf(buffer, sizeof(buffer),
+                              ",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":%d,\"tid\":%llu,\"args\":{\"arg\":%llu}}",
+                              event.start_ns / 1e3, pid,
+                              static_cast<unsigned long long>(ring->ThreadId()),
+                              static_cast<unsigned long long>(event.arg));
+            }
+            out += buffer;
+        }
+    }
+    out += "]}\n";
+    return out;
+}
+
+bool BridgeTracer::DumpChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Trace dump failed: cannot open " << path << std::endl;
+        return false;
+    }
+    file << ChromeTraceJson();
+    return static_cast<bool>(file);
+}
+
+void BridgeTracer::SetDumpOnDeadlineMiss(const std::string& path, std::chrono::milliseconds min_interval) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dump_path_ = path;
+    dump_interval_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(min_interval).count();
+}
+
+void BridgeTracer::DeadlineMiss(const char* name, uint64_t missed) {
+    if (!IsEnabled()) {
+        return;
+    }
+    Instant(name, "deadline_miss", missed);
+
+    const int64_t now = NowNs();
+    const int64_t last = last_dump_ns_.load(std::memory_order_relaxed);
+    if (last != 0 && now - last < dump_interval_ns_) {
+        return;
+    }
+    // 同一时刻只允许一个导出线程；导出在后台进行，不阻塞定时线程
+    if (dumping_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        path = dump_path_;
+        if (path.empty()) {
+            dumping_.store(false, std::memory_order_release);
+            return;
+        }
+        if (dump_thread_.joinable()) {
+            dump_thread_.join();        // 上一次导出已结束（dumping_为false），这里不会阻塞
+        }
+        last_dump_ns_.store(now, std::memory_order_relaxed);
+        dump_thread_ = std::thread([this, path]() {
+            DumpChromeTrace(path);
+            dumping_.store(false, std::memory_order_release);
+        });
+    }
+}
+
+} // namespace robot
+} // namespace yunji
@@ -0,0 +1,192 @@
+/**
+ * @file bridge_record.cpp
+ * @brief 话题录制命令行工具
+ * @note 在独立进程中录制指定话题，控制进程只需多匹配一个远端读者；--info查看已录制分段的内容概要，
+ *       --reindex为录制进程异常退出后缺少索引的分段重建索引。
+ *
+ * 用法: yj_bridge_record --topics 话题:类型[,话题:类型...] [--dir ./record] [--prefix yjrec] [--lanes 2]
+ *                        [--segment-mb 64] [--segment-sec 60] [--depth 256] [--reliable]
+ *                        [--index-ms 100] [--codec raw|delta] [--quantize 步长] [--partition 分区[,分区...]]
+ *                        [--domain 0] [--interface eth0] [--config cyclonedds.xml] [--duration 秒]
+ *       yj_bridge_record --info 分段文件...
+ *       yj_bridge_record --reindex 分段文件... [--index-ms 100]
+ */
+#include "tool_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_recorder.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_record_index.hpp"
+
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <map>
+#include <thread>
+
+using namespace yunji::robot;
+
+namespace
+{
+
+std::atomic<bool> g_stop{false};
+
+void OnSignal(int) {
+    g_stop = true;
+}
+
+int PrintInfo(const std::vector<std::string>& files) {
+    int status = 0;
+    for (const auto& file : files) {
+        BridgeSegmentReader reader;
+        if (!reader.Open(file)) {
+            std::fprintf(stderr, "%s: not a segment file\n", file.c_str());
+            status = 1;
+            continue;
+        }
+        struct TopicSummary {
+            uint64_t samples = 0;
+            uint64_t bytes = 0;
+            uint64_t stored = 0;
+        };
+        std::map<uint16_t, TopicSummary> summary;
+        BridgeRecordedSample sample;
+        int64_t first_ns = 0, last_ns = 0;
+        while (reader.Next(sample)) {
+            TopicSummary& topic = summary[sample.topic_id];
+            ++topic.samples;
+            topic.bytes += sample.size;
+            topic.stored += sample.stored_size;
+            first_ns = first_ns == 0 ? sample.receive_ns : first_ns;
+            last_ns = sample.receive_ns;
+        }
+        const BridgeSegmentHeader& header = reader.Header();
+        std::printf("%s: lane %u segment %u, %.3f s\n", file.c_str(), header.lane, header.sequence,
+                    (last_ns - first_ns) / 1e9);
+        BridgeSegmentIndex index;
+        if (index.Open(BridgeIndexPath(file), &header)) {
+            std::printf("  index: %llu time entries, %llu key entries, %.0f ms interval\n",
+                        static_cast<unsigned long long>(index.Header().time_entries),
+                        static_cast<unsigned long long>(index.Header().key_entries),
+                        index.Header().interval_ns / 1e6);
+        } else {
+            std::printf("  index: missing or stale (use --reindex)\n");
+        }
+        for (const auto& topic : reader.Topics()) {
+            const TopicSummary& stats = summary[topic.id];
+            std::printf("  [%u] %-40s %-28s %10llu samples %12llu bytes  type %016llx\n", topic.id,
+                        topic.name.c_str(), topic.type.type_name.c_str(),
+                        static_cast<unsigned long long>(stats.samples), static_cast<unsigned long long>(stats.bytes),
+                        static_cast<unsigned long long>(topic.type.type_hash));
+            if (topic.codec == BridgeRecordCodec::kDelta) {
+                std::printf("      delta coded, quantization %g: %llu bytes stored (%.2fx)\n", topic.quantization,
+                            static_cast<unsigned long long>(stats.stored),
+                            stats.stored > 0 ? static_cast<double>(stats.bytes) / stats.stored : 0.0);
+            }
+        }
+    }
+    return status;
+}
+
+int Reindex(const std::vector<std::string>& files, int64_t interval_ns) {
+    int status = 0;
+    for (const auto& file : files) {
+        BridgeIndexBuilder builder;
+        if (!builder.Rebuild(file, interval_ns)) {
+            std::fprintf(stderr, "%s: reindex failed\n", file.c_str());
+            status = 1;
+            continue;
+        }
+        std::printf("%s: %zu time entries, %zu key entries\n", file.c_str(), builder.TimeEntries(),
+                    builder.KeyEntries());
+    }
+    return status;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const tool::Args args(argc, argv, {"info", "reindex", "reliable"});
+    const long long index_ms = args.GetInt("index-ms", 100);
+    if (args.Has("info")) {
+        return PrintInfo(args.Positional());
+    }
+    if (args.Has("reindex")) {
+        return Reindex(args.Positional(), index_ms * 1000000LL);
+    }
+
+    const std::vector<std::string> topics = tool::SplitList(args.Get("topics", ""));
+    if (topics.empty()) {
+        std::fprintf(stderr, "usage: yj_bridge_record --topics topic:type[,topic:type...] [--dir DIR]\n"
+                             "       yj_bridge_record --info FILE...\n"
+                             "       yj_bridge_record --reindex FILE...\n"
+                             "types: %s\n", tool::kTypeNames);
+        return 1;
+    }
+
+    if (args.Has("config")) {
+        BridgeFactory::Instance()->Init(args.Get("config", ""));
+    } else {
+        BridgeFactory::Instance()->Init(static_cast<int>(args.GetInt("domain", 0)), args.Get("interface", ""));
+    }
+
+    BridgeRecorderOptions options;
+    options.directory = args.Get("dir", "./record");
+    options.prefix = args.Get("prefix", options.prefix);
+    options.lanes = static_cast<size_t>(args.GetInt("lanes", 2));
+    options.segment_bytes = static_cast<size_t>(args.GetInt("segment-mb", 64)) << 20;
+    options.segment_duration = std::chrono::seconds(args.GetInt("segment-sec", 60));
+    options.reader_depth = static_cast<uint32_t>(args.GetInt("depth", 256));
+    options.reliable = args.Has("reliable");
+    options.partitions = tool::SplitList(args.Get("partition", ""));
+    options.index_interval = std::chrono::milliseconds(index_ms);
+    if (args.Get("codec", "raw") == "delta") {
+        options.codec = BridgeRecordCodec::kDelta;
+        options.quantization = std::atof(args.Get("quantize", "0").c_str());
+    }
+    BridgeRecorder recorder(options);
+
+    for (const auto& entry : topics) {
+        const size_t colon = entry.rfind(':');
+        if (colon == std::string::npos) {
+            std::fprintf(stderr, "missing type for topic %s\n", entry.c_str());
+            return 1;
+        }
+        const std::string topic = entry.substr(0, colon);
+        const std::string type = entry.substr(colon + 1);
+        const bool added = tool::VisitType(type, [&](auto tag) {
+            return recorder.AddTopic<typename decltype(tag)::type>(topic);
+        });
+        if (!added) {
+            std::fprintf(stderr, "cannot record %s as %s (types: %s)\n", topic.c_str(), type.c_str(),
+                         tool::kTypeNames);
+            return 1;
+        }
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+    if (!recorder.Start()) {
+        return 1;
+    }
+
+    const long long duration = args.GetInt("duration", 0);
+    const auto start = std::chrono::steady_clock::now();
+    BridgeRecorderStats last;
+    while (!g_stop) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const BridgeRecorderStats stats = recorder.Stats();
+        std::fprintf(stderr, "records %llu (+%llu/s)  %.1f MB (+%.2f MB/s, %.2fx)  segments %llu  lost %llu  errors %llu\n",
+                     static_cast<unsigned long long>(stats.records),
+                     static_cast<unsigned long long>(stats.records - last.records), stats.bytes / 1048576.0,
+                     (stats.bytes - last.bytes) / 1048576.0,
+                     stats.bytes > 0 ? static_cast<double>(stats.raw_bytes) / stats.bytes : 1.0,
+                     static_cast<unsigned long long>(stats.segments),
+                     static_cast<unsigned long long>(stats.lost), static_cast<unsigned long long>(stats.errors));
+        last = stats;
+        if (duration > 0 && std::chrono::steady_clock::now() - start >= std::chrono::seconds(duration)) {
+            break;
+        }
+    }
+    recorder.Stop();
+    return 0;
+}
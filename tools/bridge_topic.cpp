@@ -0,0 +1,499 @@
+/**
+ * @file bridge_topic.cpp
+ * @brief 话题查看命令行工具
+ * @note list从DCPSPublication/DCPSSubscription内置话题列出话题、类型与端点数；hz、bw、delay、echo
+ *       按话题名动态订阅（BridgeDynamicSubscriber），类型取自发布端的type_info，不需要编译进IDL类型。
+ *       hz/bw/delay只看原始CDR的到达时间、长度与源时间戳，不解析字段。
+ *       为不干扰控制进程：默认以best effort读者订阅（可靠写者不会为本工具重传或阻塞），
+ *       进程及其DDS线程以较低优先级运行，可用--cpus限定在非控制核上；时钟同步只在--time-sync时启动。
+ *
+ * 用法: yj_bridge_topic list [--wait 2] [--verbose]
+ *       yj_bridge_topic hz|bw|delay 话题... [--window 1000] [--time-sync]
+ *       yj_bridge_topic echo 话题... [--fields 字段,...] [--count N] [--raw]
+ *       通用: [--type 类型名] [--qos telemetry] [--partition 分区,...] [--nice 10] [--cpus 2,3] [--duration 秒]
+ *             [--domain 0] [--interface eth0] [--config cyclonedds.xml]
+ */
+#include "tool_common.hpp"
+
+#include "yunji/robot/dds_bridge/dds_bridge_dynamic_subscriber.hpp"
+#include "yunji/robot/dds_bridge/dds_bridge_time_sync.hpp"
+
+#include <sched.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace yunji::robot;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+std::atomic<bool> g_stop{false};
+
+void OnSignal(int) {
+    g_stop = true;
+}
+
+/**
+ * @brief 降低本进程优先级并限定CPU，需在创建任何线程（包括DDS线程）之前调用，之后创建的线程继承该设置
+ */
+void Deprioritize(const tool::Args& args) {
+    const int nice = static_cast<int>(args.GetInt("nice", 10));
+    if (nice != 0 && setpriority(PRIO_PROCESS, 0, nice) != 0) {
+        std::fprintf(stderr, "setpriority(%d) failed: %s\n", nice, std::strerror(errno));
+    }
+    const std::vector<std::string> cpus = tool::SplitList(args.Get("cpus", ""));
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto& cpu : cpus) {
+        CPU_SET(std::atoi(cpu.c_str()), &set);
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        std::fprintf(stderr, "sched_setaffinity failed: %s\n", std::strerror(errno));
+    }
+}
+
+struct Endpoint {
+    bool writer = false;
+    std::string topic;
+    std::string type;
+    bool reliable = false;
+    bool type_info = false;
+    std::string participant;
+    std::string partitions;
+};
+
+std::string GuidText(const dds_guid_t& guid, size_t bytes) {
+    std::string text;
+    char hex[3];
+    for (size_t i = 0; i < bytes; ++i) {
+        std::snprintf(hex, sizeof(hex), "%02x", guid.v[i]);
+        text += hex;
+    }
+    return text;
+}
+
+/**
+ * @brief 取出内置话题的端点变化，存活的加入、已注销或已删除的移除
+ */
+void CollectEndpoints(dds_entity_t reader, bool writer, std::map<std::string, Endpoint>& endpoints) {
+    constexpr size_t kBatch = 64;
+    std::array<void*, kBatch> samples{};
+    std::array<dds_sample_info_t, kBatch> infos{};
+    dds_return_t count = 0;
+    while ((count = dds_take(reader, samples.data(), infos.data(), kBatch, kBatch)) > 0) {
+        for (dds_return_t i = 0; i < count; ++i) {
+            const auto* sample = static_cast<const dds_builtintopic_endpoint_t*>(samples[i]);
+            const std::string key(reinterpret_cast<const char*>(sample->key.v), sizeof(sample->key.v));
+            if (infos[i].instance_state != DDS_IST_ALIVE) {
+                endpoints.erase(key);
+                continue;
+            }
+            if (!infos[i].valid_data) {
+                continue;
+            }
+            Endpoint& endpoint = endpoints[key];
+            endpoint.writer = writer;
+            endpoint.topic = sample->topic_name;
+            endpoint.type = sample->type_name;
+            endpoint.participant = GuidText(sample->participant_key, 12);
+            dds_reliability_kind_t reliability = DDS_RELIABILITY_BEST_EFFORT;
+            dds_duration_t blocking = 0;
+            endpoint.reliable = dds_qget_reliability(sample->qos, &reliability, &blocking) &&
+                                reliability == DDS_RELIABILITY_RELIABLE;
+            uint32_t partition_count = 0;
+            char** partitions = nullptr;
+            endpoint.partitions.clear();
+            if (dds_qget_partition(sample->qos, &partition_count, &partitions)) {
+                for (uint32_t p = 0; p < partition_count; ++p) {
+                    endpoint.partitions += (p == 0 ? "" : ",") + std::string(partitions[p]);
+                    dds_free(partitions[p]);
+                }
+                dds_free(partitions);
+            }
+            const dds_typeinfo_t* type_info = nullptr;
+            endpoint.type_info = dds_builtintopic_get_endpoint_type_info(
+                const_cast<dds_builtintopic_endpoint_t*>(sample), &type_info) == DDS_RETCODE_OK && type_info != nullptr;
+        }
+        dds_return_loan(reader, samples.data(), count);
+    }
+}
+
+int ListTopics(const tool::Args& args) {
+    const dds_entity_t participant = BridgeFactory::Instance()->GetParticipant()->delegate()->get_ddsc_entity();
+    const dds_entity_t publications = dds_create_reader(participant, DDS_BUILTIN_TOPIC_DCPSPUBLICATION, nullptr, nullptr);
+    const dds_entity_t subscriptions = dds_create_reader(participant, DDS_BUILTIN_TOPIC_DCPSSUBSCRIPTION, nullptr, nullptr);
+    if (publications < 0 || subscriptions < 0) {
+        std::fprintf(stderr, "cannot read builtin topics: %s\n",
+                     dds_strretcode(publications < 0 ? publications : subscriptions));
+        return 1;
+    }
+
+    // 发现是异步的，等待一段时间收集远端端点
+    std::map<std::string, Endpoint> endpoints;
+    const auto deadline = Clock::now() + std::chrono::milliseconds(
+        static_cast<int64_t>(std::atof(args.Get("wait", "2").c_str()) * 1000.0));
+    while (!g_stop) {
+        CollectEndpoints(publications, true, endpoints);
+        CollectEndpoints(subscriptions, false, endpoints);
+        if (Clock::now() >= deadline) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    dds_delete(publications);
+    dds_delete(subscriptions);
+
+    struct TopicSummary {
+        std::vector<std::string> types;
+        int publishers = 0;
+        int subscribers = 0;
+        bool type_info = false;
+        std::vector<const Endpoint*> endpoints;
+    };
+    std::map<std::string, TopicSummary> topics;
+    for (const auto& entry : endpoints) {
+        const Endpoint& endpoint = entry.second;
+        TopicSummary& topic = topics[endpoint.topic];
+        if (std::find(topic.types.begin(), topic.types.end(), endpoint.type) == topic.types.end()) {
+            topic.types.push_back(endpoint.type);
+        }
+        ++(endpoint.writer ? topic.publishers : topic.subscribers);
+        topic.type_info = topic.type_info || (endpoint.writer && endpoint.type_info);
+        topic.endpoints.push_back(&endpoint);
+    }
+
+    const bool verbose = args.Has("verbose");
+    for (const auto& entry : topics) {
+        const TopicSummary& topic = entry.second;
+        std::string types;
+        for (const auto& type : topic.types) {
+            types += types.empty() ? type : "," + type;
+        }
+        // 发布端不带type_info时hz/echo无法解析类型
+        std::printf("%-40s %-32s %3d pub %3d sub%s\n", entry.first.c_str(), types.c_str(), topic.publishers,
+                    topic.subscribers, topic.publishers > 0 && !topic.type_info ? "  (no type info)" : "");
+        if (verbose) {
+            for (const Endpoint* endpoint : topic.endpoints) {
+                std::printf("    %s %s  %-11s partition \"%s\"  participant %s\n", endpoint->writer ? "pub" : "sub",
+                            endpoint->type.c_str(), endpoint->reliable ? "reliable" : "best_effort",
+                            endpoint->partitions.c_str(), endpoint->participant.c_str());
+            }
+        }
+    }
+    if (topics.empty()) {
+        std::printf("no topics discovered\n");
+    }
+    return 0;
+}
+
+/**
+ * @brief 最近window个样本的到达时间、间隔、延迟与长度，回调线程写入，主线程定期取快照
+ */
+class ArrivalWindow {
+public:
+    struct Arrival {
+        int64_t arrival_ns = 0;     // 单调时钟
+        int64_t interval_ns = 0;    // 与上一个样本的间隔，首个样本为0
+        int64_t latency_ns = 0;
+        uint32_t size = 0;
+    };
+
+    explicit ArrivalWindow(size_t capacity) : ring_(std::max<size_t>(capacity, 2)) {}
+
+    void Add(int64_t latency_ns, uint32_t size) {
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count();
+        std::lock_guard<std::mutex> lock(mutex_);
+        Arrival& arrival = ring_[next_];
+        arrival.arrival_ns = now;
+        arrival.interval_ns = last_ns_ > 0 ? now - last_ns_ : 0;
+        arrival.latency_ns = latency_ns;
+        arrival.size = size;
+        last_ns_ = now;
+        next_ = (next_ + 1) % ring_.size();
+        filled_ = std::min(filled_ + 1, ring_.size());
+        ++total_;
+    }
+
+    /**
+     * @return 自上次快照以来是否有新样本
+     */
+    bool Snapshot(std::vector<Arrival>& arrivals) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        arrivals.clear();
+        for (size_t i = 0; i < filled_; ++i) {
+            arrivals.push_back(ring_[(next_ + ring_.size() - filled_ + i) % ring_.size()]);
+        }
+        const bool fresh = total_ != reported_;
+        reported_ = total_;
+        return fresh;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<Arrival> ring_;
+    size_t next_ = 0;
+    size_t filled_ = 0;
+    int64_t last_ns_ = 0;
+    uint64_t total_ = 0;
+    uint64_t reported_ = 0;
+};
+
+struct Summary {
+    size_t count = 0;
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double stddev = 0.0;
+};
+
+Summary Summarize(const std::vector<double>& values) {
+    Summary summary;
+    summary.count = values.size();
+    if (values.empty()) {
+        return summary;
+    }
+    summary.min = *std::min_element(values.begin(), values.end());
+    summary.max = *std::max_element(values.begin(), values.end());
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    summary.mean = sum / values.size();
+    double variance = 0.0;
+    for (double value : values) {
+        variance += (value - summary.mean) * (value - summary.mean);
+    }
+    summary.stddev = std::sqrt(variance / values.size());
+    return summary;
+}
+
+std::string ByteText(double bytes) {
+    char text[32];
+    if (bytes >= 1048576.0) {
+        std::snprintf(text, sizeof(text), "%.2f MB", bytes / 1048576.0);
+    } else if (bytes >= 1024.0) {
+        std::snprintf(text, sizeof(text), "%.2f KB", bytes / 1024.0);
+    } else {
+        std::snprintf(text, sizeof(text), "%.0f B", bytes);
+    }
+    return text;
+}
+
+void Report(const std::string& mode, const std::string& topic, const std::vector<ArrivalWindow::Arrival>& arrivals) {
+    if (mode == "hz") {
+        std::vector<double> intervals;
+        for (const auto& arrival : arrivals) {
+            if (arrival.interval_ns > 0) {
+                intervals.push_back(arrival.interval_ns / 1e6);
+            }
+        }
+        const Summary ms = Summarize(intervals);
+        if (ms.count == 0) {
+            return;
+        }
+        std::printf("%s: average rate %.3f Hz  min %.3f ms  max %.3f ms  std dev %.3f ms  window %zu\n",
+                    topic.c_str(), 1e3 / ms.mean, ms.min, ms.max, ms.stddev, ms.count + 1);
+    } else if (mode == "bw") {
+        std::vector<double> sizes;
+        double bytes = 0.0;
+        for (size_t i = 0; i < arrivals.size(); ++i) {
+            sizes.push_back(arrivals[i].size);
+            bytes += i > 0 ? arrivals[i].size : 0.0;     // 首个样本只作时间起点
+        }
+        const Summary size = Summarize(sizes);
+        const double span_s = arrivals.size() > 1 ? (arrivals.back().arrival_ns - arrivals.front().arrival_ns) / 1e9 : 0.0;
+        if (span_s <= 0.0) {
+            return;
+        }
+        std::printf("%s: %s/s from %zu msgs  mean %s  min %s  max %s\n", topic.c_str(),
+                    ByteText(bytes / span_s).c_str(), size.count, ByteText(size.mean).c_str(),
+                    ByteText(size.min).c_str(), ByteText(size.max).c_str());
+    } else {
+        std::vector<double> latencies;
+        for (const auto& arrival : arrivals) {
+            latencies.push_back(arrival.latency_ns / 1e6);
+        }
+        const Summary ms = Summarize(latencies);
+        std::printf("%s: average delay %.3f ms  min %.3f ms  max %.3f ms  std dev %.3f ms  window %zu%s\n",
+                    topic.c_str(), ms.mean, ms.min, ms.max, ms.stddev, ms.count,
+                    BridgeTimeSync::Instance()->IsRunning() ? "" : "  (clocks assumed synchronized)");
+    }
+}
+
+class Echo {
+public:
+    explicit Echo(const tool::Args& args)
+        : fields_(tool::SplitList(args.Get("fields", ""))), raw_(args.Has("raw")),
+          limit_(static_cast<uint64_t>(std::max(0LL, args.GetInt("count", 0)))) {}
+
+    void Print(const std::string& topic, const BridgeDynamicSubscriber& subscriber, const BridgeDynamicSample& sample,
+               std::vector<int>& indices) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (limit_ > 0 && printed_ >= limit_) {
+            return;
+        }
+        if (indices.empty() && !fields_.empty()) {
+            for (const auto& field : fields_) {
+                const int index = subscriber.Layout().FindField(field);
+                if (index < 0) {
+                    std::fprintf(stderr, "%s: no field %s in %s\n", topic.c_str(), field.c_str(),
+                                 subscriber.TypeName().c_str());
+                }
+                indices.push_back(index);
+            }
+        }
+        std::printf("--- %s  %s  source %lld.%09lld\n", topic.c_str(), subscriber.TypeName().c_str(),
+                    static_cast<long long>(sample.source_ns / 1000000000LL),
+                    static_cast<long long>(sample.source_ns % 1000000000LL));
+        if (raw_) {
+            for (uint32_t i = 0; i < sample.size; ++i) {
+                std::printf("%02x%s", sample.payload[i], (i + 1) % 16 == 0 || i + 1 == sample.size ? "\n" : " ");
+            }
+        } else if (fields_.empty()) {
+            std::fputs(sample.view.ToString().c_str(), stdout);
+        } else {
+            for (size_t i = 0; i < fields_.size(); ++i) {
+                if (indices[i] >= 0 && sample.view.Has(indices[i])) {
+                    std::printf("%s: %s\n", fields_[i].c_str(), sample.view.Text(indices[i]).c_str());
+                }
+            }
+        }
+        std::fflush(stdout);
+        if (limit_ > 0 && ++printed_ >= limit_) {
+            g_stop = true;
+        }
+    }
+
+    bool Raw() const { return raw_; }
+
+private:
+    std::vector<std::string> fields_;
+    bool raw_ = false;
+    uint64_t limit_ = 0;
+    uint64_t printed_ = 0;
+    std::mutex mutex_;
+};
+
+struct Subscription {
+    std::string topic;
+    BridgeDynamicSubscriberPtr subscriber;
+    std::unique_ptr<ArrivalWindow> window;
+    std::vector<int> field_indices;
+    bool announced = false;
+};
+
+int Subscribe(const std::string& mode, const std::vector<std::string>& topics, const tool::Args& args) {
+    BridgeQosPreset preset = BridgeQosPreset::kTelemetry;
+    if (!BridgeQosPresetFromName(args.Get("qos", "telemetry"), preset)) {
+        std::fprintf(stderr, "unknown qos preset %s\n", args.Get("qos", "").c_str());
+        return 1;
+    }
+    if (args.Has("time-sync") && !BridgeTimeSync::Instance()->Start()) {
+        return 1;
+    }
+
+    const bool echo = mode == "echo";
+    Echo printer(args);
+    const size_t window = static_cast<size_t>(std::max(2LL, args.GetInt("window", 1000)));
+    std::vector<std::unique_ptr<Subscription>> subscriptions;
+    for (const auto& topic : topics) {
+        auto subscription = std::make_unique<Subscription>();
+        Subscription* entry = subscription.get();
+        entry->topic = topic;
+        entry->subscriber = std::make_unique<BridgeDynamicSubscriber>(topic);
+        entry->subscriber->SetQosPreset(preset);
+        entry->subscriber->SetPartitions(tool::SplitList(args.Get("partition", "")));
+        entry->subscriber->SetDecode(echo && !printer.Raw());
+        if (args.Has("type")) {
+            entry->subscriber->SetTypeName(args.Get("type", ""));
+        }
+        BridgeDynamicSubscriber::CallbackType callback;
+        if (echo) {
+            callback = [entry, &printer](const BridgeDynamicSample& sample) {
+                printer.Print(entry->topic, *entry->subscriber, sample, entry->field_indices);
+            };
+        } else {
+            entry->window = std::make_unique<ArrivalWindow>(window);
+            callback = [entry](const BridgeDynamicSample& sample) {
+                entry->window->Add(sample.latency_ns, sample.size);
+            };
+        }
+        if (!entry->subscriber->InitBridge(callback)) {
+            return 1;
+        }
+        subscriptions.push_back(std::move(subscription));
+    }
+
+    const long long duration = args.GetInt("duration", 0);
+    const auto start = Clock::now();
+    std::vector<ArrivalWindow::Arrival> arrivals;
+    while (!g_stop) {
+        std::this_thread::sleep_for(echo ? std::chrono::milliseconds(100) : std::chrono::milliseconds(1000));
+        for (auto& subscription : subscriptions) {
+            if (!subscription->announced && subscription->subscriber->IsResolved()) {
+                subscription->announced = true;
+                std::fprintf(stderr, "subscribed to %s [%s]\n", subscription->topic.c_str(),
+                             subscription->subscriber->TypeName().c_str());
+            }
+            if (echo || g_stop) {
+                continue;
+            }
+            if (!subscription->subscriber->IsResolved()) {
+                std::printf("%s: waiting for a publisher\n", subscription->topic.c_str());
+            } else if (!subscription->window->Snapshot(arrivals)) {
+                std::printf("%s: no new messages\n", subscription->topic.c_str());
+            } else {
+                Report(mode, subscription->topic, arrivals);
+            }
+        }
+        std::fflush(stdout);
+        if (duration > 0 && Clock::now() - start >= std::chrono::seconds(duration)) {
+            break;
+        }
+    }
+    BridgeTimeSync::Instance()->Stop();
+    return 0;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const tool::Args args(argc, argv, {"verbose", "time-sync", "raw"});
+    std::vector<std::string> positional = args.Positional();
+    const std::string mode = positional.empty() ? "" : positional.front();
+    const std::vector<std::string> topics(positional.begin() + (positional.empty() ? 0 : 1), positional.end());
+    const bool subscribe = mode == "hz" || mode == "bw" || mode == "delay" || mode == "echo";
+    if (mode != "list" && !(subscribe && !topics.empty())) {
+        std::fprintf(stderr, "usage: yj_bridge_topic list [--wait SEC] [--verbose]\n"
+                             "       yj_bridge_topic hz|bw|delay TOPIC... [--window N] [--time-sync]\n"
+                             "       yj_bridge_topic echo TOPIC... [--fields a,b] [--count N] [--raw]\n");
+        return 1;
+    }
+
+    Deprioritize(args);
+    if (args.Has("config")) {
+        BridgeFactory::Instance()->Init(args.Get("config", ""));
+    } else {
+        BridgeFactory::Instance()->Init(static_cast<int>(args.GetInt("domain", 0)), args.Get("interface", ""));
+    }
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    return mode == "list" ? ListTopics(args) : Subscribe(mode, topics, args);
+}
@@ -0,0 +1,129 @@
+#ifndef __YJ_ROBOT_SDK_TOOL_COMMON_HPP__
+#define __YJ_ROBOT_SDK_TOOL_COMMON_HPP__
+
+/**
+ * @file tool_common.hpp
+ * @brief 命令行工具共用的参数解析与内置消息类型表
+ * @copyright Copyright (c) 2025 YunJi Robotics. All rights reserved.
+ */
+
+#include "yunji/idl/BmsData.hpp"
+#include "yunji/idl/HelloWorldData.hpp"
+#include "yunji/idl/ImuData.hpp"
+#include "yunji/idl/JointCommand.hpp"
+#include "yunji/idl/JointState.hpp"
+#include "yunji/idl/TimeSync.hpp"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace yunji
+{
+
+namespace robot
+{
+
+namespace tool
+{
+
+/**
+ * @brief "--key value"形式的命令行参数，不以"--"开头的参数按顺序收集为位置参数
+ */
+class Args {
+public:
+    /**
+     * @param flags 不带取值的开关选项名（不含"--"），其后的参数仍按位置参数收集
+     */
+    Args(int argc, char** argv, std::initializer_list<const char*> flags = {}) {
+        const std::set<std::string> switches(flags.begin(), flags.end());
+        for (int i = 1; i < argc; ++i) {
+            std::string key = argv[i];
+            if (key.rfind("--", 0) != 0) {
+                positional_.push_back(key);
+                continue;
+            }
+            key = key.substr(2);
+            if (switches.count(key) == 0 && i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+                values_[key] = argv[++i];
+            } else {
+                values_[key] = "1";
+            }
+        }
+    }
+
+    std::string Get(const std::string& key, const std::string& fallback) const {
+        auto it = values_.find(key);
+        return it == values_.end() ? fallback : it->second;
+    }
+
+    long long GetInt(const std::string& key, long long fallback) const {
+        auto it = values_.find(key);
+        return it == values_.end() ? fallback : std::atoll(it->second.c_str());
+    }
+
+    bool Has(const std::string& key) const { return values_.count(key) != 0; }
+
+    const std::vector<std::string>& Positional() const { return positional_; }
+
+private:
+    std::map<std::string, std::string> values_;
+    std::vector<std::string> positional_;
+};
+
+inline std::vector<std::string> SplitList(const std::string& text, char separator = ',') {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, separator)) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+template <typename T>
+struct TypeTag {
+    using type = T;
+};
+
+/**
+ * @brief 按短名（如"joint_state"）或完整类型名（如"JointState::JointStateData"）分派到内置消息类型
+ * @param visitor 以TypeTag<T>调用的泛型可调用对象
+ * @return 类型未知时返回false，否则返回visitor的结果
+ */
+template <typename Visitor>
+bool VisitType(const std::string& name, Visitor&& visitor) {
+    if (name == "joint_state" || name == "JointState::JointStateData") {
+        return visitor(TypeTag<JointState::JointStateData>());
+    }
+    if (name == "joint_cmd" || name == "JointCommand::JointCmd") {
+        return visitor(TypeTag<JointCommand::JointCmd>());
+    }
+    if (name == "imu" || name == "ImuData::Imu") {
+        return visitor(TypeTag<ImuData::Imu>());
+    }
+    if (name == "bms" || name == "BmsData::Bms") {
+        return visitor(TypeTag<BmsData::Bms>());
+    }
+    if (name == "hello" || name == "HelloWorldData::Msg") {
+        return visitor(TypeTag<HelloWorldData::Msg>());
+    }
+    if (name == "time_sync" || name == "TimeSync::Ping") {
+        return visitor(TypeTag<TimeSync::Ping>());
+    }
+    return false;
+}
+
+constexpr const char* kTypeNames = "joint_state, joint_cmd, imu, bms, hello, time_sync";
+
+}
+}
+}
+
+#endif//__YJ_ROBOT_SDK_TOOL_COMMON_HPP__